@@ -0,0 +1,670 @@
+#ifndef HGRAPH_LIB_STD_INCREMENTAL_KERNELS_H
+#define HGRAPH_LIB_STD_INCREMENTAL_KERNELS_H
+
+/**
+ * Incremental aggregate kernels shared by the collection and window
+ * operators: running moments over values that are added and withdrawn, a
+ * sliding extremum, and an order-statistic multiset for quantiles. The
+ * window kernels are kept in step with their input by ``WindowTimeline``;
+ * ``WindowKernelState`` bundles the two as a node's ``State``.
+ */
+
+#include <hgraph/types/primitive_types.h>
+#include <hgraph/types/static_schema.h>
+#include <hgraph/types/time_series/ts_data/window_view.h>
+#include <hgraph/types/time_series/ts_input/window_view.h>
+#include <hgraph/types/value/value.h>
+#include <hgraph/util/date_time.h>
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hgraph::stdlib
+{
+    namespace incremental_kernel_detail
+    {
+        template <typename T>
+        inline void compensated_add(T &sum, T &compensation, T value) noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                // Neumaier: the compensation collects the low-order bits lost
+                // by each addition, so add/withdraw cycles do not drift.
+                const T next = sum + value;
+                compensation += std::abs(sum) >= std::abs(value) ? (sum - next) + value : (value - next) + sum;
+                sum = next;
+            }
+            else
+            {
+                static_cast<void>(compensation);
+                sum += value;
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] constexpr bool is_nan(T value) noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>) { return std::isnan(value); }
+            else
+            {
+                static_cast<void>(value);
+                return false;
+            }
+        }
+
+        /**
+         * Running sum and moments over a multiset of numeric contributions
+         * that can be added and withdrawn, so aggregates update from a delta
+         * instead of rescanning.
+         *
+         * The second moment is kept as compensated sums of ``x - shift``,
+         * where ``shift`` is the first value seen after the last reset: the
+         * shifted-data variance is stable while the shift stays near the
+         * mean, and is exact for integer data. A multiset that empties
+         * resets every term, and ``needs_reanchor`` asks the caller for a
+         * rescan once withdrawals outnumber the live contributions.
+         *
+         * NaN and infinite contributions are tallied apart from the sums
+         * (``count`` includes them), so they decide the aggregates only
+         * while one is present and withdrawing the last restores the
+         * finite result.
+         */
+        template <typename T>
+        struct IncrementalMoments
+        {
+            T           sum{};
+            T           sum_compensation{};
+            std::size_t count{0};
+            std::size_t withdrawals{0};
+            std::size_t nan_count{0};
+            std::size_t positive_infinity_count{0};
+            std::size_t negative_infinity_count{0};
+            Float       shift{0.0};
+            Float       shifted_sum{0.0};
+            Float       shifted_sum_compensation{0.0};
+            Float       shifted_sum_sq{0.0};
+            Float       shifted_sum_sq_compensation{0.0};
+
+            void reset() noexcept { *this = IncrementalMoments{}; }
+
+            void add(T value) noexcept
+            {
+                ++count;
+                if (tally_non_finite(value, true)) { return; }
+                if (finite_count() == 1) { shift = static_cast<Float>(value); }
+                accumulate(value, T{1});
+            }
+
+            void remove(T value) noexcept
+            {
+                if (count <= 1)
+                {
+                    reset();
+                    return;
+                }
+                --count;
+                if (tally_non_finite(value, false)) { return; }
+                if (finite_count() == 0)
+                {
+                    // Only non-finite contributions remain: restart the sums
+                    // so the next finite value re-anchors the shift.
+                    reset_finite();
+                    return;
+                }
+                ++withdrawals;
+                accumulate(value, T{-1});
+            }
+
+            [[nodiscard]] std::size_t non_finite_count() const noexcept
+            {
+                return nan_count + positive_infinity_count + negative_infinity_count;
+            }
+
+            [[nodiscard]] bool needs_reanchor() const noexcept
+            {
+                return withdrawals > std::max<std::size_t>(count, 64);
+            }
+
+            [[nodiscard]] T total() const noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    if (nan_count != 0 || (positive_infinity_count != 0 && negative_infinity_count != 0))
+                    {
+                        return std::numeric_limits<T>::quiet_NaN();
+                    }
+                    if (positive_infinity_count != 0) { return std::numeric_limits<T>::infinity(); }
+                    if (negative_infinity_count != 0) { return -std::numeric_limits<T>::infinity(); }
+                }
+                return sum + sum_compensation;
+            }
+
+            [[nodiscard]] Float mean(std::size_t divisor) const noexcept
+            {
+                return divisor == 0 ? std::numeric_limits<Float>::quiet_NaN()
+                                    : static_cast<Float>(total()) / static_cast<Float>(divisor);
+            }
+
+            /** Sum of squared deviations from the mean; zero for fewer than two values, NaN with a non-finite one. */
+            [[nodiscard]] Float squared_deviations() const noexcept
+            {
+                if (count <= 1) { return 0.0; }
+                if (non_finite_count() != 0) { return std::numeric_limits<Float>::quiet_NaN(); }
+                const Float n  = static_cast<Float>(count);
+                const Float s1 = shifted_sum + shifted_sum_compensation;
+                const Float s2 = shifted_sum_sq + shifted_sum_sq_compensation;
+                const Float m2 = s2 - s1 * s1 / n;
+                return m2 > 0.0 ? m2 : 0.0;
+            }
+
+            /** Sample variance (ddof=1); zero for fewer than two values. */
+            [[nodiscard]] Float variance() const noexcept
+            {
+                return count <= 1 ? 0.0 : squared_deviations() / (static_cast<Float>(count) - 1.0);
+            }
+
+          private:
+            [[nodiscard]] std::size_t finite_count() const noexcept { return count - non_finite_count(); }
+
+            void reset_finite() noexcept
+            {
+                sum                         = T{};
+                sum_compensation            = T{};
+                withdrawals                 = 0;
+                shift                       = 0.0;
+                shifted_sum                 = 0.0;
+                shifted_sum_compensation    = 0.0;
+                shifted_sum_sq              = 0.0;
+                shifted_sum_sq_compensation = 0.0;
+            }
+
+            /** Count a NaN or infinite ``value`` in or out; false for a finite one. */
+            [[nodiscard]] bool tally_non_finite(T value, bool adding) noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    if (std::isfinite(value)) { return false; }
+                    std::size_t &tally = std::isnan(value) ? nan_count
+                                         : value > 0       ? positive_infinity_count
+                                                           : negative_infinity_count;
+                    if (adding) { ++tally; }
+                    else if (tally != 0) { --tally; }
+                    return true;
+                }
+                else
+                {
+                    static_cast<void>(value);
+                    static_cast<void>(adding);
+                    return false;
+                }
+            }
+
+            void accumulate(T value, T sign) noexcept
+            {
+                compensated_add(sum, sum_compensation, static_cast<T>(sign * value));
+                const Float delta = static_cast<Float>(value) - shift;
+                const Float scale = static_cast<Float>(sign);
+                compensated_add(shifted_sum, shifted_sum_compensation, scale * delta);
+                compensated_add(shifted_sum_sq, shifted_sum_sq_compensation, scale * delta * delta);
+            }
+        };
+
+        /**
+         * Multiset with O(log n) expected insert, erase and k-th smallest
+         * lookup: a treap over equal-value nodes with multiplicities, held
+         * in one vector with a free list so steady sliding reuses slots.
+         */
+        template <typename T>
+        class OrderStatisticMultiset
+        {
+          public:
+            void clear() noexcept
+            {
+                nodes_.clear();
+                free_.clear();
+                root_ = npos;
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return subtree(root_); }
+
+            void insert(T value) { root_ = insert(root_, value); }
+
+            /** Remove one occurrence; a value that is not present is ignored. */
+            void erase(T value) noexcept { root_ = erase(root_, value); }
+
+            /** The k-th smallest value (0-based); requires ``k < size()``. */
+            [[nodiscard]] T kth(std::size_t k) const noexcept
+            {
+                std::uint32_t at = root_;
+                for (;;)
+                {
+                    const Node       &node = nodes_[at];
+                    const std::size_t left = subtree(node.left);
+                    if (k < left) { at = node.left; }
+                    else if (k < left + node.multiplicity) { return node.value; }
+                    else
+                    {
+                        k -= left + node.multiplicity;
+                        at = node.right;
+                    }
+                }
+            }
+
+          private:
+            static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+            struct Node
+            {
+                T             value{};
+                std::uint32_t priority{0};
+                std::uint32_t left{npos};
+                std::uint32_t right{npos};
+                std::uint32_t multiplicity{1};
+                std::uint32_t size{1};
+            };
+
+            [[nodiscard]] std::size_t subtree(std::uint32_t at) const noexcept
+            {
+                return at == npos ? 0 : nodes_[at].size;
+            }
+
+            void refresh(std::uint32_t at) noexcept
+            {
+                Node &node = nodes_[at];
+                node.size  = static_cast<std::uint32_t>(subtree(node.left) + node.multiplicity + subtree(node.right));
+            }
+
+            [[nodiscard]] std::uint32_t next_priority() noexcept
+            {
+                // xorshift32: deterministic, and only needs to look random
+                // relative to the insertion order.
+                seed_ ^= seed_ << 13U;
+                seed_ ^= seed_ >> 17U;
+                seed_ ^= seed_ << 5U;
+                return seed_;
+            }
+
+            [[nodiscard]] std::uint32_t allocate(T value)
+            {
+                const Node node{.value        = value,
+                                .priority     = next_priority(),
+                                .left         = npos,
+                                .right        = npos,
+                                .multiplicity = 1,
+                                .size         = 1};
+                if (!free_.empty())
+                {
+                    const std::uint32_t at = free_.back();
+                    free_.pop_back();
+                    nodes_[at] = node;
+                    return at;
+                }
+                nodes_.push_back(node);
+                return static_cast<std::uint32_t>(nodes_.size() - 1);
+            }
+
+            [[nodiscard]] std::uint32_t rotate_right(std::uint32_t at) noexcept
+            {
+                const std::uint32_t pivot = nodes_[at].left;
+                nodes_[at].left           = nodes_[pivot].right;
+                nodes_[pivot].right       = at;
+                refresh(at);
+                refresh(pivot);
+                return pivot;
+            }
+
+            [[nodiscard]] std::uint32_t rotate_left(std::uint32_t at) noexcept
+            {
+                const std::uint32_t pivot = nodes_[at].right;
+                nodes_[at].right          = nodes_[pivot].left;
+                nodes_[pivot].left        = at;
+                refresh(at);
+                refresh(pivot);
+                return pivot;
+            }
+
+            [[nodiscard]] std::uint32_t insert(std::uint32_t at, T value)
+            {
+                if (at == npos) { return allocate(value); }
+                if (value == nodes_[at].value)
+                {
+                    ++nodes_[at].multiplicity;
+                    ++nodes_[at].size;
+                    return at;
+                }
+                // Indices only across the recursion: allocate may grow nodes_.
+                if (value < nodes_[at].value)
+                {
+                    const std::uint32_t child = insert(nodes_[at].left, value);
+                    nodes_[at].left           = child;
+                    refresh(at);
+                    if (nodes_[child].priority > nodes_[at].priority) { return rotate_right(at); }
+                }
+                else
+                {
+                    const std::uint32_t child = insert(nodes_[at].right, value);
+                    nodes_[at].right          = child;
+                    refresh(at);
+                    if (nodes_[child].priority > nodes_[at].priority) { return rotate_left(at); }
+                }
+                return at;
+            }
+
+            [[nodiscard]] std::uint32_t erase(std::uint32_t at, T value) noexcept
+            {
+                if (at == npos) { return npos; }
+                if (value < nodes_[at].value) { nodes_[at].left = erase(nodes_[at].left, value); }
+                else if (nodes_[at].value < value) { nodes_[at].right = erase(nodes_[at].right, value); }
+                else if (nodes_[at].multiplicity > 1) { --nodes_[at].multiplicity; }
+                else { return remove(at); }
+                refresh(at);
+                return at;
+            }
+
+            /** Rotate ``at`` down to a leaf position and unlink it. */
+            [[nodiscard]] std::uint32_t remove(std::uint32_t at) noexcept
+            {
+                const std::uint32_t left  = nodes_[at].left;
+                const std::uint32_t right = nodes_[at].right;
+                if (left == npos || right == npos)
+                {
+                    free_.push_back(at);
+                    return left == npos ? right : left;
+                }
+                if (nodes_[left].priority > nodes_[right].priority)
+                {
+                    const std::uint32_t top = rotate_right(at);
+                    nodes_[top].right       = remove(at);
+                    refresh(top);
+                    return top;
+                }
+                const std::uint32_t top = rotate_left(at);
+                nodes_[top].left        = remove(at);
+                refresh(top);
+                return top;
+            }
+
+            std::vector<Node>          nodes_{};
+            std::vector<std::uint32_t> free_{};
+            std::uint32_t              root_{npos};
+            std::uint32_t              seed_{0x9e3779b9U};
+        };
+
+        enum class QuantileMethod : std::uint8_t
+        {
+            Linear,
+            Lower,
+            Higher,
+            Nearest,
+            Midpoint,
+        };
+
+        [[nodiscard]] inline QuantileMethod quantile_method(std::string_view method)
+        {
+            if (method == "linear") { return QuantileMethod::Linear; }
+            if (method == "lower") { return QuantileMethod::Lower; }
+            if (method == "higher") { return QuantileMethod::Higher; }
+            if (method == "nearest") { return QuantileMethod::Nearest; }
+            if (method == "midpoint") { return QuantileMethod::Midpoint; }
+            throw std::invalid_argument("unsupported quantile method: " + std::string{method});
+        }
+
+        /**
+         * Quantile of the ordered values with Arrow Compute's interpolation
+         * rules (the array overloads delegate to Arrow): position
+         * ``q * (n - 1)``, ``nearest`` breaking a half-way tie towards the
+         * even index. NaN for an empty multiset.
+         */
+        template <typename T>
+        [[nodiscard]] Float quantile_of(const OrderStatisticMultiset<T> &ordered, Float q, QuantileMethod method)
+        {
+            const std::size_t count = ordered.size();
+            if (count == 0) { return std::numeric_limits<Float>::quiet_NaN(); }
+            const Float       position    = q * static_cast<Float>(count - 1);
+            const std::size_t lower_index = static_cast<std::size_t>(position);
+            const Float       fraction    = position - static_cast<Float>(lower_index);
+            const Float       lower       = static_cast<Float>(ordered.kth(lower_index));
+            if (fraction == 0.0) { return lower; }
+            const Float higher = static_cast<Float>(ordered.kth(lower_index + 1));
+            switch (method)
+            {
+                case QuantileMethod::Lower: return lower;
+                case QuantileMethod::Higher: return higher;
+                case QuantileMethod::Nearest:
+                    if (fraction < 0.5) { return lower; }
+                    if (fraction > 0.5) { return higher; }
+                    return lower_index % 2 == 0 ? lower : higher;
+                case QuantileMethod::Midpoint: return lower / 2.0 + higher / 2.0;
+                case QuantileMethod::Linear: break;
+            }
+            return (1.0 - fraction) * lower + fraction * higher;
+        }
+
+        /**
+         * Keeps a node's window kernel in step with a TSW input.
+         *
+         * The window only exposes the element its latest push evicted, which
+         * cannot replay a duration window dropping several elements in one
+         * cycle, nor cycles the node was not evaluated on (a size window
+         * below its minimum period). The timeline instead remembers the
+         * times it has folded in: window times strictly increase, so anything
+         * older than the window's oldest time has left it and anything newer
+         * than the last folded time has arrived, and a steady slide costs
+         * O(evicted + added) kernel updates. A rebind, a clear, a window that
+         * disagrees with the remembered span, or a kernel asking to re-anchor
+         * rebuilds from the full window.
+         */
+        struct WindowTimeline
+        {
+            std::deque<DateTime> times{};
+            const void          *source{nullptr};
+
+            template <typename Kernel>
+            void sync(const TSWInputView &input, Kernel &kernel)
+            {
+                const TSWDataView window  = input.data_view();
+                const void       *current = window.base().data();
+                const std::size_t size    = window.size();
+                if (current == source && size > 0 && !window.cleared(input.evaluation_time()) &&
+                    !kernel.needs_rebuild())
+                {
+                    const DateTime oldest = window.time_at(0);
+                    while (!times.empty() && times.front() < oldest)
+                    {
+                        kernel.evict(times.front());
+                        times.pop_front();
+                    }
+                    std::size_t first_new = times.empty() ? 0 : size;
+                    while (first_new > 0 && window.time_at(first_new - 1) > times.back()) { --first_new; }
+                    if (times.size() == first_new && (times.empty() || times.front() == oldest))
+                    {
+                        append(window, first_new, kernel);
+                        return;
+                    }
+                }
+                source = current;
+                times.clear();
+                kernel.clear();
+                append(window, 0, kernel);
+            }
+
+          private:
+            template <typename Kernel>
+            void append(const TSWDataView &window, std::size_t first, Kernel &kernel)
+            {
+                for (std::size_t index = first; index < window.size(); ++index)
+                {
+                    const DateTime time = window.time_at(index);
+                    times.push_back(time);
+                    kernel.push(time, window.at(index));
+                }
+            }
+        };
+
+        /** Sum / mean / variance over the window: running moments plus the values to withdraw. */
+        template <typename T>
+        struct WindowMomentsKernel
+        {
+            IncrementalMoments<T> moments{};
+            std::deque<T>         values{};
+
+            void clear() noexcept
+            {
+                moments.reset();
+                values.clear();
+            }
+
+            void push(DateTime, const ValueView &value)
+            {
+                const T contribution = value.checked_as<T>();
+                values.push_back(contribution);
+                moments.add(contribution);
+            }
+
+            void evict(DateTime) noexcept
+            {
+                moments.remove(values.front());
+                values.pop_front();
+            }
+
+            [[nodiscard]] bool needs_rebuild() const noexcept { return moments.needs_reanchor(); }
+        };
+
+        /**
+         * min_/max_ over the window: a monotonic deque of candidates, so the
+         * front is the oldest of the best values in the window. Erased via
+         * ``Value::compare``; while an element that does not order against
+         * itself (NaN) is in the window the candidates are not a total
+         * order, so ``best`` is only meaningful when ``ordered()``.
+         */
+        template <bool Min>
+        struct WindowExtremumKernel
+        {
+            std::deque<std::pair<DateTime, Value>> candidates{};
+            std::deque<DateTime>                   unordered{};
+
+            void clear() noexcept
+            {
+                candidates.clear();
+                unordered.clear();
+            }
+
+            void push(DateTime time, const ValueView &value)
+            {
+                if (value.compare(value) != std::partial_ordering::equivalent)
+                {
+                    unordered.push_back(time);
+                    return;
+                }
+                while (!candidates.empty() && better(value, candidates.back().second.view())) { candidates.pop_back(); }
+                candidates.emplace_back(time, Value{value});
+            }
+
+            void evict(DateTime time) noexcept
+            {
+                if (!candidates.empty() && candidates.front().first == time) { candidates.pop_front(); }
+                if (!unordered.empty() && unordered.front() == time) { unordered.pop_front(); }
+            }
+
+            [[nodiscard]] bool needs_rebuild() const noexcept { return false; }
+
+            [[nodiscard]] bool ordered() const noexcept { return unordered.empty(); }
+
+            [[nodiscard]] ValueView best() const { return candidates.front().second.view(); }
+
+            [[nodiscard]] static bool better(const ValueView &value, const ValueView &than)
+            {
+                return value.compare(than) == (Min ? std::partial_ordering::less : std::partial_ordering::greater);
+            }
+        };
+
+        /** Quantiles over the window; NaN elements are skipped, as Arrow's quantile does. */
+        template <typename T>
+        struct WindowQuantileKernel
+        {
+            OrderStatisticMultiset<T> ordered{};
+            std::deque<T>             values{};
+
+            void clear() noexcept
+            {
+                ordered.clear();
+                values.clear();
+            }
+
+            void push(DateTime, const ValueView &value)
+            {
+                const T element = value.checked_as<T>();
+                values.push_back(element);
+                if (!is_nan(element)) { ordered.insert(element); }
+            }
+
+            void evict(DateTime) noexcept
+            {
+                if (!is_nan(values.front())) { ordered.erase(values.front()); }
+                values.pop_front();
+            }
+
+            [[nodiscard]] bool needs_rebuild() const noexcept { return false; }
+        };
+
+        template <typename Kernel>
+        struct WindowKernelState
+        {
+            WindowTimeline timeline{};
+            Kernel         kernel{};
+
+            /** Fold the window's changes since the last evaluation into the kernel. */
+            Kernel &sync(const TSWInputView &input)
+            {
+                timeline.sync(input, kernel);
+                return kernel;
+            }
+        };
+
+        template <typename T>
+        using WindowMomentsState = WindowKernelState<WindowMomentsKernel<T>>;
+
+        template <bool Min>
+        using WindowExtremumState = WindowKernelState<WindowExtremumKernel<Min>>;
+
+        template <typename T>
+        using WindowQuantileState = WindowKernelState<WindowQuantileKernel<T>>;
+    }  // namespace incremental_kernel_detail
+}  // namespace hgraph::stdlib
+
+namespace hgraph::static_schema_detail
+{
+    template <typename T>
+    struct scalar_name<stdlib::incremental_kernel_detail::WindowMomentsState<T>>
+    {
+        static constexpr std::string_view value{std::same_as<T, Int> ? "stdlib.window_moments_state.int"
+                                                                      : "stdlib.window_moments_state.float"};
+    };
+
+    template <bool Min>
+    struct scalar_name<stdlib::incremental_kernel_detail::WindowExtremumState<Min>>
+    {
+        static constexpr std::string_view value{Min ? "stdlib.window_min_state" : "stdlib.window_max_state"};
+    };
+
+    template <typename T>
+    struct scalar_name<stdlib::incremental_kernel_detail::WindowQuantileState<T>>
+    {
+        static constexpr std::string_view value{std::same_as<T, Int> ? "stdlib.window_quantile_state.int"
+                                                                      : "stdlib.window_quantile_state.float"};
+    };
+}  // namespace hgraph::static_schema_detail
+
+#endif  // HGRAPH_LIB_STD_INCREMENTAL_KERNELS_H
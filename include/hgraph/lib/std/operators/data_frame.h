@@ -37,6 +37,45 @@ namespace hgraph::stdlib
     {
     };
 
+    /**
+     * ``from_arrow_stream[OUT](path, dt_col="date", key_col="key",
+     * value_col="value", offset=0)`` — ``from_data_frame`` over a local
+     * Arrow IPC stream file, decoded one record batch at a time with the
+     * next batch read ahead in the background. At most two batches are
+     * resident, however long the file. Rows must be in date order across
+     * batches.
+     */
+    struct from_arrow_stream
+        : Operator<"from_arrow_stream", Scalar<"path", Str>, Scalar<"dt_col", Str>,
+                   Scalar<"key_col", Str>, Scalar<"value_col", Str>,
+                   Scalar<"offset", TimeDelta>, Out<TsVar<"O">>>
+    {
+    };
+
+    /** ``from_parquet[OUT](path, ...)`` — ``from_arrow_stream`` over a local
+        Parquet file, read row group by row group (requires a build with
+        ``HGRAPH_WITH_PARQUET``). */
+    struct from_parquet
+        : Operator<"from_parquet", Scalar<"path", Str>, Scalar<"dt_col", Str>,
+                   Scalar<"key_col", Str>, Scalar<"value_col", Str>,
+                   Scalar<"offset", TimeDelta>, Out<TsVar<"O">>>
+    {
+    };
+
+    /**
+     * ``to_arrow_stream(ts, path, dt_col="date", batch_rows=65536,
+     * flush_interval=0)`` — a sink appending one ``[dt_col, as_of,
+     * *columns]`` row per tick to a local Arrow IPC stream file. A record
+     * batch is flushed every ``batch_rows`` rows, or once the buffered rows
+     * span ``flush_interval`` (zero = size only). The file reads back with
+     * ``from_arrow_stream``.
+     */
+    struct to_arrow_stream
+        : Operator<"to_arrow_stream", In<"ts", TsVar<"S">>, Scalar<"path", Str>, Scalar<"dt_col", Str>,
+                   Scalar<"batch_rows", Int>, Scalar<"flush_interval", TimeDelta>>
+    {
+    };
+
     /** Replay a canonical bitemporal table frame through the native table
         protocol, selecting the latest as-of revision per partition. */
     struct replay_data_frame
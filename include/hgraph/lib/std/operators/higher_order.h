@@ -92,6 +92,8 @@ namespace hgraph::stdlib
         std::optional<WiredFn>  default_branch{};
         /** Rebuild the active branch on EVERY key tick, not just a key change (Python ``reload_on_ticked``). */
         bool reload_on_ticked{false};
+        /** Keep up to this many stopped branch graphs for re-selection (see ``SwitchNodeSpec::branch_cache_size``). */
+        std::size_t branch_cache_size{0};
 
         [[nodiscard]] SwitchCases &&reload(bool value = true) &&
         {
@@ -99,10 +101,16 @@ namespace hgraph::stdlib
             return std::move(*this);
         }
 
+        [[nodiscard]] SwitchCases &&cache(std::size_t size) &&
+        {
+            branch_cache_size = size;
+            return std::move(*this);
+        }
+
         [[nodiscard]] bool operator==(const SwitchCases &other) const
         {
             return cases == other.cases && default_branch == other.default_branch &&
-                   reload_on_ticked == other.reload_on_ticked;
+                   reload_on_ticked == other.reload_on_ticked && branch_cache_size == other.branch_cache_size;
         }
     };
 
@@ -128,7 +136,9 @@ namespace hgraph::stdlib
      * - a branch may take the key as its first argument when that parameter is
      *   named ``key``;
      * - the time-series arguments are variadic (``*ts``): branches bind them
-     *   positionally, optionally preceded by the key.
+     *   positionally, optionally preceded by the key;
+     * - ``switch_cases(...).cache(n)`` keeps the last ``n`` stopped branches, so
+     *   a key that flaps back resets its cached graph instead of rebuilding it.
      */
     struct switch_ : Operator<"switch_",
                               In<"key", TS<ScalarVar<"K">>>,
@@ -301,6 +311,14 @@ namespace hgraph::stdlib
      *   key-set inference (Python's wrappers, as wiring-time port tags);
      * - outputless functions use ``map_sink_`` from C++. They share the same
      *   keyed/indexed child lifecycle but do not allocate a parent output.
+     * - ``arg<"__parallel__">(Bool{true})`` opts a TSD map into evaluating the
+     *   children due in a cycle concurrently on a shared worker pool, joined
+     *   before the output is published. Only for children that share no
+     *   state between keys; see ``MapNodeSpec::parallel_children``.
+     * - ``arg<"__recycle__">(Int{n})`` (``map_`` and ``mesh_`` over TSDs)
+     *   keeps up to ``n`` stopped child graphs of removed keys, reset in
+     *   place, for keys created later in the same slots; see
+     *   ``MapNodeSpec::recycle_child_graphs``.
      *
      * Dynamic-TSL children currently require an ordinary owned whole-node
      * terminal output. Pass-through and already-forwarding child outputs are
@@ -340,11 +358,16 @@ namespace hgraph::stdlib
         Str                       key_arg{};
         Str                       mesh_name{};
         std::vector<std::uint8_t> arg_tags{};
+        /** ``__parallel__``: evaluate due TSD children on the child-evaluation pool. */
+        Bool                      parallel{false};
+        /** ``__recycle__``: high-water mark of stopped child graphs kept for reuse. */
+        Int                       recycle{0};
 
         [[nodiscard]] bool operator==(const MapCallConfig &other) const
         {
             return func == other.func && key_arg == other.key_arg &&
-                   mesh_name == other.mesh_name && arg_tags == other.arg_tags;
+                   mesh_name == other.mesh_name && arg_tags == other.arg_tags &&
+                   parallel == other.parallel && recycle == other.recycle;
         }
     };
 
@@ -417,6 +440,8 @@ struct std::hash<hgraph::stdlib::MapCallConfig>
         combine(std::hash<std::string>{}(config.key_arg));
         combine(std::hash<std::string>{}(config.mesh_name));
         for (const std::uint8_t tag : config.arg_tags) { combine(tag); }
+        combine(std::hash<bool>{}(config.parallel));
+        combine(std::hash<hgraph::Int>{}(config.recycle));
         return h;
     }
 };
@@ -448,6 +473,7 @@ struct std::hash<hgraph::stdlib::SwitchCases>
         }
         if (cases.default_branch.has_value()) { combine(std::hash<hgraph::WiredFn>{}(*cases.default_branch)); }
         combine(cases.reload_on_ticked ? 1 : 0);
+        combine(cases.branch_cache_size);
         return h;
     }
 };
@@ -11,6 +11,7 @@
  */
 
 #include <functional>
+#include <hgraph/lib/std/incremental_kernels.h>
 #include <hgraph/lib/std/lifted_kernels.h>
 #include <hgraph/lib/std/operators/arithmetic.h>
 #include <hgraph/lib/std/operators/collection.h>
@@ -29,12 +30,16 @@
 
 #include <ankerl/unordered_dense.h>
 
+#include <algorithm>
 #include <compare>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <optional>
 #include <stdexcept>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -485,303 +490,250 @@ namespace hgraph::stdlib
             }
         };
 
-        template <typename T>
-        struct sum_tss_unary
+        enum class CollectionAggregate : std::uint8_t
         {
-            static constexpr auto name = "sum_tss_unary";
-            static constexpr bool schedule_on_start = true;
-
-            static void eval(In<"ts", TSS<T>, InputValidity::Unchecked> ts, Out<TS<T>> out)
-            {
-                T total{};
-                for (const T &key : ts.values()) { total += key; }
-                out.set(total);
-            }
+            Sum,
+            Mean,
+            Var,
+            Std,
         };
 
-        template <typename T, auto N>
-        [[nodiscard]] inline std::tuple<Float, std::size_t, std::size_t> tsl_sum_valid_and_size(
-            const In<"ts", TSL<TS<T>, N>, InputValidity::Unchecked> &ts)
-        {
-            Float       total       = 0.0;
-            std::size_t valid_count = 0;
-            const auto  size        = ts.size();
-            for (std::size_t i = 0; i < size; ++i)
-            {
-                auto child = ts[i];
-                if (!child.valid()) { continue; }
-                total += static_cast<Float>(child.value());
-                ++valid_count;
-            }
-            return {total, valid_count, size};
-        }
+        using incremental_kernel_detail::IncrementalMoments;
 
+        /** Per-position contributions for the keyed (TSD) and indexed (TSL) aggregates. */
         template <typename T>
-        struct sum_tsl_unary
+        struct SlotContributions
         {
-            static constexpr auto name = "sum_tsl_unary";
-            static constexpr bool schedule_on_start = true;
+            std::vector<T>            value{};
+            std::vector<std::uint8_t> present{};
 
-            static void eval(In<"ts", TSL<TS<T>, SIZE<"N">>, InputValidity::Unchecked> ts, Out<TS<T>> out)
+            void clear() noexcept
             {
-                T total{};
-                for (std::size_t i = 0; i < ts.size(); ++i)
+                value.clear();
+                present.clear();
+            }
+
+            void contribute(IncrementalMoments<T> &moments, std::size_t slot, T contribution)
+            {
+                if (slot >= present.size())
                 {
-                    auto child = ts[i];
-                    if (child.valid()) { total += child.value(); }
+                    value.resize(slot + 1);
+                    present.resize(slot + 1, 0);
                 }
-                out.set(total);
+                value[slot]   = contribution;
+                present[slot] = 1;
+                moments.add(contribution);
             }
-        };
-
-        template <typename T>
-        struct mean_tsl_unary
-        {
-            static constexpr auto name = "mean_tsl_unary";
-            static constexpr bool schedule_on_start = true;
 
-            static void eval(In<"ts", TSL<TS<T>, SIZE<"N">>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
+            void withdraw(IncrementalMoments<T> &moments, std::size_t slot) noexcept
             {
-                const auto [total, _, size] = tsl_sum_valid_and_size(ts);
-                static_cast<void>(_);
-                out.set(size == 0 ? std::numeric_limits<Float>::quiet_NaN()
-                                  : total / static_cast<Float>(size));
+                if (slot >= present.size() || present[slot] == 0) { return; }
+                present[slot] = 0;
+                moments.remove(value[slot]);
             }
         };
 
+        /**
+         * Node state of the incremental collection aggregates. ``source`` is
+         * the collection data the state was built from: a rebind (including
+         * the transition cycle of a re-pointed reference) changes it, and the
+         * next evaluation falls back to a full rescan.
+         */
         template <typename T>
-        struct var_tsl_unary
+        struct CollectionAggregateState
         {
-            static constexpr auto name = "var_tsl_unary";
-            static constexpr bool schedule_on_start = true;
+            IncrementalMoments<T> moments{};
+            SlotContributions<T>  slots{};
+            const void           *source{nullptr};
+            bool                  primed{false};
 
-            static void eval(In<"ts", TSL<TS<T>, SIZE<"N">>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
+            [[nodiscard]] bool incremental(const void *current) const noexcept
             {
-                const auto [total, valid_count, _] = tsl_sum_valid_and_size(ts);
-                static_cast<void>(_);
-                if (valid_count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
+                return primed && current == source && !moments.needs_reanchor();
+            }
 
-                const Float mean_value = total / static_cast<Float>(valid_count);
-                Float       sum_sq     = 0.0;
-                for (std::size_t i = 0; i < ts.size(); ++i)
-                {
-                    auto child = ts[i];
-                    if (!child.valid()) { continue; }
-                    const Float delta = static_cast<Float>(child.value()) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(sum_sq / static_cast<Float>(valid_count - 1));
+            void restart(const void *current) noexcept
+            {
+                moments.reset();
+                slots.clear();
+                source = current;
+                primed = true;
             }
         };
 
-        template <typename T>
-        struct std_tsl_unary
+        template <CollectionAggregate Op, typename T, typename TOut>
+        inline void publish_collection_aggregate(const IncrementalMoments<T> &moments, std::size_t mean_divisor,
+                                                 const TOut &out)
         {
-            static constexpr auto name = "std_tsl_unary";
-            static constexpr bool schedule_on_start = true;
-
-            static void eval(In<"ts", TSL<TS<T>, SIZE<"N">>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
-            {
-                const auto [total, valid_count, _] = tsl_sum_valid_and_size(ts);
-                static_cast<void>(_);
-                if (valid_count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
+            if constexpr (Op == CollectionAggregate::Sum) { out.set(moments.total()); }
+            else if constexpr (Op == CollectionAggregate::Mean) { out.set(moments.mean(mean_divisor)); }
+            else if constexpr (Op == CollectionAggregate::Var) { out.set(moments.variance()); }
+            else { out.set(std::sqrt(moments.variance())); }
+        }
 
-                const Float mean_value = total / static_cast<Float>(valid_count);
-                Float       sum_sq     = 0.0;
-                for (std::size_t i = 0; i < ts.size(); ++i)
-                {
-                    auto child = ts[i];
-                    if (!child.valid()) { continue; }
-                    const Float delta = static_cast<Float>(child.value()) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(std::sqrt(sum_sq / static_cast<Float>(valid_count - 1)));
-            }
-        };
+        template <CollectionAggregate Op, typename T>
+        using collection_aggregate_output_t = std::conditional_t<Op == CollectionAggregate::Sum, T, Float>;
 
-        template <typename T>
-        [[nodiscard]] inline std::pair<Float, std::size_t> tss_sum_and_count(
-            const In<"ts", TSS<T>, InputValidity::Unchecked> &ts)
+        /** Fold this cycle's added/removed elements into the running moments. */
+        template <typename T, typename TInput>
+        inline const IncrementalMoments<T> &update_tss_aggregate(const TInput &ts, CollectionAggregateState<T> &state)
         {
-            Float       total = 0.0;
-            std::size_t count = 0;
-            for (const T &key : ts.values())
+            const TSSInputView &set    = ts;
+            const void         *source = set.data_view().base().data();
+            if (!state.incremental(source))
             {
-                total += static_cast<Float>(key);
-                ++count;
+                state.restart(source);
+                for (const ValueView &key : set.values()) { state.moments.add(key.checked_as<T>()); }
+                return state.moments;
             }
-            return {total, count};
+            if (!set.modified()) { return state.moments; }
+            for (const ValueView &key : set.removed()) { state.moments.remove(key.checked_as<T>()); }
+            for (const ValueView &key : set.added()) { state.moments.add(key.checked_as<T>()); }
+            return state.moments;
         }
 
-        template <typename T>
-        struct mean_tss_unary
+        /** Fold this cycle's removed and modified slots into the running moments. */
+        template <typename T, typename TInput>
+        inline const IncrementalMoments<T> &update_tsd_aggregate(const TInput &ts, CollectionAggregateState<T> &state)
         {
-            static constexpr auto name = "mean_tss_unary";
-            static constexpr bool schedule_on_start = true;
+            const TSDInputView &dict   = ts;
+            const auto          data   = dict.data_view();
+            const void         *source = data.base().data();
+            const auto contribute_slot = [&](std::size_t slot) {
+                if (!dict.slot_live(slot)) { return; }
+                const TSInputView child = dict.at_slot(slot);
+                if (child.valid()) { state.slots.contribute(state.moments, slot, child.value().checked_as<T>()); }
+            };
 
-            static void eval(In<"ts", TSS<T>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
+            if (!state.incremental(source))
             {
-                const auto [total, count] = tss_sum_and_count(ts);
-                out.set(count == 0 ? std::numeric_limits<Float>::quiet_NaN() : total / static_cast<Float>(count));
+                state.restart(source);
+                for (std::size_t slot = 0; slot < dict.slot_capacity(); ++slot) { contribute_slot(slot); }
+                return state.moments;
             }
-        };
-
-        template <typename T>
-        struct var_tss_unary
-        {
-            static constexpr auto name = "var_tss_unary";
-            static constexpr bool schedule_on_start = true;
-
-            static void eval(In<"ts", TSS<T>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
+            if (!dict.modified()) { return state.moments; }
+            for (std::size_t slot = data.next_removed_slot(); slot != TS_DATA_NO_CHILD_ID;
+                 slot = data.next_removed_slot(slot))
             {
-                const auto [total, count] = tss_sum_and_count(ts);
-                if (count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
-
-                const Float mean_value = total / static_cast<Float>(count);
-                Float       sum_sq     = 0.0;
-                for (const T &key : ts.values())
-                {
-                    const Float delta = static_cast<Float>(key) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(sum_sq / static_cast<Float>(count - 1));
+                state.slots.withdraw(state.moments, slot);
             }
-        };
-
-        template <typename T>
-        struct std_tss_unary
-        {
-            static constexpr auto name = "std_tss_unary";
-            static constexpr bool schedule_on_start = true;
-
-            static void eval(In<"ts", TSS<T>, InputValidity::Unchecked> ts, Out<TS<Float>> out)
+            for (std::size_t slot = data.next_modified_slot(); slot != TS_DATA_NO_CHILD_ID;
+                 slot = data.next_modified_slot(slot))
             {
-                const auto [total, count] = tss_sum_and_count(ts);
-                if (count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
-
-                const Float mean_value = total / static_cast<Float>(count);
-                Float       sum_sq     = 0.0;
-                for (const T &key : ts.values())
-                {
-                    const Float delta = static_cast<Float>(key) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(std::sqrt(sum_sq / static_cast<Float>(count - 1)));
+                state.slots.withdraw(state.moments, slot);
+                contribute_slot(slot);
             }
-        };
+            return state.moments;
+        }
 
-        template <typename T>
-        struct sum_tsd_unary
+        /** Fold this cycle's modified elements into the running moments. */
+        template <typename T, typename TInput>
+        inline const IncrementalMoments<T> &update_tsl_aggregate(const TInput &ts, CollectionAggregateState<T> &state)
         {
-            static constexpr auto name = "sum_tsd_unary";
-            static constexpr bool schedule_on_start = true;
+            const TSLInputView &list   = ts;
+            const void         *source = list.data_view().base().data();
+            const auto contribute_index = [&](std::size_t index, const TSInputView &child) {
+                if (child.valid()) { state.slots.contribute(state.moments, index, child.value().checked_as<T>()); }
+            };
 
-            static void eval(In<"ts", TSD<ScalarVar<"K">, TS<T>>, InputValidity::Unchecked> ts, Out<TS<T>> out)
+            if (!state.incremental(source))
             {
-                T total{};
-                for (const auto child : ts.valid_values()) { total += child.value(); }
-                out.set(total);
+                state.restart(source);
+                for (auto [index, child] : list.items()) { contribute_index(index, child); }
+                return state.moments;
             }
-        };
-
-        template <typename T>
-        [[nodiscard]] inline std::pair<Float, std::size_t> tsd_sum_and_count(
-            const In<"ts", TSD<ScalarVar<"K">, TS<T>>, InputValidity::Unchecked> &ts)
-        {
-            Float       total = 0.0;
-            std::size_t count = 0;
-            for (const auto child : ts.valid_values())
+            if (!list.modified()) { return state.moments; }
+            for (auto [index, child] : list.modified_items())
             {
-                total += static_cast<Float>(child.value());
-                ++count;
+                state.slots.withdraw(state.moments, index);
+                contribute_index(index, child);
             }
-            return {total, count};
+            return state.moments;
         }
 
-        template <typename T>
-        struct mean_tsd_unary
+        /**
+         * sum_/mean/var_/std_ over a ``TSS`` of numbers. Running state is
+         * updated from ``added``/``removed``; the first evaluation and any
+         * rebind rescan the set.
+         */
+        template <CollectionAggregate Op, typename T>
+        struct tss_aggregate_unary
         {
-            static constexpr auto name = "mean_tsd_unary";
+            static constexpr auto name = Op == CollectionAggregate::Sum    ? "sum_tss_unary"
+                                         : Op == CollectionAggregate::Mean ? "mean_tss_unary"
+                                         : Op == CollectionAggregate::Var  ? "var_tss_unary"
+                                                                           : "std_tss_unary";
             static constexpr bool schedule_on_start = true;
 
-            static void eval(In<"ts", TSD<ScalarVar<"K">, TS<T>>, InputValidity::Unchecked> ts,
-                             Out<TS<Float>> out)
+            static void eval(In<"ts", TSS<T>, InputValidity::Unchecked> ts,
+                             State<CollectionAggregateState<T>> state,
+                             Out<TS<collection_aggregate_output_t<Op, T>>> out)
             {
-                const auto [total, count] = tsd_sum_and_count(ts);
-                out.set(count == 0 ? std::numeric_limits<Float>::quiet_NaN() : total / static_cast<Float>(count));
+                const auto &moments = update_tss_aggregate(ts, state.mutable_value());
+                publish_collection_aggregate<Op>(moments, moments.count, out);
             }
         };
 
-        template <typename T>
-        struct var_tsd_unary
+        /**
+         * sum_/mean/var_/std_ over the valid values of a ``TSD[K, TS[T]]``.
+         * Each slot's contribution is retained so a cycle only visits the
+         * removed and modified slots; the first evaluation and any rebind
+         * rescan every slot.
+         */
+        template <CollectionAggregate Op, typename T>
+        struct tsd_aggregate_unary
         {
-            static constexpr auto name = "var_tsd_unary";
+            static constexpr auto name = Op == CollectionAggregate::Sum    ? "sum_tsd_unary"
+                                         : Op == CollectionAggregate::Mean ? "mean_tsd_unary"
+                                         : Op == CollectionAggregate::Var  ? "var_tsd_unary"
+                                                                           : "std_tsd_unary";
             static constexpr bool schedule_on_start = true;
 
             static void eval(In<"ts", TSD<ScalarVar<"K">, TS<T>>, InputValidity::Unchecked> ts,
-                             Out<TS<Float>> out)
+                             State<CollectionAggregateState<T>> state,
+                             Out<TS<collection_aggregate_output_t<Op, T>>> out)
             {
-                const auto [total, count] = tsd_sum_and_count(ts);
-                if (count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
-
-                const Float mean_value = total / static_cast<Float>(count);
-                Float       sum_sq     = 0.0;
-                for (const auto child : ts.valid_values())
-                {
-                    const Float delta = static_cast<Float>(child.value()) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(sum_sq / static_cast<Float>(count - 1));
+                const auto &moments = update_tsd_aggregate(ts, state.mutable_value());
+                publish_collection_aggregate<Op>(moments, moments.count, out);
             }
         };
 
-        template <typename T>
-        struct std_tsd_unary
+        /**
+         * sum_/mean/var_/std_ over the valid elements of a ``TSL[TS[T], N]``,
+         * updated from ``modified_items``. ``mean`` divides by the list size
+         * (invalid elements count as absent values), matching hgraph.
+         */
+        template <CollectionAggregate Op, typename T>
+        struct tsl_aggregate_unary
         {
-            static constexpr auto name = "std_tsd_unary";
+            static constexpr auto name = Op == CollectionAggregate::Sum    ? "sum_tsl_unary"
+                                         : Op == CollectionAggregate::Mean ? "mean_tsl_unary"
+                                         : Op == CollectionAggregate::Var  ? "var_tsl_unary"
+                                                                           : "std_tsl_unary";
             static constexpr bool schedule_on_start = true;
 
-            static void eval(In<"ts", TSD<ScalarVar<"K">, TS<T>>, InputValidity::Unchecked> ts,
-                             Out<TS<Float>> out)
+            static void eval(In<"ts", TSL<TS<T>, SIZE<"N">>, InputValidity::Unchecked> ts,
+                             State<CollectionAggregateState<T>> state,
+                             Out<TS<collection_aggregate_output_t<Op, T>>> out)
             {
-                const auto [total, count] = tsd_sum_and_count(ts);
-                if (count <= 1)
-                {
-                    out.set(0.0);
-                    return;
-                }
-
-                const Float mean_value = total / static_cast<Float>(count);
-                Float       sum_sq     = 0.0;
-                for (const auto child : ts.valid_values())
-                {
-                    const Float delta = static_cast<Float>(child.value()) - mean_value;
-                    sum_sq += delta * delta;
-                }
-                out.set(std::sqrt(sum_sq / static_cast<Float>(count - 1)));
+                const auto &moments = update_tsl_aggregate(ts, state.mutable_value());
+                publish_collection_aggregate<Op>(moments, ts.size(), out);
             }
         };
 
+        template <typename T> using sum_tss_unary  = tss_aggregate_unary<CollectionAggregate::Sum, T>;
+        template <typename T> using mean_tss_unary = tss_aggregate_unary<CollectionAggregate::Mean, T>;
+        template <typename T> using var_tss_unary  = tss_aggregate_unary<CollectionAggregate::Var, T>;
+        template <typename T> using std_tss_unary  = tss_aggregate_unary<CollectionAggregate::Std, T>;
+        template <typename T> using sum_tsd_unary  = tsd_aggregate_unary<CollectionAggregate::Sum, T>;
+        template <typename T> using mean_tsd_unary = tsd_aggregate_unary<CollectionAggregate::Mean, T>;
+        template <typename T> using var_tsd_unary  = tsd_aggregate_unary<CollectionAggregate::Var, T>;
+        template <typename T> using std_tsd_unary  = tsd_aggregate_unary<CollectionAggregate::Std, T>;
+        template <typename T> using sum_tsl_unary  = tsl_aggregate_unary<CollectionAggregate::Sum, T>;
+        template <typename T> using mean_tsl_unary = tsl_aggregate_unary<CollectionAggregate::Mean, T>;
+        template <typename T> using var_tsl_unary  = tsl_aggregate_unary<CollectionAggregate::Var, T>;
+        template <typename T> using std_tsl_unary  = tsl_aggregate_unary<CollectionAggregate::Std, T>;
+
         /**
          * Binary TSS union — the fold step. Removal semantics mirror Python's
          * ``union_multiple_tss``: an element leaves the union only when no
@@ -3822,4 +3774,14 @@ namespace hgraph::stdlib
     void register_collection_operators();
 }  // namespace hgraph::stdlib
 
+namespace hgraph::static_schema_detail
+{
+    template <typename T>
+    struct scalar_name<stdlib::collection_impl_detail::CollectionAggregateState<T>>
+    {
+        static constexpr std::string_view value{std::same_as<T, Int> ? "stdlib.collection_aggregate_state.int"
+                                                                      : "stdlib.collection_aggregate_state.float"};
+    };
+}  // namespace hgraph::static_schema_detail
+
 #endif  // HGRAPH_LIB_STD_OPERATORS_IMPL_COLLECTION_IMPL_H
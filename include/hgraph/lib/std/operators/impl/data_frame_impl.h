@@ -6,10 +6,13 @@
 #include <hgraph/runtime/node_scheduler.h>
 #include <hgraph/types/operator_dispatch.h>
 #include <hgraph/types/operator_type_resolution.h>
+#include <hgraph/types/record_replay.h>
 #include <hgraph/types/static_node.h>
 #include <hgraph/types/time_series/ts_delta.h>
 #include <hgraph/types/value/table_codec.h>
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -111,6 +114,27 @@ namespace hgraph::stdlib
                              const TSOutputView &out, FromFramePlan *&plan_out);
         void eval_from_frame(FromFramePlan &plan, DateTime now, NodeScheduler &sched,
                              const TSOutputView &out);
+        /** The (offset) time of the plan's next unread row; empty once the frame is consumed. */
+        [[nodiscard]] std::optional<DateTime> next_from_frame_time(const FromFramePlan &plan);
+
+        /** The file formats read by the streaming frame sources. */
+        enum class FrameFileFormat : unsigned char { ArrowStream, Parquet };
+
+        /**
+         * Streaming ``from_data_frame`` state: the file's record-batch
+         * reader, the batch being read ahead, and the ``FromFramePlan`` over
+         * the batch under the cursor. Arrow internals stay in the
+         * translation unit; release through ``release_stream_source``.
+         */
+        struct FrameStreamSource;
+
+        void start_from_stream(FrameFileFormat format, std::string_view path, std::string_view dt_col,
+                               std::string_view key_col, std::string_view value_col, TimeDelta offset,
+                               DateTime start_time, const TSOutputView &out, SingleShotScheduler &sched,
+                               FrameStreamSource *&source_out);
+        void eval_from_stream(FrameStreamSource &source, DateTime now, NodeScheduler &sched,
+                              const TSOutputView &out);
+        void release_stream_source(FrameStreamSource *source) noexcept;
 
         void start_replay_data_frame(const Frame &frame, DateTime as_of_time,
                                      DateTime start_time, GlobalStateView gs,
@@ -182,6 +206,16 @@ namespace hgraph::stdlib
         data_frame_detail::FromFramePlan *handle{nullptr};
     };
 
+    struct FromFrameStreamState
+    {
+        data_frame_detail::FrameStreamSource *handle{nullptr};
+    };
+
+    struct ToArrowStreamState
+    {
+        FrameStreamWriter *handle{nullptr};
+    };
+
     struct ReplayDataFrameState
     {
         data_frame_detail::ReplayDataFramePlan *handle{nullptr};
@@ -220,6 +254,18 @@ namespace hgraph::static_schema_detail
         static constexpr std::string_view value{"FromDataFrameBatchesState"};
     };
 
+    template <>
+    struct scalar_name<stdlib::FromFrameStreamState>
+    {
+        static constexpr std::string_view value{"FromFrameStreamState"};
+    };
+
+    template <>
+    struct scalar_name<stdlib::ToArrowStreamState>
+    {
+        static constexpr std::string_view value{"ToArrowStreamState"};
+    };
+
     template <>
     struct scalar_name<stdlib::GroupByState>
     {
@@ -339,6 +385,109 @@ namespace hgraph::stdlib
         }
     };
 
+    /** ``from_arrow_stream`` / ``from_parquet`` — ``from_data_frame`` read
+        from a local file one record batch at a time. */
+    template <data_frame_detail::FrameFileFormat Format>
+    struct from_frame_file_impl_base
+    {
+        static constexpr auto name =
+            Format == data_frame_detail::FrameFileFormat::Parquet ? "from_parquet" : "from_arrow_stream";
+
+        static std::vector<std::pair<std::string_view, Value>> defaults()
+        {
+            return {{"dt_col", Value{Str{"date"}}},
+                    {"key_col", Value{Str{"key"}}},
+                    {"value_col", Value{Str{"value"}}},
+                    {"offset", Value{TimeDelta{0}}}};
+        }
+
+        static void start(Scalar<"path", Str> path, Scalar<"dt_col", Str> dt_col,
+                          Scalar<"key_col", Str> key_col, Scalar<"value_col", Str> value_col,
+                          Scalar<"offset", TimeDelta> offset, DateTime now,
+                          SingleShotScheduler sched,
+                          State<FromFrameStreamState> state, Out<TsVar<"O">> out)
+        {
+            data_frame_detail::FrameStreamSource *source = nullptr;
+            data_frame_detail::start_from_stream(Format, path.value(), dt_col.value(), key_col.value(),
+                                                 value_col.value(), offset.value(), now,
+                                                 static_cast<const TSOutputView &>(out), sched, source);
+            state.set(FromFrameStreamState{source});   // owned by node State until stop
+        }
+
+        static void eval(Scalar<"path", Str> path, Scalar<"dt_col", Str> dt_col,
+                         Scalar<"key_col", Str> key_col, Scalar<"value_col", Str> value_col,
+                         Scalar<"offset", TimeDelta> offset, State<FromFrameStreamState> state,
+                         NodeScheduler sched, DateTime now, Out<TsVar<"O">> out)
+        {
+            static_cast<void>(path);
+            static_cast<void>(dt_col);
+            static_cast<void>(key_col);
+            static_cast<void>(value_col);
+            static_cast<void>(offset);
+            data_frame_detail::eval_from_stream(*state.get().handle, now, sched,
+                                                static_cast<const TSOutputView &>(out));
+        }
+
+        static void stop(State<FromFrameStreamState> state)
+        {
+            data_frame_detail::release_stream_source(state.get().handle);
+            state.set(FromFrameStreamState{});
+        }
+    };
+
+    using from_arrow_stream_impl = from_frame_file_impl_base<data_frame_detail::FrameFileFormat::ArrowStream>;
+    using from_parquet_impl      = from_frame_file_impl_base<data_frame_detail::FrameFileFormat::Parquet>;
+
+    /** ``to_arrow_stream(ts, path, ...)`` — stream per-tick rows to an Arrow
+        IPC file through the ``TableConverter`` column appenders. */
+    struct to_arrow_stream_impl
+    {
+        static constexpr auto name = "to_arrow_stream";
+
+        static std::vector<std::pair<std::string_view, Value>> defaults()
+        {
+            return {{"dt_col", Value{Str{"date"}}},
+                    {"batch_rows", Value{Int{65536}}},
+                    {"flush_interval", Value{TimeDelta{0}}}};
+        }
+
+        static void start(In<"ts", TsVar<"S">> ts, Scalar<"path", Str> path, Scalar<"dt_col", Str> dt_col,
+                          Scalar<"batch_rows", Int> batch_rows, Scalar<"flush_interval", TimeDelta> flush_interval,
+                          GlobalStateView gs, State<ToArrowStreamState> state)
+        {
+            if (batch_rows.value() <= 0)
+            {
+                throw std::invalid_argument("to_arrow_stream: batch_rows must be positive");
+            }
+            const auto &converter = table_converter(ts.base().schema()->value_schema, dt_col.value(),
+                                                    record_replay::config(gs).as_of_key);
+            auto writer = std::make_unique<FrameStreamWriter>(converter, path.value(), batch_rows.value(),
+                                                              flush_interval.value());
+            state.set(ToArrowStreamState{writer.release()});   // owned by node State until stop
+        }
+
+        static void eval(In<"ts", TsVar<"S">> ts, Scalar<"path", Str> path, Scalar<"dt_col", Str> dt_col,
+                         Scalar<"batch_rows", Int> batch_rows, Scalar<"flush_interval", TimeDelta> flush_interval,
+                         State<ToArrowStreamState> state, GlobalStateView gs, DateTime now)
+        {
+            static_cast<void>(path);
+            static_cast<void>(dt_col);
+            static_cast<void>(batch_rows);
+            static_cast<void>(flush_interval);
+            const auto as_of = record_replay::config(gs).as_of.value_or(now);
+            state.get().handle->append(now, as_of, ts.value());
+        }
+
+        static void stop(State<ToArrowStreamState> state)
+        {
+            // Take ownership first so a throwing close cannot leak.
+            std::unique_ptr<FrameStreamWriter> writer{state.get().handle};
+            state.set(ToArrowStreamState{});
+            if (writer == nullptr) { return; }
+            writer->close();
+        }
+    };
+
     struct replay_data_frame_impl
     {
         static constexpr auto name = "replay_data_frame";
@@ -0,0 +1,257 @@
+#ifndef HGRAPH_LIB_STD_OPERATORS_IMPL_DELTA_RING_H
+#define HGRAPH_LIB_STD_OPERATORS_IMPL_DELTA_RING_H
+
+#include <hgraph/types/metadata/ts_value_type_meta_data.h>
+#include <hgraph/types/time_series/ts_delta.h>
+#include <hgraph/types/time_series/ts_input.h>
+#include <hgraph/types/value/compact_storage.h>
+#include <hgraph/types/value/value.h>
+#include <hgraph/util/scope.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hgraph::stdlib::stream_impl_detail
+{
+    /** Stamp type of a ``DeltaRing`` that pairs nothing with its deltas. */
+    struct NoStamp
+    {
+    };
+
+    /**
+     * FIFO of captured time-series deltas held unboxed in one plan-typed ring.
+     *
+     * The element binding is taken from the first delta pushed and the buffer
+     * is allocated once, at the largest ``reserve`` hint seen (the operator's
+     * scalar bound, else ``default_capacity``); it only doubles when an
+     * unbounded operator outgrows it.
+     * A scalar delta is copied straight from the input's value into its slot
+     * and a built delta is moved out of its ``Value``, so a ring whose
+     * capacity covers its bound does not allocate at steady state.
+     *
+     * ``Stamp`` optionally pairs each delta with a trivially copyable tag (a
+     * release time, a proxy count); ``NoStamp`` stores none.
+     */
+    template <typename Stamp = NoStamp>
+    class DeltaRing
+    {
+        static_assert(std::is_trivially_copyable_v<Stamp>, "DeltaRing stamps must be trivially copyable");
+        static constexpr bool stamped = !std::is_empty_v<Stamp>;
+
+      public:
+        static constexpr std::size_t default_capacity = 8;
+
+        DeltaRing() noexcept = default;
+        DeltaRing(const DeltaRing &other) { copy_from(other); }
+        DeltaRing(DeltaRing &&other) noexcept { take_from(other); }
+
+        DeltaRing &operator=(const DeltaRing &other)
+        {
+            if (this != &other)
+            {
+                DeltaRing copy{other};
+                release();
+                take_from(copy);
+            }
+            return *this;
+        }
+
+        DeltaRing &operator=(DeltaRing &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                take_from(other);
+            }
+            return *this;
+        }
+
+        ~DeltaRing() { release(); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool        empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        /** Size the ring for at least ``capacity`` deltas (now, or on first push). */
+        void reserve(std::size_t capacity)
+        {
+            hint_ = std::max(hint_, capacity);
+            if (bytes_ != nullptr && capacity > capacity_) { regrow(capacity); }
+        }
+
+        /** Append a delta owned by ``delta``; its payload is moved into the ring. */
+        void push_back(Value &&delta, Stamp stamp = {})
+        {
+            void *slot = prepare_slot(delta.binding());
+            binding_.move_construct_at(slot, const_cast<void *>(delta.view().data()));
+            commit(stamp);
+        }
+
+        /** Append a copy of ``delta``, constructed in place when it is already owning storage. */
+        void push_back_copy(const ValueView &delta, Stamp stamp = {})
+        {
+            if (value_owning_type(delta.binding()) != delta.binding())
+            {
+                push_back(Value{delta}, stamp);
+                return;
+            }
+            void *slot = prepare_slot(delta.binding());
+            binding_.copy_construct_at(slot, delta.data());
+            commit(stamp);
+        }
+
+        /** Append this cycle's delta of ``in``: a ``TS`` value is copied unboxed, anything else is captured. */
+        void push_back_delta(const TSInputView &in, Stamp stamp = {})
+        {
+            if (in.schema()->kind == TSTypeKind::TS) { push_back_copy(in.value(), stamp); }
+            else { push_back(capture_delta(in), stamp); }
+        }
+
+        [[nodiscard]] ValueView at(std::size_t index) const { return ValueView{binding_, slot(physical(index))}; }
+        [[nodiscard]] ValueView front() const { return at(0); }
+
+        [[nodiscard]] Stamp stamp_at(std::size_t index) const noexcept
+            requires stamped
+        {
+            return stamps_[physical(index)];
+        }
+        [[nodiscard]] Stamp front_stamp() const noexcept
+            requires stamped
+        {
+            return stamp_at(0);
+        }
+
+        void pop_front() noexcept
+        {
+            binding_.destroy_at(slot(head_));
+            head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+            --size_;
+        }
+
+        /** Destroy every queued delta, keeping the buffer. */
+        void clear() noexcept
+        {
+            while (size_ != 0) { pop_front(); }
+            head_ = 0;
+        }
+
+      private:
+        [[nodiscard]] std::size_t physical(std::size_t index) const noexcept
+        {
+            const std::size_t position = head_ + index;
+            return position >= capacity_ ? position - capacity_ : position;
+        }
+
+        [[nodiscard]] void *slot(std::size_t physical_index) const noexcept
+        {
+            return static_cast<std::byte *>(bytes_) + physical_index * stride_;
+        }
+
+        [[nodiscard]] void *prepare_slot(const ValueTypeRef &binding)
+        {
+            if (bytes_ == nullptr)
+            {
+                binding_ = binding;
+                stride_  = binding.checked_plan().layout.size;
+                regrow(hint_ != 0 ? hint_ : default_capacity);
+            }
+            else if (binding.plan() != binding_.plan())
+            {
+                throw std::logic_error("DeltaRing deltas must share one storage plan");
+            }
+            if (size_ == capacity_) { regrow(capacity_ * 2); }
+            return slot(physical(size_));
+        }
+
+        void commit(Stamp stamp) noexcept
+        {
+            if constexpr (stamped) { stamps_[physical(size_)] = stamp; }
+            ++size_;
+        }
+
+        // Re-lay the queued deltas from the head of a buffer of ``capacity``.
+        void regrow(std::size_t capacity)
+        {
+            const auto &plan  = binding_.checked_plan();
+            void       *bytes = compact_detail::allocate_element_buffer(plan, capacity);
+            Stamp      *stamps = nullptr;
+            std::size_t moved  = 0;
+            auto rollback = make_scope_exit([&]() noexcept {
+                compact_detail::destroy_elements_reverse(bytes, plan, moved);
+                compact_detail::deallocate_element_buffer(bytes, plan, capacity);
+                delete[] stamps;
+            });
+            if constexpr (stamped) { stamps = new Stamp[capacity]; }
+            for (; moved < size_; ++moved)
+            {
+                binding_.move_construct_at(static_cast<std::byte *>(bytes) + moved * stride_, slot(physical(moved)));
+                if constexpr (stamped) { stamps[moved] = stamps_[physical(moved)]; }
+            }
+            rollback.release();
+
+            for (std::size_t index = 0; index < size_; ++index) { binding_.destroy_at(slot(physical(index))); }
+            compact_detail::deallocate_element_buffer(bytes_, plan, capacity_);
+            delete[] stamps_;
+            bytes_    = bytes;
+            stamps_   = stamps;
+            capacity_ = capacity;
+            head_     = 0;
+        }
+
+        void copy_from(const DeltaRing &other)
+        {
+            hint_ = other.hint_;
+            if (other.bytes_ == nullptr) { return; }
+            binding_ = other.binding_;
+            stride_  = other.stride_;
+            regrow(other.capacity_);
+            for (std::size_t index = 0; index < other.size_; ++index)
+            {
+                binding_.copy_construct_at(slot(index), other.slot(other.physical(index)));
+                if constexpr (stamped) { stamps_[index] = other.stamps_[other.physical(index)]; }
+                ++size_;
+            }
+        }
+
+        void take_from(DeltaRing &other) noexcept
+        {
+            binding_  = other.binding_;
+            bytes_    = other.bytes_;
+            stamps_   = other.stamps_;
+            stride_   = other.stride_;
+            capacity_ = other.capacity_;
+            head_     = other.head_;
+            size_     = other.size_;
+            hint_     = other.hint_;
+            other.bytes_    = nullptr;
+            other.stamps_   = nullptr;
+            other.capacity_ = 0;
+            other.head_     = 0;
+            other.size_     = 0;
+        }
+
+        void release() noexcept
+        {
+            if (bytes_ == nullptr) { return; }
+            clear();
+            compact_detail::deallocate_element_buffer(bytes_, *binding_.plan(), capacity_);
+            delete[] stamps_;
+            bytes_    = nullptr;
+            stamps_   = nullptr;
+            capacity_ = 0;
+        }
+
+        ValueTypeRef binding_{};
+        void        *bytes_{nullptr};
+        Stamp       *stamps_{nullptr};
+        std::size_t  stride_{0};
+        std::size_t  capacity_{0};
+        std::size_t  head_{0};
+        std::size_t  size_{0};
+        std::size_t  hint_{0};
+    };
+}  // namespace hgraph::stdlib::stream_impl_detail
+
+#endif  // HGRAPH_LIB_STD_OPERATORS_IMPL_DELTA_RING_H
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <span>
@@ -1424,6 +1425,7 @@ namespace hgraph::stdlib
             SwitchNodeSpec             spec;
             std::vector<ExternalServiceSlot> external_services;
             spec.reload_on_ticked = cases.reload_on_ticked;
+            spec.branch_cache_size = cases.branch_cache_size;
             spec.branches.reserve(cases.cases.size());
             for (const SwitchCase &entry : cases.cases)
             {
@@ -2942,6 +2944,16 @@ namespace hgraph::stdlib
             return std::optional<bool>{output_schema != nullptr};
         }
 
+        /** Validate the ``__recycle__`` high-water mark of a keyed ``map_`` / ``mesh_``. */
+        [[nodiscard]] inline std::size_t recycle_child_graph_limit(std::string_view op, Int recycle)
+        {
+            if (recycle < 0)
+            {
+                throw std::invalid_argument(std::string{op} + ": '__recycle__' must not be negative");
+            }
+            return static_cast<std::size_t>(recycle);
+        }
+
         /**
          * The shared map wiring over the **func-parameter-ordered** time-series
          * list (positional + keyword arguments already resolved onto the
@@ -2951,7 +2963,9 @@ namespace hgraph::stdlib
                                                     std::string_view key_arg,
                                                     std::vector<WiringPortRef> ordered,
                                                     std::optional<WiringPortRef> keys,
-                                                    bool output_required)
+                                                    bool output_required,
+                                                    bool parallel = false,
+                                                    std::size_t recycle = 0)
         {
             std::vector<const TSValueTypeMetaData *> ts_schemas;
             std::vector<std::uint8_t>                arg_tags;
@@ -3014,6 +3028,8 @@ namespace hgraph::stdlib
                 {spec.multiplexed_inputs.data(), spec.multiplexed_inputs.size()},
                 classified, {ordered.data(), ordered.size()}, "map_");
             spec.keys_input_index = ordered.size();
+            spec.parallel_children = parallel;
+            spec.recycle_child_graphs = recycle;
 
             std::vector<std::pair<std::string, const TSValueTypeMetaData *>> fields;
             fields.reserve(ts_schemas.size() + 1);
@@ -3046,7 +3062,8 @@ namespace hgraph::stdlib
             WiringPortRef out = w.add_node(
                 std::type_index(typeid(map_node_tag)), node_schema,
                 std::span<const WiringInputRef>{input_refs.data(), input_refs.size()},
-                Value{MapCallConfig{func.value(), Str{key_arg}, Str{}, arg_tags}},
+                Value{MapCallConfig{func.value(), Str{key_arg}, Str{}, arg_tags, parallel,
+                                    static_cast<Int>(recycle)}},
                 [&]() {
                     NodeTypeMetaData meta;
                     meta.display_name  = "map_";
@@ -3089,7 +3106,8 @@ namespace hgraph::stdlib
                                                      std::string_view key_arg,
                                                      std::string_view mesh_name,
                                                      std::vector<WiringPortRef> ordered,
-                                                     std::optional<WiringPortRef> keys = std::nullopt)
+                                                     std::optional<WiringPortRef> keys = std::nullopt,
+                                                     std::size_t recycle = 0)
         {
             std::vector<const TSValueTypeMetaData *> ts_schemas;
             std::vector<std::uint8_t>                arg_tags;
@@ -3177,6 +3195,7 @@ namespace hgraph::stdlib
             // func takes a key. mesh_subscribe reads the current requester key from
             // the enclosing mesh evaluation context.
             spec.key_output_schema  = registry.ts(output_schema->key_type());
+            spec.recycle_child_graphs = recycle;
 
             std::vector<std::pair<std::string, const TSValueTypeMetaData *>> fields;
             fields.reserve(ts_schemas.size() + 1);
@@ -3204,7 +3223,8 @@ namespace hgraph::stdlib
             WiringPortRef out = w.add_node(
                 std::type_index(typeid(mesh_node_tag)), node_schema,
                 std::span<const WiringInputRef>{input_refs.data(), input_refs.size()},
-                Value{MapCallConfig{func.value(), Str{key_arg}, Str{mesh_name}, arg_tags}},
+                Value{MapCallConfig{func.value(), Str{key_arg}, Str{mesh_name}, arg_tags, false,
+                                    static_cast<Int>(recycle)}},
                 [&]() {
                     NodeTypeMetaData meta;
                     meta.display_name  = "mesh_";
@@ -3516,12 +3536,16 @@ namespace hgraph::stdlib
 
             static std::vector<std::pair<std::string_view, Value>> defaults()
             {
-                return {{"__key_arg__", Value{Str{"key"}}}};
+                return {{"__key_arg__", Value{Str{"key"}}},
+                        {"__parallel__", Value{Bool{false}}},
+                        {"__recycle__", Value{Int{0}}}};
             }
 
             static WiringPortRef compose(Wiring &w, Scalar<"func", WiredFn> func,
                                          VarIn<"args", TsVar<"B">> positional,
-                                         Scalar<"__key_arg__", Str> key_arg, VarKwIn<"kwargs"> kwargs)
+                                         Scalar<"__key_arg__", Str> key_arg,
+                                         Scalar<"__parallel__", Bool> parallel,
+                                         Scalar<"__recycle__", Int> recycle, VarKwIn<"kwargs"> kwargs)
             {
                 const std::vector<WiringPortRef> pos{positional.begin(), positional.end()};
                 std::vector<std::pair<std::string, WiringPortRef>> named{kwargs.begin(), kwargs.end()};
@@ -3530,7 +3554,8 @@ namespace hgraph::stdlib
                                                                {pos.data(), pos.size()},
                                                                {named.data(), named.size()},
                                                                key_arg.value());
-                return wire_map(w, func, key_arg.value(), std::move(bound.ordered), std::move(keys), true);
+                return wire_map(w, func, key_arg.value(), std::move(bound.ordered), std::move(keys), true,
+                                parallel.value(), recycle_child_graph_limit("map_", recycle.value()));
             }
         };
 
@@ -3558,12 +3583,16 @@ namespace hgraph::stdlib
 
             static std::vector<std::pair<std::string_view, Value>> defaults()
             {
-                return {{"__key_arg__", Value{Str{"key"}}}};
+                return {{"__key_arg__", Value{Str{"key"}}},
+                        {"__parallel__", Value{Bool{false}}},
+                        {"__recycle__", Value{Int{0}}}};
             }
 
             static void compose(Wiring &w, Scalar<"func", WiredFn> func,
                                 VarIn<"args", TsVar<"B">> positional,
-                                Scalar<"__key_arg__", Str> key_arg, VarKwIn<"kwargs"> kwargs)
+                                Scalar<"__key_arg__", Str> key_arg,
+                                Scalar<"__parallel__", Bool> parallel,
+                                Scalar<"__recycle__", Int> recycle, VarKwIn<"kwargs"> kwargs)
             {
                 const std::vector<WiringPortRef> pos{positional.begin(), positional.end()};
                 std::vector<std::pair<std::string, WiringPortRef>> named{kwargs.begin(), kwargs.end()};
@@ -3572,7 +3601,8 @@ namespace hgraph::stdlib
                                                                {pos.data(), pos.size()},
                                                                {named.data(), named.size()},
                                                                key_arg.value());
-                (void)wire_map(w, func, key_arg.value(), std::move(bound.ordered), std::move(keys), false);
+                (void)wire_map(w, func, key_arg.value(), std::move(bound.ordered), std::move(keys), false,
+                               parallel.value(), recycle_child_graph_limit("map_", recycle.value()));
             }
         };
 
@@ -3632,13 +3662,16 @@ namespace hgraph::stdlib
 
             static std::vector<std::pair<std::string_view, Value>> defaults()
             {
-                return {{"__key_arg__", Value{Str{"key"}}}, {"__name__", Value{Str{""}}}};
+                return {{"__key_arg__", Value{Str{"key"}}},
+                        {"__name__", Value{Str{""}}},
+                        {"__recycle__", Value{Int{0}}}};
             }
 
             static WiringPortRef compose(Wiring &w, Scalar<"func", WiredFn> func,
                                          VarIn<"args", TsVar<"B">> positional,
                                          Scalar<"__key_arg__", Str> key_arg,
                                          Scalar<"__name__", Str> mesh_name,
+                                         Scalar<"__recycle__", Int> recycle,
                                          VarKwIn<"kwargs"> kwargs)
             {
                 const std::vector<WiringPortRef> pos{positional.begin(), positional.end()};
@@ -3649,7 +3682,8 @@ namespace hgraph::stdlib
                                                                {named.data(), named.size()},
                                                                key_arg.value());
                 return wire_mesh(w, func, key_arg.value(), mesh_name.value(),
-                                 std::move(bound.ordered), std::move(keys));
+                                 std::move(bound.ordered), std::move(keys),
+                                 recycle_child_graph_limit("mesh_", recycle.value()));
             }
         };
         /**
@@ -3757,6 +3791,100 @@ namespace hgraph::stdlib
                                        ordered->takes_key);
         }
 
+        /** Packed argument and result columns reused across evaluations on one thread. */
+        struct LiftedColumnScratch
+        {
+            std::vector<std::vector<std::byte>> columns{};
+            std::vector<const void *>           column_data{};
+            std::vector<std::byte>              result{};
+            std::vector<std::size_t>            indices{};
+        };
+
+        /**
+         * The fixed-size ``map_lifted_tsl`` step for kernels over arithmetic
+         * scalars: gather the ready, modified indices into contiguous columns,
+         * apply the kernel over all of them in one vectorised call, then write
+         * only those output elements.
+         */
+        template <typename TBundle, typename TList>
+        void eval_lifted_map_tsl_columns(const LiftedKernel &kernel, const std::vector<bool> &multiplexed,
+                                         std::size_t size, TBundle &bundle, TList &output,
+                                         DateTime evaluation_time)
+        {
+            // Child graphs built from one builder may evaluate concurrently, so
+            // the scratch is per thread rather than captured by the callback.
+            thread_local LiftedColumnScratch scratch;
+            const std::size_t arity = multiplexed.size();
+            scratch.columns.resize(arity);
+            scratch.column_data.resize(arity);
+            scratch.indices.clear();
+            for (std::size_t arg = 0; arg < arity; ++arg)
+            {
+                scratch.columns[arg].resize(size * kernel.column_width(arg));
+            }
+            const std::size_t result_width = kernel.column_width(arity);
+            scratch.result.resize(size * result_width);
+
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                bool ready = true;
+                bool input_modified = false;
+                for (std::size_t arg = 0; arg < arity && ready; ++arg)
+                {
+                    auto input = bundle[arg];
+                    if (multiplexed[arg])
+                    {
+                        auto list = input.as_list();
+                        auto item = list[i];
+                        ready = item.valid();
+                        input_modified = input_modified || (ready && item.modified());
+                    }
+                    else
+                    {
+                        ready = input.valid();
+                        input_modified = input_modified || (ready && input.modified());
+                    }
+                }
+                if (!ready) { continue; }
+                if (!input_modified && output[i].valid()) { continue; }
+
+                const std::size_t row = scratch.indices.size();
+                for (std::size_t arg = 0; arg < arity; ++arg)
+                {
+                    auto input = bundle[arg];
+                    const std::size_t width = kernel.column_width(arg);
+                    if (multiplexed[arg])
+                    {
+                        auto list = input.as_list();
+                        auto item = list[i];
+                        std::memcpy(scratch.columns[arg].data() + row * width, item.value().data(), width);
+                    }
+                    else
+                    {
+                        std::memcpy(scratch.columns[arg].data() + row * width, input.value().data(), width);
+                    }
+                }
+                scratch.indices.push_back(i);
+            }
+            if (scratch.indices.empty()) { return; }
+
+            for (std::size_t arg = 0; arg < arity; ++arg) { scratch.column_data[arg] = scratch.columns[arg].data(); }
+            kernel.eval_columns(std::span<const void *const>{scratch.column_data.data(), arity},
+                                scratch.result.data(), scratch.indices.size());
+
+            for (std::size_t row = 0; row < scratch.indices.size(); ++row)
+            {
+                auto output_item = output[scratch.indices[row]];
+                auto mutation = output_item.begin_mutation(evaluation_time);
+                const ValueView source{mutation.value().binding(),
+                                       static_cast<const void *>(scratch.result.data() + row * result_width)};
+                if (!mutation.copy_value_from(source))
+                {
+                    throw std::logic_error("map_: lifted TSL fast path failed to copy an element result");
+                }
+            }
+        }
+
         [[nodiscard]] inline WiringPortRef wire_lifted_map_tsl(Wiring &w,
                                                                const WiredFn &func,
                                                                std::string_view key_arg,
@@ -3810,6 +3938,12 @@ namespace hgraph::stdlib
                     auto output_root = view.output(evaluation_time);
                     auto output = output_root.as_list();
 
+                    if (!dynamic && kernel->can_eval_columns())
+                    {
+                        eval_lifted_map_tsl_columns(*kernel, multiplexed, size, bundle, output, evaluation_time);
+                        return;
+                    }
+
                     std::size_t runtime_size = size;
                     if (dynamic)
                     {
@@ -3880,7 +4014,7 @@ namespace hgraph::stdlib
             (void)scalar_descriptor<MapCallConfig>::value_meta();
             WiringPortRef out = w.add_node(std::type_index(typeid(lifted_map_tsl_node_tag)), std::move(builder),
                                            std::span<const WiringPortRef>{ordered.data(), ordered.size()},
-                                           Value{MapCallConfig{func, Str{key_arg}, Str{}, arg_tags}});
+                                           Value{MapCallConfig{func, Str{key_arg}, Str{}, arg_tags, false}});
             return out;
         }
 
@@ -4096,7 +4230,7 @@ namespace hgraph::stdlib
                 std::span<const WiringPortRef>{ordered.data(), ordered.size()});
             return w.add_node(std::type_index(typeid(dynamic_tsl_map_node_tag)), node_schema,
                               std::span<const WiringInputRef>{input_refs.data(), input_refs.size()},
-                              Value{MapCallConfig{func, Str{key_arg}, Str{}, arg_tags}}, [&]() {
+                              Value{MapCallConfig{func, Str{key_arg}, Str{}, arg_tags, false}}, [&]() {
                                   NodeTypeMetaData meta;
                                   meta.display_name  = "map_";
                                   meta.input_schema  = input_schema;
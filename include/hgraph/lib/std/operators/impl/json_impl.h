@@ -115,9 +115,19 @@ namespace hgraph::stdlib
 
         static void eval(In<"ts", TS<Str>> ts, Out<TsVar<"O">> out)
         {
-            const Str &text = ts.value();
+            const Str  &text   = ts.value();
+            const auto &target = static_cast<const TSOutputView &>(out);
+            const auto  kind   = target.schema()->kind;
+            if (kind != TSTypeKind::TSD && kind != TSTypeKind::TSS && kind != TSTypeKind::TSL)
+            {
+                // Only the collection delta forms need the fragment cursor;
+                // anything else is one whole value read from a parsed document.
+                apply_current_value(target,
+                                    from_json_string(json_converter(target.schema()->value_schema), text).view());
+                return;
+            }
             json_fragment::Cursor cursor{std::string_view{text}, 0};
-            json_ts_detail::apply_ts_json(static_cast<const TSOutputView &>(out), cursor);
+            json_ts_detail::apply_ts_json(target, cursor);
         }
     };
 
@@ -1,6 +1,7 @@
 #ifndef HGRAPH_LIB_STD_OPERATORS_IMPL_NUMPY_IMPL_H
 #define HGRAPH_LIB_STD_OPERATORS_IMPL_NUMPY_IMPL_H
 
+#include <hgraph/lib/std/incremental_kernels.h>
 #include <hgraph/lib/std/operators/numpy.h>
 #include <hgraph/types/operator_type_resolution.h>
 #include <hgraph/types/static_node.h>
@@ -13,6 +14,7 @@
 #include <numeric>
 #include <optional>
 #include <span>
+#include <stdexcept>
 #include <string_view>
 #include <vector>
 
@@ -52,9 +54,20 @@ namespace hgraph::stdlib
         [[nodiscard]] Float quantile(ValueView input, Float q,
                                      std::string_view method);
 
+        /** Window quantile from the node's order-statistic state; the
+            interpolation rules match the Arrow-backed array overload. */
         template <typename T>
-        [[nodiscard]] Float quantile(const TSWInputView &input, Float q,
-                                     std::string_view method);
+        [[nodiscard]] Float quantile(const TSWInputView &input,
+                                     incremental_kernel_detail::WindowQuantileState<T> &state,
+                                     Float q, std::string_view method)
+        {
+            if (!(q >= 0.0 && q <= 1.0))
+            {
+                throw std::invalid_argument("quantile q must be in [0, 1]");
+            }
+            const auto interpolation = incremental_kernel_detail::quantile_method(method);
+            return incremental_kernel_detail::quantile_of(state.sync(input).ordered, q, interpolation);
+        }
 
         template <typename T>
         [[nodiscard]] Float standard_deviation(ValueView input, Int ddof);
@@ -320,11 +333,12 @@ namespace hgraph::stdlib
         }
         static void eval(In<"a", TsVar<"A">> input, In<"q", TS<Float>> q,
                          Scalar<"method", Str> method, Scalar<"keepdims", Bool>,
+                         State<incremental_kernel_detail::WindowQuantileState<T>> state,
                          Out<TS<Float>> out)
         {
             const TSWInputView window{input.base().borrowed_ref()};
             if (!numpy_detail::window_ready(window)) { return; }
-            out.set(numpy_detail::quantile<T>(window, q.value(), method.value()));
+            out.set(numpy_detail::quantile<T>(window, state.mutable_value(), q.value(), method.value()));
         }
     };
 
@@ -336,11 +350,13 @@ namespace hgraph::stdlib
     {
         static constexpr auto name = std::same_as<T, Int> ? "quantile_window_keepdims_int" : "quantile_window_keepdims_float";
         static void eval(In<"a", TsVar<"A">> input, In<"q", TS<Float>> q,
-                         Scalar<"keepdims", Bool>, Out<TS<Float>> out)
+                         Scalar<"keepdims", Bool>,
+                         State<incremental_kernel_detail::WindowQuantileState<T>> state,
+                         Out<TS<Float>> out)
         {
             const TSWInputView window{input.base().borrowed_ref()};
             if (!numpy_detail::window_ready(window)) { return; }
-            out.set(numpy_detail::quantile<T>(window, q.value(), "linear"));
+            out.set(numpy_detail::quantile<T>(window, state.mutable_value(), q.value(), "linear"));
         }
     };
 
@@ -349,11 +365,12 @@ namespace hgraph::stdlib
     {
         static constexpr auto name = std::same_as<T, Int> ? "quantile_window_default_int" : "quantile_window_default_float";
         static void eval(In<"a", TsVar<"A">> input, In<"q", TS<Float>> q,
+                         State<incremental_kernel_detail::WindowQuantileState<T>> state,
                          Out<TS<Float>> out)
         {
             const TSWInputView window{input.base().borrowed_ref()};
             if (!numpy_detail::window_ready(window)) { return; }
-            out.set(numpy_detail::quantile<T>(window, q.value(), "linear"));
+            out.set(numpy_detail::quantile<T>(window, state.mutable_value(), q.value(), "linear"));
         }
     };
 
@@ -362,11 +379,13 @@ namespace hgraph::stdlib
     {
         static constexpr auto name = std::same_as<T, Int> ? "quantile_window_method_int" : "quantile_window_method_float";
         static void eval(In<"a", TsVar<"A">> input, In<"q", TS<Float>> q,
-                         Scalar<"method", Str> method, Out<TS<Float>> out)
+                         Scalar<"method", Str> method,
+                         State<incremental_kernel_detail::WindowQuantileState<T>> state,
+                         Out<TS<Float>> out)
         {
             const TSWInputView window{input.base().borrowed_ref()};
             if (!numpy_detail::window_ready(window)) { return; }
-            out.set(numpy_detail::quantile<T>(window, q.value(), method.value()));
+            out.set(numpy_detail::quantile<T>(window, state.mutable_value(), q.value(), method.value()));
         }
     };
 
@@ -28,6 +28,7 @@
 #include <hgraph/lib/std/operators/impl/data_frame_impl.h>
 #include <hgraph/lib/std/operators/impl/record_replay_frame_impl.h>
 #include <hgraph/lib/std/operators/impl/record_replay_memory_impl.h>
+#include <hgraph/lib/std/operators/impl/record_replay_mmap_impl.h>
 #include <hgraph/lib/std/operators/impl/table_impl.h>
 #include <hgraph/lib/std/operators/impl/logical_impl.h>
 #include <hgraph/lib/std/operators/impl/numpy_impl.h>
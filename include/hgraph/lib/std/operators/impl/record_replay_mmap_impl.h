@@ -0,0 +1,214 @@
+#ifndef HGRAPH_LIB_STD_OPERATORS_IMPL_RECORD_REPLAY_MMAP_IMPL_H
+#define HGRAPH_LIB_STD_OPERATORS_IMPL_RECORD_REPLAY_MMAP_IMPL_H
+
+#include <hgraph/hgraph_export.h>
+#include <hgraph/lib/std/operators/impl/record_replay_frame_impl.h>
+#include <hgraph/lib/std/operators/io.h>
+#include <hgraph/runtime/node_scheduler.h>
+#include <hgraph/types/operator_dispatch.h>
+#include <hgraph/types/record_replay.h>
+#include <hgraph/types/static_node.h>
+#include <hgraph/types/time_series/ts_delta.h>
+#include <hgraph/types/value/table_codec.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hgraph::stdlib
+{
+    namespace record_replay_mmap_detail
+    {
+        /** Rows buffered per recording before a record batch is flushed to its file. */
+        inline constexpr std::int64_t default_batch_rows = 4096;
+
+        /**
+         * The recording file for ``fq_key`` under ``directory``:
+         * ``<directory>/<fq_key>.arrows``. Path separators in the key are
+         * replaced so every key maps to one file directly under the root.
+         */
+        [[nodiscard]] HGRAPH_EXPORT std::filesystem::path recording_path(std::string_view directory,
+                                                                         std::string_view fq_key);
+
+        /**
+         * Lazy reader over a recording written by ``FrameStreamWriter``. The
+         * file is memory-mapped and the IPC reader slices batches out of the
+         * mapping without copying; only the batch under the cursor is
+         * decoded, and it is released once the cursor moves past it.
+         */
+        class HGRAPH_EXPORT MappedFrameReader
+        {
+          public:
+            MappedFrameReader(const TableConverter &converter, const std::filesystem::path &path);
+            MappedFrameReader(const MappedFrameReader &)            = delete;
+            MappedFrameReader &operator=(const MappedFrameReader &) = delete;
+            ~MappedFrameReader();
+
+            /** True once every recorded row has been read. */
+            [[nodiscard]] bool exhausted() const noexcept;
+            /** The value time of the row under the cursor (requires ``!exhausted()``). */
+            [[nodiscard]] DateTime next_time() const;
+            /** Reconstruct the row under the cursor and advance past it. */
+            [[nodiscard]] Value read_next();
+
+          private:
+            struct Impl;
+            std::unique_ptr<Impl> impl_;
+        };
+    }  // namespace record_replay_mmap_detail
+
+    /** Node-State payloads carrying the heap handles (start-lifecycle pattern). */
+    struct MappedRecorderState
+    {
+        FrameStreamWriter *handle{nullptr};
+    };
+
+    struct MappedReplayState
+    {
+        record_replay_mmap_detail::MappedFrameReader *handle{nullptr};
+    };
+}  // namespace hgraph::stdlib
+
+namespace hgraph::static_schema_detail
+{
+    template <>
+    struct scalar_name<stdlib::MappedRecorderState>
+    {
+        static constexpr std::string_view value{"MappedRecorderState"};
+    };
+
+    template <>
+    struct scalar_name<stdlib::MappedReplayState>
+    {
+        static constexpr std::string_view value{"MappedReplayState"};
+    };
+}  // namespace hgraph::static_schema_detail
+
+namespace hgraph::stdlib
+{
+    /**
+     * The memory-mapped streaming record/replay backend (model
+     * ``record_replay::MEMORY_MAPPED``). ``record`` streams each tick's
+     * bitemporal row to ``Config::directory`` as the run advances rather
+     * than holding the whole frame until ``stop``; ``replay`` maps the file
+     * and decodes rows only as evaluation time reaches them, so there is no
+     * load phase and a long recording never has to fit in memory. Keys and
+     * column layouts match the data-frame backend (``fq_recordable_id.key``,
+     * ``TableConverter``); ``compare`` is served by the shared store-backed
+     * sink.
+     */
+    struct record_mmap_impl
+    {
+        static constexpr auto name = "record";
+
+        static std::vector<std::pair<std::string_view, Value>> defaults()
+        {
+            return {{"recordable_id", Value{Str{}}}};
+        }
+
+        static bool requires_(const ResolutionMap &, OperatorCallContext context)
+        {
+            return record_replay::model_is(context.global_state, record_replay::MEMORY_MAPPED);
+        }
+
+        static void start(In<"ts", TsVar<"S">> ts, Scalar<"key", Str> key,
+                          Scalar<"recordable_id", Str> recordable_id, TraitsView traits,
+                          GlobalStateView gs, State<MappedRecorderState> state)
+        {
+            const auto  config = record_replay::config(gs);
+            const auto &converter =
+                table_converter(ts.base().schema()->value_schema, config.date_key, config.as_of_key);
+            auto writer = std::make_unique<FrameStreamWriter>(
+                converter,
+                record_replay_mmap_detail::recording_path(
+                    config.directory, record_replay_frame_detail::frame_key(traits, recordable_id.value(), key.value()))
+                    .string(),
+                record_replay_mmap_detail::default_batch_rows);
+            state.set(MappedRecorderState{writer.release()});   // owned by node State until stop
+        }
+
+        static void eval(In<"ts", TsVar<"S">> ts, Scalar<"key", Str> key,
+                         Scalar<"recordable_id", Str> recordable_id, State<MappedRecorderState> state,
+                         GlobalStateView gs, DateTime now)
+        {
+            static_cast<void>(key);
+            static_cast<void>(recordable_id);
+            const auto as_of = record_replay::config(gs).as_of.value_or(now);
+            state.get().handle->append(now, as_of, ts.value());
+        }
+
+        static void stop(State<MappedRecorderState> state)
+        {
+            // Take ownership first so a throwing close cannot leak.
+            std::unique_ptr<FrameStreamWriter> writer{state.get().handle};
+            state.set(MappedRecorderState{});
+            if (writer == nullptr) { return; }
+            writer->close();
+        }
+    };
+
+    struct replay_mmap_impl
+    {
+        static constexpr auto name = "replay";
+
+        static std::vector<std::pair<std::string_view, Value>> defaults()
+        {
+            return {{"recordable_id", Value{Str{}}}};
+        }
+
+        static bool requires_(const ResolutionMap &, OperatorCallContext context)
+        {
+            return record_replay::model_is(context.global_state, record_replay::MEMORY_MAPPED);
+        }
+
+        static void start(Scalar<"key", Str> key, Scalar<"recordable_id", Str> recordable_id, TraitsView traits,
+                          GlobalStateView gs, State<MappedReplayState> state,
+                          SingleShotScheduler sched, Out<TsVar<"O">> out)
+        {
+            using record_replay_mmap_detail::MappedFrameReader;
+            const auto  config = record_replay::config(gs);
+            const auto  path   = record_replay_mmap_detail::recording_path(
+                config.directory, record_replay_frame_detail::frame_key(traits, recordable_id.value(), key.value()));
+            if (!std::filesystem::exists(path))
+            {
+                throw std::runtime_error("replay: no recorded file '" + path.string() + "'");
+            }
+            const auto &erased = static_cast<const TSOutputView &>(out);
+            const auto &converter =
+                table_converter(erased.schema()->value_schema, config.date_key, config.as_of_key);
+            auto reader = std::make_unique<MappedFrameReader>(converter, path);
+            if (!reader->exhausted()) { sched.schedule(reader->next_time()); }
+            state.set(MappedReplayState{reader.release()});   // owned by node State until stop
+        }
+
+        static void eval(Scalar<"key", Str> key, Scalar<"recordable_id", Str> recordable_id,
+                         State<MappedReplayState> state, NodeScheduler sched, DateTime now, Out<TsVar<"O">> out)
+        {
+            static_cast<void>(key);
+            static_cast<void>(recordable_id);
+            auto *reader = state.get().handle;
+            while (!reader->exhausted() && reader->next_time() == now)
+            {
+                Value value = reader->read_next();
+                apply_delta(out, value.view());
+            }
+            if (!reader->exhausted()) { sched.schedule(reader->next_time()); }
+        }
+
+        static void stop(State<MappedReplayState> state)
+        {
+            std::unique_ptr<record_replay_mmap_detail::MappedFrameReader> reader{state.get().handle};
+            state.set(MappedReplayState{});
+        }
+    };
+
+    /** Register the memory-mapped record/replay backend overloads. */
+    void register_record_replay_mmap_operators();
+}  // namespace hgraph::stdlib
+
+#endif  // HGRAPH_LIB_STD_OPERATORS_IMPL_RECORD_REPLAY_MMAP_IMPL_H
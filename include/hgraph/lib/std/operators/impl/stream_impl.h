@@ -1,6 +1,7 @@
 #ifndef HGRAPH_LIB_STD_OPERATORS_IMPL_STREAM_IMPL_H
 #define HGRAPH_LIB_STD_OPERATORS_IMPL_STREAM_IMPL_H
 
+#include <hgraph/lib/std/incremental_kernels.h>
 #include <hgraph/lib/std/operators/stream.h>
 #include <hgraph/types/operator_type_resolution.h>
 #include <hgraph/lib/std/operators/arithmetic.h>    // sub_ / div_ (rolling_average)
@@ -8,6 +9,7 @@
 #include <hgraph/lib/std/operators/comparison.h>    // min_ / eq_ (rolling_average)
 #include <hgraph/lib/std/operators/control.h>       // if_then_else (rolling_average)
 #include <hgraph/lib/std/operators/conversion.h>    // const_ / default_ / cast_ (rolling_average)
+#include <hgraph/lib/std/operators/impl/delta_ring.h>
 #include <hgraph/lib/std/operators/impl/tsl_itemwise_impl.h>
 #include <hgraph/types/operator_dispatch.h>
 #include <hgraph/types/primitive_types.h>
@@ -19,8 +21,6 @@
 #include <hgraph/types/value/value.h>
 #include <hgraph/types/value_callable.h>
 
-#include <ankerl/unordered_dense.h>
-
 #include <algorithm>
 #include <cmath>
 #include <deque>
@@ -210,9 +210,28 @@ namespace hgraph::stdlib
             }
         };
 
-        /** min_/max_ over a TSW: full-window recompute, fully ERASED via
-            Value::compare. Recompute EMITS every window tick (no dedup: a
-            sliding window re-ticks the same extremum as it slides). */
+        /** The oldest best element by Value::compare: the full-window
+            scan the extremum kernels fall back to while an unordered (NaN)
+            element is in the window. */
+        template <bool Min>
+        [[nodiscard]] inline Value tsw_scan_extremum(const TSWDataView &window)
+        {
+            std::optional<Value> best;
+            for (std::size_t index = 0; index < window.size(); ++index)
+            {
+                const ValueView value  = window.at(index);
+                const bool      better = !best.has_value() ||
+                                    (Min ? value.compare(best->view()) == std::partial_ordering::less
+                                         : value.compare(best->view()) == std::partial_ordering::greater);
+                if (better) { best.emplace(value); }
+            }
+            return std::move(*best);
+        }
+
+        /** min_/max_ over a TSW, fully ERASED via Value::compare: a monotonic
+            candidate deque kept in node state, so a slide is amortised O(1).
+            EMITS every window tick (no dedup: a sliding window re-ticks the
+            same extremum as it slides). */
         template <bool Min>
         struct tsw_extremum_impl
         {
@@ -232,7 +251,9 @@ namespace hgraph::stdlib
                     resolution, TypeRegistry::instance().ts(schema->value_schema->element_type));
             }
 
-            static void eval(In<"ts", TsVar<"S">> ts, Out<TsVar<"__out__">> out)
+            static void eval(In<"ts", TsVar<"S">> ts,
+                             State<incremental_kernel_detail::WindowExtremumState<Min>> state,
+                             Out<TsVar<"__out__">> out)
             {
                 const auto &erased = static_cast<const TSOutputView &>(out);
                 if (!ts.valid()) { return; }
@@ -241,23 +262,17 @@ namespace hgraph::stdlib
                 auto window = window_input.data_view();
                 if (!tsw_ready(window)) { return; }
 
-                std::optional<Value> best;
-                for (std::size_t index = 0; index < window.size(); ++index)
-                {
-                    const ValueView value  = window.at(index);
-                    const bool      better = !best.has_value() ||
-                                        (Min ? value.compare(best->view()) == std::partial_ordering::less
-                                             : value.compare(best->view()) == std::partial_ordering::greater);
-                    if (better) { best.emplace(value); }
-                }
-                auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
-                static_cast<void>(mutation.move_value_from(std::move(*best)));
+                const auto &kernel   = state.mutable_value().sync(window_input);
+                auto        mutation = erased.data_view().begin_mutation(erased.evaluation_time());
+                if (kernel.ordered()) { static_cast<void>(mutation.copy_value_from(kernel.best())); }
+                else { static_cast<void>(mutation.move_value_from(tsw_scan_extremum<Min>(window))); }
             }
         };
 
         /** sum_/mean over a NUMERIC TSW. The element type is a TEMPLATE
             parameter selected at node-selection time (requires_ gates on the
-            element meta) - the per-tick path never branches on type. */
+            element meta) - the per-tick path never branches on type. The
+            running total lives in node state and follows the window's slide. */
         template <bool Mean, typename T>
         struct tsw_numeric_aggregate_impl
         {
@@ -283,7 +298,9 @@ namespace hgraph::stdlib
                     registry.ts(Mean ? scalar_descriptor<Float>::value_meta() : scalar_descriptor<T>::value_meta()));
             }
 
-            static void eval(In<"ts", TsVar<"S">> ts, Out<TsVar<"__out__">> out)
+            static void eval(In<"ts", TsVar<"S">> ts,
+                             State<incremental_kernel_detail::WindowMomentsState<T>> state,
+                             Out<TsVar<"__out__">> out)
             {
                 const auto &erased = static_cast<const TSOutputView &>(out);
                 if (!ts.valid()) { return; }
@@ -291,18 +308,13 @@ namespace hgraph::stdlib
                 auto window = window_input.data_view();
                 if (!tsw_ready(window)) { return; }
 
-                T total{};
-                for (std::size_t index = 0; index < window.size(); ++index)
-                {
-                    total += window.at(index).checked_as<T>();
-                }
-                auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
+                const auto &moments  = state.mutable_value().sync(window_input).moments;
+                auto        mutation = erased.data_view().begin_mutation(erased.evaluation_time());
                 if constexpr (Mean)
                 {
-                    static_cast<void>(mutation.move_value_from(
-                        Value{static_cast<Float>(total) / static_cast<Float>(window.size())}));
+                    static_cast<void>(mutation.move_value_from(Value{moments.mean(window.size())}));
                 }
-                else { static_cast<void>(mutation.move_value_from(Value{total})); }
+                else { static_cast<void>(mutation.move_value_from(Value{moments.total()})); }
             }
         };
 
@@ -332,6 +344,7 @@ namespace hgraph::stdlib
 
             static void eval_with_ddof(
                 const In<"ts", TsVar<"S">> &ts, Int ddof,
+                State<incremental_kernel_detail::WindowMomentsState<T>> &state,
                 const Out<TsVar<"__out__">> &out)
             {
                 const auto &erased = static_cast<const TSOutputView &>(out);
@@ -340,24 +353,12 @@ namespace hgraph::stdlib
                 auto window = window_input.data_view();
                 if (!tsw_ready(window)) { return; }
 
-                const auto size = window.size();
-                Float      total{};
-                for (std::size_t index = 0; index < size; ++index)
-                {
-                    total += static_cast<Float>(window.at(index).checked_as<T>());
-                }
-                const Float mean_value = total / static_cast<Float>(size);
-                Float       squares{};
-                for (std::size_t index = 0; index < size; ++index)
-                {
-                    const Float delta = static_cast<Float>(window.at(index).checked_as<T>()) - mean_value;
-                    squares += delta * delta;
-                }
+                const auto &moments = state.mutable_value().sync(window_input).moments;
                 const Float divisor =
-                    static_cast<Float>(size) - static_cast<Float>(ddof);
+                    static_cast<Float>(window.size()) - static_cast<Float>(ddof);
                 const Float variance =
                     divisor > 0.0
-                        ? squares / divisor
+                        ? moments.squared_deviations() / divisor
                         : std::numeric_limits<Float>::quiet_NaN();
                 auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
                 static_cast<void>(mutation.move_value_from(
@@ -365,9 +366,10 @@ namespace hgraph::stdlib
             }
 
             static void eval(In<"ts", TsVar<"S">> ts,
+                             State<incremental_kernel_detail::WindowMomentsState<T>> state,
                              Out<TsVar<"__out__">> out)
             {
-                eval_with_ddof(ts, 0, out);
+                eval_with_ddof(ts, 0, state, out);
             }
         };
 
@@ -379,9 +381,10 @@ namespace hgraph::stdlib
 
             static void eval(In<"ts", TsVar<"S">> ts,
                              Scalar<"ddof", Int> ddof,
+                             State<incremental_kernel_detail::WindowMomentsState<T>> state,
                              Out<TsVar<"__out__">> out)
             {
-                tsw_std_impl<T>::eval_with_ddof(ts, ddof.value(), out);
+                tsw_std_impl<T>::eval_with_ddof(ts, ddof.value(), state, out);
             }
         };
 
@@ -409,6 +412,7 @@ namespace hgraph::stdlib
 
             static void eval(In<"ts", TsVar<"S">, InputValidity::Unchecked> ts,
                              Scalar<"default_value", ScalarVar<"D">> default_value,
+                             State<incremental_kernel_detail::WindowExtremumState<Min>> state,
                              Out<TsVar<"__out__">> out)
             {
                 if (!ts.modified()) { return; }
@@ -441,36 +445,41 @@ namespace hgraph::stdlib
                     if (window.time_based()) { publish(default_value.value()); }
                     return;
                 }
-                std::optional<Value> best;
-                for (std::size_t index = 0; index < window.size(); ++index)
-                {
-                    const ValueView value = window.at(index);
-                    const bool better = !best.has_value() ||
-                                        (Min ? value.compare(best->view()) == std::partial_ordering::less
-                                             : value.compare(best->view()) == std::partial_ordering::greater);
-                    if (better) { best.emplace(value); }
-                }
-                publish(best->view());
+                const auto &kernel = state.mutable_value().sync(window_input);
+                if (kernel.ordered()) { publish(kernel.best()); }
+                else { publish(tsw_scan_extremum<Min>(window).view()); }
             }
         };
 
+        // Queued deltas live unboxed in a DeltaRing sized from the operator's
+        // scalar bound; nodes reach them through State::mutable_value so a
+        // tick neither copies the queue nor boxes the delta.
         struct DeltaQueueState
         {
-            std::deque<Value> buffer{};
+            DeltaRing<> buffer{};
         };
 
+        /** Deltas stamped with the time they were captured at or are released at. */
         struct TimedDeltaQueueState
         {
-            std::deque<std::pair<DateTime, Value>> buffer{};
+            DeltaRing<DateTime> buffer{};
         };
 
         struct LagProxyState
         {
-            // Deltas captured per proxy count, replayed (in arrival order,
-            // so container deltas net) when the LAGGED count reaches it.
-            ankerl::unordered_dense::map<Int, std::deque<Value>> cache{};
+            // Deltas stamped with the proxy count they arrived under, replayed
+            // (in arrival order, so container deltas net) when the LAGGED count
+            // reaches it. Both counts only grow, so this is a FIFO.
+            DeltaRing<Int> cache{};
         };
 
+        /** Initial ring capacity for a bound that may be unbounded (``Int`` max defaults). */
+        [[nodiscard]] inline std::size_t ring_capacity(Int bound) noexcept
+        {
+            return static_cast<std::size_t>(
+                std::min<Int>(bound, static_cast<Int>(DeltaRing<>::default_capacity)));
+        }
+
         struct ThrottleState
         {
             TimeDelta period{MIN_TD};
@@ -491,10 +500,10 @@ namespace hgraph::stdlib
             if (value <= TimeDelta{}) { throw std::invalid_argument(std::string{name} + " must be positive"); }
         }
 
-        inline void append_delta(DeltaQueueState &state, Value delta, std::size_t limit)
+        inline void append_delta(DeltaQueueState &state, const TSInputView &ts, std::size_t limit)
         {
             if (state.buffer.size() >= limit) { throw std::overflow_error("gate buffer length exceeded"); }
-            state.buffer.push_back(std::move(delta));
+            state.buffer.push_back_delta(ts);
         }
 
         /** Net a queue of canonical set deltas ({added, removed} bundles) into
@@ -706,18 +715,16 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::DeltaQueueState> state,
                          Out<TsVar<"S">> out)
         {
-            auto current = state.get();
-            current.buffer.push_back(capture_delta(ts.base()));
+            auto      &current = state.mutable_value();
+            const auto delay   = static_cast<std::size_t>(period.value());
+            current.buffer.reserve(delay + 1);
+            current.buffer.push_back_delta(ts.base());
 
-            const auto delay = static_cast<std::size_t>(period.value());
             if (current.buffer.size() > delay)
             {
-                Value delta = std::move(current.buffer.front());
+                apply_delta(out, current.buffer.front());
                 current.buffer.pop_front();
-                apply_delta(out, delta.view());
             }
-
-            state.set(std::move(current));
         }
     };
 
@@ -734,23 +741,20 @@ namespace hgraph::stdlib
                          Out<TsVar<"S">> out)
         {
             const auto now     = static_cast<const TSOutputView &>(out).evaluation_time();
-            auto       current = state.get();
+            auto      &current = state.mutable_value();
 
             if (ts.modified() && ts.valid())
             {
                 stream_impl_detail::require_positive(period.value(), "period");
-                current.buffer.emplace_back(now + period.value(), capture_delta(ts.base()));
+                current.buffer.push_back_delta(ts.base(), now + period.value());
                 scheduler.schedule(period.value());
             }
 
-            while (!current.buffer.empty() && current.buffer.front().first <= now)
+            while (!current.buffer.empty() && current.buffer.front_stamp() <= now)
             {
-                Value delta = std::move(current.buffer.front().second);
+                apply_delta(out, current.buffer.front());
                 current.buffer.pop_front();
-                apply_delta(out, delta.view());
             }
-
-            state.set(std::move(current));
         }
     };
 
@@ -768,22 +772,23 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::LagProxyState> state,
                          Out<TsVar<"S">> out)
         {
-            auto current = state.get();
+            auto &current = state.mutable_value();
             if (ts.modified() && ts.valid())
             {
                 lag_c.make_active();
-                current.cache[c.value()].push_back(capture_delta(ts.base()));
+                current.cache.push_back_delta(ts.base(), c.value());
             }
             if (lag_c.modified() && lag_c.valid())
             {
-                if (auto entry = current.cache.find(lag_c.value()); entry != current.cache.end())
+                // Deltas under an older count than the lagged one can never
+                // be replayed; drop them on the way to the matching count.
+                while (!current.cache.empty() && current.cache.front_stamp() <= lag_c.value())
                 {
-                    for (Value &delta : entry->second) { apply_delta(out, delta.view()); }
-                    current.cache.erase(entry);
+                    if (current.cache.front_stamp() == lag_c.value()) { apply_delta(out, current.cache.front()); }
+                    current.cache.pop_front();
                 }
                 if (current.cache.empty()) { lag_c.make_passive(); }
             }
-            state.set(std::move(current));
         }
     };
 
@@ -961,22 +966,19 @@ namespace hgraph::stdlib
                          Out<TsVar<"S">> out)
         {
             const auto now     = static_cast<const TSOutputView &>(out).evaluation_time();
-            auto       current = state.get();
+            auto      &current = state.mutable_value();
 
             if (ts.modified() && ts.valid())
             {
-                current.buffer.emplace_back(now + period.value(), capture_delta(ts.base()));
+                current.buffer.push_back_delta(ts.base(), now + period.value());
                 scheduler.schedule(period.value());
             }
 
-            while (!current.buffer.empty() && current.buffer.front().first <= now)
+            while (!current.buffer.empty() && current.buffer.front_stamp() <= now)
             {
-                Value delta = std::move(current.buffer.front().second);
+                apply_delta(out, current.buffer.front());
                 current.buffer.pop_front();
-                apply_delta(out, delta.view());
             }
-
-            state.set(std::move(current));
         }
     };
 
@@ -1266,7 +1268,7 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::DeltaQueueState> state,
                          Out<TsVar<"S">> out)
         {
-            auto       current        = state.get();
+            auto      &current        = state.mutable_value();
             const bool keep_newest    = buffer_length.value() < 0;
             const auto limit          = static_cast<std::size_t>(
                 keep_newest ? -buffer_length.value() : buffer_length.value());
@@ -1275,30 +1277,33 @@ namespace hgraph::stdlib
 
             if (ts.modified() && ts.valid())
             {
-                Value delta = capture_delta(ts.base());
                 if (condition_true && current.buffer.empty())
                 {
-                    apply_delta(out, delta.view());
+                    // Nothing queued ahead: pass the tick straight through.
+                    apply_delta(out, capture_delta(ts.base()).view());
                     emitted = true;
                 }
                 else if (keep_newest)
                 {
+                    current.buffer.reserve(limit);
                     while (current.buffer.size() >= limit) { current.buffer.pop_front(); }
-                    current.buffer.push_back(std::move(delta));
+                    current.buffer.push_back_delta(ts.base());
+                }
+                else
+                {
+                    current.buffer.reserve(stream_impl_detail::ring_capacity(buffer_length.value()));
+                    stream_impl_detail::append_delta(current, ts.base(), limit);
                 }
-                else { stream_impl_detail::append_delta(current, std::move(delta), limit); }
             }
 
             if (!emitted && condition_true && !current.buffer.empty())
             {
-                Value delta = std::move(current.buffer.front());
+                apply_delta(out, current.buffer.front());
                 current.buffer.pop_front();
-                apply_delta(out, delta.view());
                 emitted = true;
             }
 
             if (condition_true && !current.buffer.empty()) { scheduler.schedule(MIN_TD); }
-            state.set(std::move(current));
         }
 
         static std::vector<std::pair<std::string_view, Value>> defaults()
@@ -1320,17 +1325,17 @@ namespace hgraph::stdlib
         }
 
         /** Emit the {buffer, index} bundle for the queued (time, value) entries. */
-        inline void emit_window_result(const TSOutputView &out,
-                                       const std::deque<std::pair<DateTime, Value>> &entries)
+        inline void emit_window_result(const TSOutputView &out, const DeltaRing<DateTime> &entries)
         {
             const auto *meta = out.schema()->value_schema;
             auto &factory = ValuePlanFactory::instance();
             const auto *element_meta = meta->fields[0].type->element_type;
             ListBuilder values{factory.type_for(element_meta)};
             ListBuilder times{factory.type_for(scalar_descriptor<DateTime>::value_meta())};
-            for (const auto &[time, value] : entries)
+            for (std::size_t index = 0; index < entries.size(); ++index)
             {
-                values.push_back_copy(value.view().data());
+                const DateTime time = entries.stamp_at(index);
+                values.push_back_copy(entries.at(index).data());
                 times.push_back_copy(&time);
             }
             BundleBuilder bundle{factory.type_for(meta)};
@@ -1361,8 +1366,9 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::TimedDeltaQueueState> state,
                          DateTime now, Out<TsVar<"__out__">> out)
         {
-            auto current = state.get();
-            current.buffer.emplace_back(now, Value{ts.base().value()});
+            auto &current = state.mutable_value();
+            current.buffer.reserve(static_cast<std::size_t>(period.value()) + 1);
+            current.buffer.push_back_copy(ts.base().value(), now);
             while (current.buffer.size() > static_cast<std::size_t>(period.value()))
             {
                 current.buffer.pop_front();
@@ -1373,7 +1379,6 @@ namespace hgraph::stdlib
             {
                 stream_impl_detail::emit_window_result(static_cast<const TSOutputView &>(out), current.buffer);
             }
-            state.set(std::move(current));
         }
 
         static std::vector<std::pair<std::string_view, Value>> defaults()
@@ -1400,19 +1405,18 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::TimedDeltaQueueState> state,
                          DateTime now, Out<TsVar<"__out__">> out)
         {
-            auto current = state.get();
-            current.buffer.emplace_back(now, Value{ts.base().value()});
-            while (!current.buffer.empty() && current.buffer.front().first < now - period.value())
+            auto &current = state.mutable_value();
+            current.buffer.push_back_copy(ts.base().value(), now);
+            while (!current.buffer.empty() && current.buffer.front_stamp() < now - period.value())
             {
                 current.buffer.pop_front();
             }
             const TimeDelta minimum =
                 min_window_period.value() > TimeDelta{0} ? min_window_period.value() : period.value();
-            if (now - current.buffer.front().first >= minimum)
+            if (now - current.buffer.front_stamp() >= minimum)
             {
                 stream_impl_detail::emit_window_result(static_cast<const TSOutputView &>(out), current.buffer);
             }
-            state.set(std::move(current));
         }
 
         static std::vector<std::pair<std::string_view, Value>> defaults()
@@ -1443,14 +1447,15 @@ namespace hgraph::stdlib
                          State<stream_impl_detail::DeltaQueueState> state,
                          Out<TsVar<"__out__">> out)
         {
-            auto current = state.get();
+            auto &current = state.mutable_value();
             if (ts.modified() && ts.valid())
             {
                 if (current.buffer.size() >= static_cast<std::size_t>(buffer_length.value()))
                 {
                     throw std::overflow_error("batch buffer length exceeded");
                 }
-                current.buffer.push_back(capture_delta(ts.base()));
+                current.buffer.reserve(stream_impl_detail::ring_capacity(buffer_length.value()));
+                current.buffer.push_back_delta(ts.base());
             }
 
             const bool condition_true = condition.valid() && condition.value();
@@ -1463,14 +1468,16 @@ namespace hgraph::stdlib
                     const auto &erased = static_cast<const TSOutputView &>(out);
                     const auto *meta   = erased.schema()->value_schema;
                     ListBuilder builder{ValuePlanFactory::instance().type_for(meta->element_type)};
-                    for (Value &value : current.buffer) { builder.push_back_copy(value.view().data()); }
+                    for (std::size_t index = 0; index < current.buffer.size(); ++index)
+                    {
+                        builder.push_back_copy(current.buffer.at(index).data());
+                    }
                     current.buffer.clear();
                     Value result   = builder.build();
                     auto  mutation = erased.data_view().begin_mutation(erased.evaluation_time());
                     static_cast<void>(mutation.move_value_from(std::move(result)));
                 }
             }
-            state.set(std::move(current));
         }
 
         static std::vector<std::pair<std::string_view, Value>> defaults()
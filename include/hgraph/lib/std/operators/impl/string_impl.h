@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -29,48 +30,104 @@ namespace hgraph::stdlib
             return static_cast<std::size_t>(normalized);
         }
 
-        [[nodiscard]] inline std::vector<Str> split_parts(const Str &value, const Str &separator, std::size_t max_parts)
+        /** Borrow a ``TS[str]`` input's current string (``In::value`` returns a copy). */
+        [[nodiscard]] inline const Str &str_value(const TSInputView &in) { return in.value().checked_as<Str>(); }
+
+        /** Tick a ``TS[str]`` output with ``value``, copy-assigned into the output's own string so its
+            capacity is reused (``Out::set`` first copies into a temporary). */
+        inline void set_str(const TSOutputView &out, const Str &value)
         {
-            if (separator.empty()) { throw std::invalid_argument("split: separator must not be empty"); }
+            auto mutation    = out.begin_mutation(out.evaluation_time());
+            auto destination = mutation.value();
+            static_cast<void>(
+                mutation.copy_value_from(ValueView{destination.binding(), static_cast<const void *>(&value)}));
+        }
 
-            std::vector<Str> parts;
-            std::size_t      start = 0;
-            if (max_parts != 0) { parts.reserve(max_parts); }
+        /** Split ``value`` into views over it (python ``str.split`` with ``max_parts - 1`` splits; 0 = all). */
+        inline void split_parts(std::string_view value, std::string_view separator, std::size_t max_parts,
+                                std::vector<std::string_view> &parts)
+        {
+            if (separator.empty()) { throw std::invalid_argument("split: separator must not be empty"); }
 
+            parts.clear();
+            std::size_t start = 0;
             while ((max_parts == 0 || parts.size() + 1 < max_parts))
             {
                 const std::size_t pos = value.find(separator, start);
-                if (pos == Str::npos) { break; }
+                if (pos == std::string_view::npos) { break; }
                 parts.push_back(value.substr(start, pos - start));
                 start = pos + separator.size();
             }
             parts.push_back(value.substr(start));
-            return parts;
         }
 
-        [[nodiscard]] inline const std::string *find_named_format_value(
-            std::string_view name,
-            const std::vector<std::pair<std::string, std::string>> &named_values)
+        /** A pattern compiled in node state, rebuilt only when the pattern input ticks. */
+        struct CompiledRegex
+        {
+            std::regex regex{};
+            bool       compiled{false};
+
+            [[nodiscard]] const std::regex &sync(const TSInputView &pattern)
+            {
+                if (!compiled || pattern.modified())
+                {
+                    compiled = false;
+                    regex.assign(str_value(pattern), std::regex::ECMAScript | std::regex::optimize);
+                    compiled = true;
+                }
+                return regex;
+            }
+        };
+
+        struct ReplaceState
+        {
+            CompiledRegex pattern{};
+            Str           buffer{};
+        };
+
+        /** Reused scratch for operators that build a string or its parts each tick. */
+        struct StringBufferState
+        {
+            Str                           buffer{};
+            std::vector<std::string_view> parts{};
+        };
+
+        /** Rendered argument text, kept across ticks so the strings keep their capacity. */
+        struct FormatValues
+        {
+            std::vector<std::string>                              positional;
+            std::vector<std::pair<std::string_view, std::string>> named;
+            std::size_t                                           positional_count{0};
+            std::size_t                                           named_count{0};
+        };
+
+        struct FormatState
         {
-            for (const auto &[key, value] : named_values)
+            Int          count{0};
+            FormatValues values{};
+            Str          buffer{};
+        };
+
+        [[nodiscard]] inline const std::string *find_named_format_value(std::string_view name,
+                                                                        const FormatValues &values)
+        {
+            for (std::size_t index = 0; index < values.named_count; ++index)
             {
-                if (key == name) { return &value; }
+                if (values.named[index].first == name) { return &values.named[index].second; }
             }
             return nullptr;
         }
 
-        [[nodiscard]] inline std::string placeholder_name(std::string_view placeholder)
+        [[nodiscard]] inline std::string_view placeholder_name(std::string_view placeholder)
         {
             const std::size_t end = placeholder.find_first_of(":!");
-            return std::string{placeholder.substr(0, end)};
+            return placeholder.substr(0, end);
         }
 
-        [[nodiscard]] inline Str render_format_string(
-            std::string_view fmt,
-            const std::vector<std::string> &positional_values,
-            const std::vector<std::pair<std::string, std::string>> &named_values)
+        /** Render ``fmt`` into ``rendered`` (cleared first). */
+        inline void render_format_string(Str &rendered, std::string_view fmt, const FormatValues &values)
         {
-            Str         rendered;
+            rendered.clear();
             std::size_t next_positional = 0;
             for (std::size_t i = 0; i < fmt.size();)
             {
@@ -90,21 +147,22 @@ namespace hgraph::stdlib
                         throw std::invalid_argument("format_: unmatched '{' in format string");
                     }
 
-                    const std::string name = placeholder_name(fmt.substr(i + 1, close - i - 1));
+                    const std::string_view name = placeholder_name(fmt.substr(i + 1, close - i - 1));
                     if (name.empty())
                     {
-                        if (next_positional >= positional_values.size())
+                        if (next_positional >= values.positional_count)
                         {
                             throw std::invalid_argument("format_: not enough positional arguments");
                         }
-                        rendered += positional_values[next_positional++];
+                        rendered += values.positional[next_positional++];
                     }
                     else
                     {
-                        const std::string *value = find_named_format_value(name, named_values);
+                        const std::string *value = find_named_format_value(name, values);
                         if (value == nullptr)
                         {
-                            throw std::invalid_argument("format_: missing keyword argument '" + name + "'");
+                            throw std::invalid_argument("format_: missing keyword argument '" + std::string{name} +
+                                                        "'");
                         }
                         rendered += *value;
                     }
@@ -126,38 +184,44 @@ namespace hgraph::stdlib
                 rendered.push_back(c);
                 ++i;
             }
-            return rendered;
         }
 
-        struct FormatValues
+        /** Write the text of one format argument into ``text``, reusing its buffer for string values. */
+        inline void format_value_text(const TSInputView &child, bool strict, std::string &text)
         {
-            std::vector<std::string>                         positional;
-            std::vector<std::pair<std::string, std::string>> named;
-        };
+            if (!strict && !child.valid())
+            {
+                text.assign("None");
+                return;
+            }
+            const ValueView value = child.value();
+            if (const Str *string = value.try_as<Str>()) { text.assign(*string); }
+            else { text = value.format_string(); }
+        }
 
-        [[nodiscard]] inline FormatValues collect_format_values(TSBInputView &bundle, std::size_t positional_count,
-                                                                bool strict)
+        /** Refresh ``values`` from the bundle's current children; field names borrow the schema's. */
+        inline void collect_format_values(TSBInputView &bundle, std::size_t positional_count, bool strict,
+                                          FormatValues &values)
         {
-            FormatValues values;
-            values.positional.reserve(std::min(positional_count, bundle.size()));
-            values.named.reserve(bundle.size() > positional_count ? bundle.size() - positional_count : 0);
-
-            std::size_t index = 0;
+            values.positional_count = 0;
+            values.named_count      = 0;
+            std::size_t index       = 0;
             for (auto [name, child] : bundle.items())
             {
-                if (!strict && !child.valid())
+                if (index < positional_count)
                 {
-                    if (index < positional_count) { values.positional.emplace_back("None"); }
-                    else { values.named.emplace_back(std::string{name}, "None"); }
-                    ++index;
-                    continue;
+                    if (values.positional_count == values.positional.size()) { values.positional.emplace_back(); }
+                    format_value_text(child, strict, values.positional[values.positional_count++]);
+                }
+                else
+                {
+                    if (values.named_count == values.named.size()) { values.named.emplace_back(); }
+                    auto &[key, text] = values.named[values.named_count++];
+                    key               = name;
+                    format_value_text(child, strict, text);
                 }
-
-                if (index < positional_count) { values.positional.push_back(child.value().format_string()); }
-                else { values.named.emplace_back(std::string{name}, child.value().format_string()); }
                 ++index;
             }
-            return values;
         }
 
         [[nodiscard]] inline WiringNamedStructuralSourceArg format_bundle_arg(
@@ -176,9 +240,15 @@ namespace hgraph::stdlib
     struct replace_impl
     {
         static void eval(In<"pattern", TS<Str>> pattern, In<"repl", TS<Str>> repl, In<"s", TS<Str>> s,
-                         Out<TS<Str>> out)
+                         State<string_impl_detail::ReplaceState> state, Out<TS<Str>> out)
         {
-            out.set(std::regex_replace(s.value(), std::regex{pattern.value()}, repl.value()));
+            auto             &current = state.mutable_value();
+            const std::regex &regex   = current.pattern.sync(pattern);
+            const Str        &text    = string_impl_detail::str_value(s);
+            current.buffer.clear();
+            std::regex_replace(std::back_inserter(current.buffer), text.begin(), text.end(), regex,
+                               string_impl_detail::str_value(repl));
+            string_impl_detail::set_str(out, current.buffer);
         }
     };
 
@@ -203,11 +273,12 @@ namespace hgraph::stdlib
             resolution.bind_ts("O", result_schema());
         }
 
-        static void eval(In<"pattern", TS<Str>> pattern, In<"s", TS<Str>> s, Out<TsVar<"O">> out)
+        static void eval(In<"pattern", TS<Str>> pattern, In<"s", TS<Str>> s,
+                         State<string_impl_detail::CompiledRegex> state, Out<TsVar<"O">> out)
         {
-            const Str   value = s.value();
+            const Str  &value = string_impl_detail::str_value(s);
             std::smatch match;
-            const bool  is_match = std::regex_search(value, match, std::regex{pattern.value()});
+            const bool  is_match = std::regex_search(value, match, state.mutable_value().sync(pattern));
 
             const auto &erased = static_cast<const TSOutputView &>(out);
             auto        bundle = erased.as_bundle();
@@ -221,11 +292,7 @@ namespace hgraph::stdlib
             const auto *groups_meta = bundle.at(1).schema()->value_schema;
             const auto element_binding = ValuePlanFactory::instance().type_for(groups_meta->element_type);
             ListBuilder builder{element_binding};
-            for (std::size_t i = 1; i < match.size(); ++i)
-            {
-                const Str group = match[i].str();
-                builder.push_back(group);
-            }
+            for (std::size_t i = 1; i < match.size(); ++i) { builder.push_back(match[i].str()); }
             auto groups = bundle.at(1);
             auto mutation = groups.begin_mutation(erased.evaluation_time());
             static_cast<void>(mutation.move_value_from(builder.build()));
@@ -236,7 +303,7 @@ namespace hgraph::stdlib
     {
         static void eval(In<"s", TS<Str>> s, In<"start", TS<Int>> start, In<"end", TS<Int>> end, Out<TS<Str>> out)
         {
-            const Str        value       = s.value();
+            const Str        &value      = string_impl_detail::str_value(s);
             const std::size_t begin      = string_impl_detail::normalize_slice_index(start.value(), value.size());
             const std::size_t finish     = string_impl_detail::normalize_slice_index(end.value(), value.size());
             const std::size_t safe_end   = std::max(begin, finish);
@@ -281,7 +348,8 @@ namespace hgraph::stdlib
             resolution.bind_ts("O", registry.ts(registry.list(scalar_descriptor<Str>::value_meta(), 0, true)));
         }
 
-        static void eval(In<"s", TS<Str>> s, Scalar<"separator", Str> separator, Out<TsVar<"O">> out)
+        static void eval(In<"s", TS<Str>> s, Scalar<"separator", Str> separator,
+                         State<string_impl_detail::StringBufferState> state, Out<TsVar<"O">> out)
         {
             const auto &erased = static_cast<const TSOutputView &>(out);
             const auto *value_meta = erased.schema()->value_schema;
@@ -289,18 +357,8 @@ namespace hgraph::stdlib
                                     ? static_cast<std::size_t>(value_meta->field_count)
                                     : static_cast<std::size_t>(value_meta->fixed_size);
 
-            const Str value = s.value();
-            const Str sep   = separator.value();
-            std::vector<Str> parts;
-            std::size_t      begin = 0;
-            while (true)
-            {
-                if (fixed != 0 && parts.size() + 1 == fixed) { parts.push_back(value.substr(begin)); break; }
-                const auto at = value.find(sep, begin);
-                if (at == Str::npos) { parts.push_back(value.substr(begin)); break; }
-                parts.push_back(value.substr(begin, at - begin));
-                begin = at + sep.size();
-            }
+            auto &parts = state.mutable_value().parts;
+            string_impl_detail::split_parts(string_impl_detail::str_value(s), separator.value(), fixed, parts);
 
             Value result;
             if (fixed == 0)
@@ -308,7 +366,7 @@ namespace hgraph::stdlib
                 const auto element_binding =
                     ValuePlanFactory::instance().type_for(value_meta->element_type);
                 ListBuilder builder{element_binding};
-                for (const Str &part : parts) { builder.push_back(part); }
+                for (const std::string_view part : parts) { builder.push_back(Str{part}); }
                 result = builder.build();
             }
             else
@@ -322,7 +380,7 @@ namespace hgraph::stdlib
                     BundleBuilder builder{ValuePlanFactory::instance().type_for(value_meta)};
                     for (std::size_t index = 0; index < fixed; ++index)
                     {
-                        builder.set(index, Value{parts[index]});
+                        builder.set(index, Value{Str{parts[index]}});
                     }
                     result = builder.build();
                 }
@@ -356,13 +414,19 @@ namespace hgraph::stdlib
          *     wire<stdlib::split, TSL<TS<Str>, 2>>(w, s, Str{","})
          */
         static void eval(In<"s", TS<Str>> s, Scalar<"separator", Str> separator,
-                         Out<TSL<TS<Str>, SIZE<"N">>> out)
+                         State<string_impl_detail::StringBufferState> state, Out<TSL<TS<Str>, SIZE<"N">>> out)
         {
-            const std::vector<Str> parts = string_impl_detail::split_parts(s.value(), separator.value(), out.size());
-            for (std::size_t i = 0; i < parts.size(); ++i)
+            auto &current = state.mutable_value();
+            string_impl_detail::split_parts(string_impl_detail::str_value(s), separator.value(), out.size(),
+                                            current.parts);
+            for (std::size_t i = 0; i < current.parts.size(); ++i)
             {
                 auto child = out[i];
-                if (!child.valid() || child.value().template checked_as<Str>() != parts[i]) { child.set(parts[i]); }
+                if (!child.valid() || child.value().template checked_as<Str>() != current.parts[i])
+                {
+                    current.buffer.assign(current.parts[i]);
+                    string_impl_detail::set_str(child, current.buffer);
+                }
             }
         }
     };
@@ -431,10 +495,12 @@ namespace hgraph::stdlib
         }
 
         static void eval(In<"ts", TS<ScalarVar<"T">>> ts, Scalar<"separator", Str> separator,
-                         Scalar<"__strict__", Bool> strict, Out<TS<Str>> out)
+                         Scalar<"__strict__", Bool> strict, State<string_impl_detail::StringBufferState> state,
+                         Out<TS<Str>> out)
         {
             static_cast<void>(strict);
-            Str  joined;
+            Str &joined = state.mutable_value().buffer;
+            joined.clear();
             bool first = true;
             const auto values = ts.base().value().as_list();
             for (const ValueView &item : values)
@@ -443,16 +509,18 @@ namespace hgraph::stdlib
                 joined += item.checked_as<Str>();
                 first = false;
             }
-            out.set(joined);
+            string_impl_detail::set_str(out, joined);
         }
     };
 
     struct join_tsl_impl
     {
         static void eval(In<"strings", TSL<TS<Str>, SIZE<"N">>, InputValidity::Unchecked> strings,
-                         Scalar<"separator", Str> separator, Scalar<"__strict__", Bool> strict, Out<TS<Str>> out)
+                         Scalar<"separator", Str> separator, Scalar<"__strict__", Bool> strict,
+                         State<string_impl_detail::StringBufferState> state, Out<TS<Str>> out)
         {
-            Str  joined;
+            Str &joined = state.mutable_value().buffer;
+            joined.clear();
             bool first = true;
             for (std::size_t i = 0; i < strings.size(); ++i)
             {
@@ -463,10 +531,10 @@ namespace hgraph::stdlib
                     continue;
                 }
                 if (!first) { joined += separator.value(); }
-                joined += item.value();
+                joined += string_impl_detail::str_value(item);
                 first = false;
             }
-            out.set(joined);
+            string_impl_detail::set_str(out, joined);
         }
 
         static std::vector<std::pair<std::string_view, Value>> defaults()
@@ -482,21 +550,23 @@ namespace hgraph::stdlib
         static void eval(In<"fmt", TS<Str>> fmt,
                          In<"__args__", Kwargs<>, InputValidity::Unchecked> args,
                          Scalar<"__pos_count__", Int> pos_count, Scalar<"__sample__", Int> sample,
-                         Scalar<"__strict__", Bool> strict, State<Int> count, Out<TS<Str>> out)
+                         Scalar<"__strict__", Bool> strict, State<string_impl_detail::FormatState> state,
+                         Out<TS<Str>> out)
         {
             const bool require_all = strict.value();
             if (require_all && !args.all_valid()) { return; }
 
+            auto &current = state.mutable_value();
             if (sample.value() > 1)
             {
-                const Int next = count.get() + 1;
-                count.set(next);
-                if (next % sample.value() != 0) { return; }
+                if (++current.count % sample.value() != 0) { return; }
             }
 
-            const string_impl_detail::FormatValues values =
-                string_impl_detail::collect_format_values(args, static_cast<std::size_t>(pos_count.value()), require_all);
-            out.set(string_impl_detail::render_format_string(fmt.value(), values.positional, values.named));
+            string_impl_detail::collect_format_values(args, static_cast<std::size_t>(pos_count.value()), require_all,
+                                                      current.values);
+            string_impl_detail::render_format_string(current.buffer, string_impl_detail::str_value(fmt),
+                                                     current.values);
+            string_impl_detail::set_str(out, current.buffer);
         }
     };
 
@@ -505,16 +575,17 @@ namespace hgraph::stdlib
         static constexpr auto name = "format";
 
         static void eval(In<"fmt", TS<Str>> fmt, Scalar<"__sample__", Int> sample, Scalar<"__strict__", Bool> strict,
-                         State<Int> count, Out<TS<Str>> out)
+                         State<string_impl_detail::FormatState> state, Out<TS<Str>> out)
         {
             static_cast<void>(strict);
+            auto &current = state.mutable_value();
             if (sample.value() > 1)
             {
-                const Int next = count.get() + 1;
-                count.set(next);
-                if (next % sample.value() != 0) { return; }
+                if (++current.count % sample.value() != 0) { return; }
             }
-            out.set(string_impl_detail::render_format_string(fmt.value(), {}, {}));
+            string_impl_detail::render_format_string(current.buffer, string_impl_detail::str_value(fmt),
+                                                     current.values);
+            string_impl_detail::set_str(out, current.buffer);
         }
     };
 
@@ -578,4 +649,31 @@ namespace hgraph::stdlib
     void register_string_operators();
 }  // namespace hgraph::stdlib
 
+namespace hgraph::static_schema_detail
+{
+    template <>
+    struct scalar_name<stdlib::string_impl_detail::CompiledRegex>
+    {
+        static constexpr std::string_view value{"stdlib.compiled_regex"};
+    };
+
+    template <>
+    struct scalar_name<stdlib::string_impl_detail::ReplaceState>
+    {
+        static constexpr std::string_view value{"stdlib.replace_state"};
+    };
+
+    template <>
+    struct scalar_name<stdlib::string_impl_detail::StringBufferState>
+    {
+        static constexpr std::string_view value{"stdlib.string_buffer_state"};
+    };
+
+    template <>
+    struct scalar_name<stdlib::string_impl_detail::FormatState>
+    {
+        static constexpr std::string_view value{"stdlib.format_state"};
+    };
+}  // namespace hgraph::static_schema_detail
+
 #endif  // HGRAPH_LIB_STD_OPERATORS_IMPL_STRING_IMPL_H
@@ -384,6 +384,9 @@ namespace hgraph::stdlib
 
     namespace time_range_detail
     {
+        /** The pending window-boundary wake-up. */
+        inline const SchedulerTag next_tag{"_next"};
+
         /** Publish + schedule for the [start, end] window at ``et``. */
         inline CmpResult classify_and_schedule(DateTime start, DateTime end, DateTime et,
                                                const NodeScheduler &scheduler)
@@ -394,17 +397,17 @@ namespace hgraph::stdlib
             }
             if (et < start)
             {
-                scheduler.schedule(start, "_next");
+                scheduler.schedule(start, next_tag);
                 return CmpResult::LT;
             }
             if (et <= end)
             {
-                scheduler.schedule(end + MIN_TD, "_next");
+                scheduler.schedule(end + MIN_TD, next_tag);
                 return CmpResult::EQ;
             }
             // Past the window: clear any pending boundary wake-up (the end
             // may have moved backwards).
-            scheduler.un_schedule("_next");
+            scheduler.un_schedule(next_tag);
             return CmpResult::GT;
         }
 
@@ -462,17 +465,17 @@ namespace hgraph::stdlib
             }
             if (now < start)
             {
-                scheduler.schedule(start, "_next");
+                scheduler.schedule(start, time_range_detail::next_tag);
                 out.set(CmpResult::LT);
             }
             else if (now <= end)
             {
-                scheduler.schedule(end + MIN_TD, "_next");
+                scheduler.schedule(end + MIN_TD, time_range_detail::next_tag);
                 out.set(CmpResult::EQ);
             }
             else
             {
-                scheduler.schedule(start + day, "_next");
+                scheduler.schedule(start + day, time_range_detail::next_tag);
                 out.set(CmpResult::LT);
             }
         }
@@ -792,11 +795,13 @@ namespace hgraph::stdlib
     {
         static constexpr bool schedule_on_start = true;
 
+        static inline const SchedulerTag reset_tag{"reset"};
+
         static void eval(In<"ts", SIGNAL, InputValidity::Unchecked> ts, NodeScheduler scheduler, Out<TS<Bool>> out)
         {
             const Bool is_modified = ts.modified();
             out.set(is_modified);
-            if (is_modified) { scheduler.schedule(MIN_TD, std::string{"reset"}); }
+            if (is_modified) { scheduler.schedule(MIN_TD, reset_tag); }
         }
     };
 
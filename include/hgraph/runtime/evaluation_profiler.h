@@ -5,13 +5,59 @@
 #include <hgraph/runtime/lifecycle_observer.h>
 #include <hgraph/util/date_time.h>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace hgraph {
+class EvaluationProfiler;
+
+/**
+ * Log-linear latency histogram in the HDR style.
+ *
+ * Each power of two of nanoseconds is split into ``sub_bucket_count`` linear
+ * sub-buckets, so a reported percentile is within 1/16 of the recorded value
+ * at any magnitude while recording stays a bit scan and one increment.
+ * Samples above ``2^max_value_bits`` ns (about 18 minutes) share the last
+ * bucket; ``max`` is always exact.
+ */
+class HGRAPH_EXPORT EvaluationLatencyHistogram {
+public:
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr std::size_t sub_bucket_bits = 4;
+  static constexpr std::size_t sub_bucket_count = std::size_t{1}
+                                                  << sub_bucket_bits;
+  static constexpr std::size_t max_value_bits = 40;
+  static constexpr std::size_t bucket_count =
+      (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+  void record(Duration value) noexcept;
+  void merge(const EvaluationLatencyHistogram &other) noexcept;
+  void clear() noexcept;
+
+  [[nodiscard]] std::uint64_t count() const noexcept { return count_; }
+  [[nodiscard]] Duration max() const noexcept { return max_; }
+  /** Smallest recorded bucket bound covering ``fraction`` of the samples;
+   * zero when empty. */
+  [[nodiscard]] Duration percentile(double fraction) const noexcept;
+  [[nodiscard]] Duration p50() const noexcept { return percentile(0.50); }
+  [[nodiscard]] Duration p99() const noexcept { return percentile(0.99); }
+  [[nodiscard]] Duration p999() const noexcept { return percentile(0.999); }
+
+private:
+  friend class EvaluationProfiler;
+
+  std::array<std::uint64_t, bucket_count> buckets_{};
+  std::uint64_t count_{0};
+  Duration max_{0};
+};
+
 /** Aggregate timings for one lifecycle phase of one graph or node. */
 struct HGRAPH_EXPORT EvaluationProfilePhase {
   std::uint64_t count{0};
@@ -21,6 +67,21 @@ struct HGRAPH_EXPORT EvaluationProfilePhase {
   TimeDelta recent_time{0};
 };
 
+/** Hardware counter totals over one entry's measured evaluations. */
+struct HGRAPH_EXPORT EvaluationHardwareCounters {
+  std::uint64_t cycles{0};
+  std::uint64_t instructions{0};
+  std::uint64_t llc_misses{0};
+  std::uint64_t branch_misses{0};
+
+  /** Instructions per cycle; zero before any cycle is counted. */
+  [[nodiscard]] double ipc() const noexcept {
+    return cycles == 0 ? 0.0
+                       : static_cast<double>(instructions) /
+                             static_cast<double>(cycles);
+  }
+};
+
 /** Owned profile entry. No runtime graph/node pointer escapes into a snapshot.
  */
 struct HGRAPH_EXPORT EvaluationProfileEntry {
@@ -30,17 +91,40 @@ struct HGRAPH_EXPORT EvaluationProfileEntry {
   EvaluationProfilePhase start{};
   EvaluationProfilePhase evaluation{};
   EvaluationProfilePhase stop{};
+  /** Evaluation-time distribution; present for nodes when
+   * ``EvaluationProfilerOptions::node_histograms`` is set. */
+  std::optional<EvaluationLatencyHistogram> evaluation_latency{};
+  /** Evaluation hardware counters; present when
+   * ``EvaluationProfilerOptions::hardware_counters`` is set and the counters
+   * could be opened. A graph's counts include its nodes. */
+  std::optional<EvaluationHardwareCounters> hardware_counters{};
 };
 
 /** Immutable, self-contained profile captured from an EvaluationProfiler. */
 struct HGRAPH_EXPORT EvaluationProfileSnapshot {
   std::uint64_t graph_cycles{0};
+  /** Root cycles that were measured; equals ``graph_cycles`` unless
+   * ``EvaluationProfilerOptions::sample_every`` is above one. */
+  std::uint64_t sampled_cycles{0};
   TimeDelta wall_time{0};
   TimeDelta root_evaluation_time{0};
   TimeDelta scheduling_lag_total{0};
   TimeDelta scheduling_lag_max{0};
   std::uint64_t scheduling_lag_samples{0};
   double runtime_load{0.0};
+  /** Root evaluation-cycle durations. */
+  EvaluationLatencyHistogram cycle_duration{};
+  /** ``PushSourceSender::send`` to the push-source evaluation that applied
+   * the value. */
+  EvaluationLatencyHistogram push_queue_dwell{};
+  /** Oldest value pushed into a root cycle to each sink evaluated in that
+   * cycle: the end-to-end push-to-output latency. */
+  EvaluationLatencyHistogram push_to_sink{};
+  /** Hardware counters were requested and opened on the evaluation thread. */
+  bool hardware_counters_available{false};
+  /** Why requested hardware counters are unavailable, or which of them read
+      as zero; empty when all four opened. */
+  std::string hardware_counters_error{};
   std::vector<EvaluationProfileEntry> entries{};
 };
 
@@ -52,6 +136,21 @@ struct HGRAPH_EXPORT EvaluationProfilerOptions {
   bool node{true};
   bool graph{true};
   std::size_t recent_window{100};
+  /** Keep the run-wide latency histograms (cycle, push dwell and
+   * push-to-sink); requires ``eval``. */
+  bool histograms{true};
+  /** Also keep an evaluation-latency histogram per profiled node (about
+   * 4.6 KB each); requires ``eval`` and ``node``. */
+  bool node_histograms{false};
+  /** Measure one root cycle in ``sample_every``; the others only count
+   * towards ``graph_cycles``. Zero is treated as one. */
+  std::size_t sample_every{1};
+  /** Attribute cycles, instructions, LLC misses and branch misses to each
+   * evaluation through Linux ``perf_event_open``. Two counter reads per
+   * evaluation make this much heavier than timing alone; combine with
+   * ``sample_every``. Falls back to timing only when counters are
+   * unavailable. */
+  bool hardware_counters{false};
 };
 
 /**
@@ -63,6 +162,19 @@ struct HGRAPH_EXPORT EvaluationProfilerOptions {
  * leave borrowed diagnostic pointers behind. Copies share one measurement
  * state; this lets a Python-facing profiler remain inspectable when the run
  * owns its observer copy.
+ *
+ * Push latency is linked through the push-source inspection contract: each
+ * push source reports the sender-side enqueue stamp of what it applied
+ * (``NodeInspectionMetrics::applied_enqueue_time``), and the oldest stamp in
+ * a root cycle is carried to every sink that cycle evaluates.
+ *
+ * The evaluation path takes no lock: each running graph resolves its nodes
+ * to entries once, at start, into a slot array indexed by node index, and
+ * counters have the evaluation thread as their only writer. One profiler
+ * therefore observes one run at a time. A ``reset`` during a run is applied
+ * before the next root cycle. With ``sample_every`` above one, phase counts,
+ * times and histograms cover the sampled cycles only, while
+ * ``runtime_load`` is scaled up to every cycle.
  */
 class HGRAPH_EXPORT EvaluationProfiler final : public LifecycleObserver {
 public:
@@ -71,7 +183,11 @@ public:
   explicit EvaluationProfiler(EvaluationProfilerOptions options = {});
   explicit EvaluationProfiler(bool start, bool eval = true, bool stop = true,
                               bool node = true, bool graph = true,
-                              std::size_t recent_window = 100);
+                              std::size_t recent_window = 100,
+                              bool histograms = true,
+                              std::size_t sample_every = 1,
+                              bool hardware_counters = false,
+                              bool node_histograms = false);
 
   [[nodiscard]] EvaluationProfileSnapshot snapshot() const;
   void reset();
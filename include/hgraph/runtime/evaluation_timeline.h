@@ -0,0 +1,94 @@
+#ifndef HGRAPH_RUNTIME_EVALUATION_TIMELINE_H
+#define HGRAPH_RUNTIME_EVALUATION_TIMELINE_H
+
+#include <hgraph/hgraph_export.h>
+#include <hgraph/runtime/lifecycle_observer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+
+namespace hgraph
+{
+    /** Select what an :cpp:class:`EvaluationTimeline` records. */
+    struct HGRAPH_EXPORT EvaluationTimelineOptions
+    {
+        /** Spans retained, rounded up to a power of two; older spans are overwritten. */
+        std::size_t capacity{std::size_t{1} << 20};
+        bool        node{true};
+        bool        graph{true};
+        /** Record graph and node start/stop spans as well as evaluation. */
+        bool        lifecycle{true};
+    };
+
+    /**
+     * Native evaluation timeline recorder.
+     *
+     * Records one complete span per graph evaluation (root cycles and every
+     * nested child graph of ``map_``, ``switch_``, ``mesh_``, ``reduce`` and
+     * friends) and per node evaluation, start and stop. Push-source
+     * evaluations are marked as queue drains and carry the dwell of the oldest
+     * value they applied. Names are resolved when an entity starts; a span
+     * costs two monotonic clock reads and one fixed-size ring store, and the
+     * ring is allocated once when the first root graph starts.
+     *
+     * ``write_chrome_trace`` emits Chrome trace-event JSON, which the Perfetto
+     * UI and ``chrome://tracing`` load directly. Spans nest by time on one
+     * track, so a slow cycle reads as its graph, child graph and node
+     * breakdown. The recorder observes one run at a time and is written when
+     * that run is not active. Copies share the recording, so a Python-facing
+     * timeline stays writable when the run owns its observer copy.
+     */
+    class HGRAPH_EXPORT EvaluationTimeline final : public LifecycleObserver
+    {
+      public:
+        struct State;
+
+        explicit EvaluationTimeline(EvaluationTimelineOptions options = {});
+        explicit EvaluationTimeline(std::size_t capacity, bool node = true, bool graph = true,
+                                    bool lifecycle = true);
+
+        /** Spans currently retained. */
+        [[nodiscard]] std::size_t size() const;
+        /** Spans overwritten because the ring was full. */
+        [[nodiscard]] std::uint64_t dropped() const;
+        /**
+         * Distinct span names held. Names are structural, so every key of a
+         * nested operator shares its template's names and the count is fixed
+         * by the graph shape. Throws ``std::logic_error`` during a run.
+         */
+        [[nodiscard]] std::size_t name_count() const;
+        /** Discard every recorded span. Throws ``std::logic_error`` during a run. */
+        void clear();
+
+        /** Write Chrome trace-event JSON. Throws ``std::logic_error`` during a run. */
+        void write_chrome_trace(std::ostream &out) const;
+        /** Write Chrome trace-event JSON to ``path``, replacing it. */
+        void write_chrome_trace(const std::filesystem::path &path) const;
+
+        void on_before_start_graph(const GraphView &graph) override;
+        void on_after_start_graph(const GraphView &graph) override;
+        void on_start_graph_failed(const GraphView &graph) override;
+        void on_before_start_node(const NodeView &node) override;
+        void on_after_start_node(const NodeView &node) override;
+        void on_start_node_failed(const NodeView &node) override;
+        void on_before_graph_evaluation(const GraphView &graph) override;
+        void on_after_graph_evaluation(const GraphView &graph) override;
+        void on_before_node_evaluation(const NodeView &node) override;
+        void on_after_node_evaluation(const NodeView &node) override;
+        void on_before_stop_node(const NodeView &node) override;
+        void on_after_stop_node(const NodeView &node) override;
+        void on_stop_node_failed(const NodeView &node) override;
+        void on_before_stop_graph(const GraphView &graph) override;
+        void on_after_stop_graph(const GraphView &graph) override;
+        void on_stop_graph_failed(const GraphView &graph) override;
+
+      private:
+        EvaluationTimelineOptions options_{};
+        std::shared_ptr<State>    state_{};
+    };
+}  // namespace hgraph
+
+#endif  // HGRAPH_RUNTIME_EVALUATION_TIMELINE_H
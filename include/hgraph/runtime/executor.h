@@ -11,6 +11,7 @@
 #include <hgraph/runtime/executor_type_ref.h>
 #include <hgraph/runtime/graph.h>
 #include <hgraph/runtime/node_error.h>
+#include <hgraph/types/utils/graph_arena.h>
 
 #include <functional>
 #include <memory>
@@ -43,6 +44,43 @@ namespace hgraph
         RealTime,
     };
 
+    /**
+     * Where an executor run allocates its plan-driven runtime storage (graph
+     * and node storage, outputs, state, dynamic TSD/TSL slots, nested
+     * graphs).
+     */
+    enum class GraphAllocatorPolicy : std::uint8_t
+    {
+        /** The process-wide aligned ``new`` / ``delete`` pair. */
+        Heap,
+        /** A ``GraphArena`` owned by the executor and released with it. */
+        Arena,
+    };
+
+    /**
+     * How a ``RealTime`` run waits between cycles. The defaults park the
+     * evaluation thread on a condition variable as soon as it has nothing to
+     * do. A non-zero ``spin_budget`` spends a core on lower wake-up latency:
+     * the loop busy-polls the wall clock and the push-pending flag for that
+     * long after each cycle, parks only once the budget is spent, and wakes
+     * ``spin_budget`` ahead of a scheduled time to spin the remainder.
+     */
+    struct HGRAPH_EXPORT RealTimeWaitOptions
+    {
+        /** Busy-poll window after each cycle and ahead of each scheduled wake-up. */
+        TimeDelta spin_budget{0};
+        /** CPU the evaluation thread is pinned to for the run; negative leaves affinity alone (Linux only). */
+        int pin_cpu{-1};
+        /**
+         * Longest a run of back-to-back ``MIN_TD`` cycles goes without
+         * stopping at the wait point to let push sources and the wall clock
+         * catch up.
+         */
+        TimeDelta push_window{15'000'000};
+
+        [[nodiscard]] bool operator==(const RealTimeWaitOptions &) const noexcept = default;
+    };
+
     /** Complete root-executor phases that may be wrapped by an embedding
         runtime. Native executors have no wrapper by default. */
     enum class GraphExecutorPhase : std::uint8_t
@@ -133,6 +171,8 @@ namespace hgraph
         LifecycleObserverList *(*lifecycle_observers_impl)(const void *context, void *memory) noexcept = nullptr;
         /** Borrowed run logger; owned by the executor storage. */
         spdlog::logger *(*logger_impl)(const void *context, void *memory) noexcept = nullptr;
+        /** The run's arena; null under ``GraphAllocatorPolicy::Heap``. */
+        const GraphArena *(*arena_impl)(const void *context, const void *memory) noexcept = nullptr;
         bool (*run_logging_enabled_impl)(const void *context,
                                          const void *memory) noexcept = nullptr;
         ErrorCaptureOptions (*error_capture_options_impl)(
@@ -236,6 +276,8 @@ namespace hgraph
         [[nodiscard]] LifecycleObserverList &lifecycle_observers() const;
         /** Borrowed logger configured for this run. */
         [[nodiscard]] spdlog::logger *logger() const noexcept;
+        /** The arena backing this run's storage; null under ``GraphAllocatorPolicy::Heap``. */
+        [[nodiscard]] const GraphArena *arena() const noexcept;
         [[nodiscard]] bool run_logging_enabled() const noexcept;
         /** Detail included when a node exception escapes the root graph. */
         [[nodiscard]] ErrorCaptureOptions error_capture_options() const noexcept;
@@ -315,6 +357,17 @@ namespace hgraph
         GraphExecutorBuilder &max_consecutive_immediate_cycles(std::uint32_t limit) noexcept;
         /** Register a lifecycle observer for this executor's run (see ``LifecycleObserver``). */
         GraphExecutorBuilder &add_lifecycle_observer(LifecycleObserver *observer);
+        /**
+         * Choose where each executor built from this recipe allocates its
+         * runtime storage. Under ``Arena`` every executor gets its own
+         * ``GraphArena`` of ``arena_chunk_bytes`` chunks; the root graph and
+         * every nested graph it creates allocate from it, and it is released
+         * in one step when the executor is destroyed.
+         */
+        GraphExecutorBuilder &allocator_policy(GraphAllocatorPolicy policy,
+                                               std::size_t arena_chunk_bytes = GraphArena::default_chunk_bytes) noexcept;
+        /** Tune how a ``RealTime`` run waits for work (ignored in ``Simulation``). */
+        GraphExecutorBuilder &realtime_wait_options(RealTimeWaitOptions options) noexcept;
 
         [[nodiscard]] std::string_view label() const noexcept;
         [[nodiscard]] const GraphBuilder &graph_builder() const noexcept;
@@ -327,6 +380,9 @@ namespace hgraph
         [[nodiscard]] const GraphExecutorPhaseRunner &phase_runner() const noexcept;
         [[nodiscard]] std::uint32_t max_consecutive_immediate_cycles() const noexcept;
         [[nodiscard]] const std::vector<LifecycleObserver *> &lifecycle_observers() const noexcept;
+        [[nodiscard]] GraphAllocatorPolicy allocator_policy() const noexcept;
+        [[nodiscard]] std::size_t arena_chunk_bytes() const noexcept;
+        [[nodiscard]] const RealTimeWaitOptions &realtime_wait_options() const noexcept;
         [[nodiscard]] GraphTypeRef graph_type() const;
         [[nodiscard]] ExecutorTypeRef type() const;
         [[nodiscard]] GraphExecutorValue make_executor() const;
@@ -345,6 +401,9 @@ namespace hgraph
         GraphExecutorPhaseRunner        phase_runner_{};
         std::uint32_t                   max_consecutive_immediate_cycles_{0};
         std::vector<LifecycleObserver *> lifecycle_observers_{};
+        GraphAllocatorPolicy             allocator_policy_{GraphAllocatorPolicy::Heap};
+        std::size_t                      arena_chunk_bytes_{GraphArena::default_chunk_bytes};
+        RealTimeWaitOptions              realtime_wait_options_{};
         mutable ExecutorTypeRef          type_{};
     };
 
@@ -43,6 +43,68 @@ namespace hgraph
         Nested,
     };
 
+    /**
+     * How a graph finds the nodes due in a cycle.
+     *
+     * ``Scan`` (the default) walks every node index in rank order and tests
+     * its schedule entry. ``ActiveSet`` additionally keeps a rank-ordered
+     * bitmap of nodes holding a current or future schedule, fed by
+     * ``schedule_node``; the evaluation loop then visits only those nodes,
+     * so a wide graph with sparse activity pays per scheduled node rather
+     * than per node. Both modes preserve rank order and the pause/resume
+     * cursor. Selected on the root ``GraphBuilder``; nested graphs inherit
+     * their parent graph's mode.
+     *
+     * ``LevelParallel`` (root graphs only) groups nodes by dependency level
+     * — the longest edge path from a source, computed once when the graph is
+     * built — and evaluates the due nodes of one level concurrently on the
+     * shared evaluation pool before moving to the next. Python nodes, nodes
+     * using ``GlobalState`` or the phase runner, push sources, nested nodes,
+     * nodes with REF inputs or outputs, and framework nodes sharing state
+     * across nodes (services, shared outputs) stay on the engine thread.
+     * Ordering comes from graph edges alone, so graphs that couple user
+     * nodes outside edges (contexts) should keep ``Scan``. The level runs
+     * serially while lifecycle observers are attached or pooled compound
+     * scalar storage is in use; nested graphs of a level-parallel root use
+     * ``Scan``.
+     *
+     * ``TimingWheel`` (root graphs only) files every future schedule in a
+     * hierarchical timing wheel (microsecond slots, 64 per level, coarser
+     * levels above) and keeps the active set for the current cycle only. A
+     * cycle takes its due nodes from the wheel and reads the next scheduled
+     * time off it, so neither depends on how many nodes hold schedules
+     * further out. Suited to roots with many sparse future alarms; nested
+     * graphs of such a root use ``ActiveSet``.
+     */
+    enum class GraphSchedulingMode : std::uint8_t
+    {
+        Scan,
+        ActiveSet,
+        LevelParallel,
+        TimingWheel,
+    };
+
+    /**
+     * How a graph's storage block is laid out.
+     *
+     * ``Interleaved`` (the default) places the graph header, then every
+     * node's storage in rank order, then the per-node schedule array.
+     * ``HotCold`` hoists the data the evaluation loop touches for every node
+     * — the schedule array and a dense array of node pointers (each carrying
+     * the node's ops and storage address) — up against the header, ahead of
+     * the node storage blocks. The per-cycle scan then walks two contiguous
+     * arrays instead of reaching past every node block, and resolving a due
+     * node is one load rather than a type-table lookup. Within each node
+     * block cold fields (label, error output, recordable state) already sit
+     * behind the hot ones. Applies to the root and nested types built from
+     * this builder.
+     */
+    enum class GraphNodeLayout : std::uint8_t
+    {
+        Interleaved,
+        HotCold,
+    };
+
     /** Root output endpoint for a graph edge source. */
     enum class GraphEdgeSourceKind : std::uint8_t
     {
@@ -139,6 +201,9 @@ struct HGRAPH_EXPORT GraphEdge
         bool (*evaluate_impl)(const void *context, const GraphView &graph, DateTime evaluation_time) = nullptr;
         void (*schedule_node_impl)(const void *context, const GraphView &graph, std::size_t node_index,
                                    DateTime when) = nullptr;
+        /** Overwrite one schedule entry (checkpoint restore); a nested entry also wakes the parent. */
+        void (*restore_node_schedule_impl)(const void *context, const GraphView &graph, std::size_t node_index,
+                                           DateTime when) = nullptr;
 
         bool (*started_impl)(const void *context, const void *memory) noexcept = nullptr;
         bool (*evaluating_impl)(const void *context, const void *memory) noexcept = nullptr;
@@ -171,6 +236,10 @@ struct HGRAPH_EXPORT GraphEdge
                                                                   const void *memory) noexcept = nullptr;
         /** Cached borrowed pointer to the executor-owned run logger. */
         spdlog::logger *(*logger_impl)(const void *context, const void *memory) noexcept = nullptr;
+        GraphSchedulingMode (*scheduling_mode_impl)(const void *context, const void *memory) noexcept = nullptr;
+        /** Allocator the graph's storage binds to; nested graphs share their root's. */
+        const MemoryUtils::AllocatorOps *(*allocator_impl)(const void *context,
+                                                          const void *memory) noexcept = nullptr;
     };
 
     /** Borrowed type-erased view over graph runtime storage. */
@@ -239,10 +308,18 @@ struct HGRAPH_EXPORT GraphEdge
         [[nodiscard]] LifecycleObserverList &lifecycle_observers() const;
         /** Borrowed executor-owned logger, cached by root and nested graphs. */
         [[nodiscard]] spdlog::logger *logger() const noexcept;
+        /**
+         * The allocator this graph's plan-driven storage binds to: the run's
+         * ``GraphArena`` under ``GraphAllocatorPolicy::Arena``, otherwise the
+         * process default. Nested graphs are built under the same allocator.
+         */
+        [[nodiscard]] const MemoryUtils::AllocatorOps &allocator() const noexcept;
         /** Closed Bundle hierarchy snapshot used by this graph instance. */
         [[nodiscard]] const TypeRealizationSnapshot *type_realization() const noexcept;
         /** Root-owned graph-local storage shared by all nested graphs. */
         [[nodiscard]] CompoundScalarStorageView compound_scalar_storage() const noexcept;
+        /** How this graph instance finds due nodes (see ``GraphSchedulingMode``). */
+        [[nodiscard]] GraphSchedulingMode scheduling_mode() const noexcept;
 
         void start(DateTime start_time = MIN_ST) const;
         void stop() const;
@@ -259,6 +336,15 @@ struct HGRAPH_EXPORT GraphEdge
 
         /** The graph-schedule entry for one node (``MIN_DT`` = not scheduled). */
         [[nodiscard]] DateTime node_scheduled_time(std::size_t node_index) const noexcept;
+        /**
+         * Overwrite one node's graph-schedule entry (``MIN_DT`` clears it).
+         * Unlike ``schedule_node`` this can move an entry later or drop it,
+         * so it is reserved for checkpoint restore (see graph_checkpoint.h)
+         * between start and the first evaluation. On a nested child a kept
+         * entry also schedules the parent node, as an out-of-band schedule
+         * does. Throws while the graph is evaluating or for a time in the past.
+         */
+        void restore_node_schedule(std::size_t node_index, DateTime when) const;
 
         /**
          * Human-readable snapshot of the graph for diagnostics: the graph name
@@ -396,6 +482,17 @@ struct HGRAPH_EXPORT GraphEdge
         /** The trait store (a value-layer ``Map<string, Any>``, like ``GlobalState``). */
         [[nodiscard]] GlobalStateView traits() noexcept;
 
+        /**
+         * Select the per-cycle scheduling strategy (see
+         * ``GraphSchedulingMode``). Applies to root graphs built from this
+         * builder; nested graphs follow their parent graph instead.
+         */
+        GraphBuilder &scheduling_mode(GraphSchedulingMode mode) noexcept;
+        [[nodiscard]] GraphSchedulingMode scheduling_mode() const noexcept;
+        /** Select the storage layout (see ``GraphNodeLayout``); changes the graph types. */
+        GraphBuilder &node_layout(GraphNodeLayout layout) noexcept;
+        [[nodiscard]] GraphNodeLayout node_layout() const noexcept;
+
         [[nodiscard]] std::string_view label() const noexcept;
         [[nodiscard]] std::size_t node_count() const noexcept;
         [[nodiscard]] const std::vector<NodeBuilder> &nodes() const noexcept;
@@ -415,6 +512,16 @@ struct HGRAPH_EXPORT GraphEdge
         [[nodiscard]] GraphValue make_nested_graph(NodePtr parent_node,
                                                    void *external_memory,
                                                    MemoryUtils::StorageLayout available_layout) const;
+        /**
+         * Return a stopped in-place nested graph of this builder to its
+         * just-built state: every node's storage is reconstructed where it
+         * sits, schedules are cleared and the internal edges rebound, while
+         * the header, traits and scheduling structures are kept. Keyed
+         * parents use it to recycle child graphs under key churn. When a
+         * node fails to rebuild the graph is destroyed, ``graph`` is left
+         * empty and the exception propagates.
+         */
+        void reset_nested_graph(GraphValue &graph) const;
 
       private:
         friend class GraphValue;
@@ -426,6 +533,8 @@ struct HGRAPH_EXPORT GraphEdge
         std::vector<GraphEdge>        edges_{};
         GlobalState                   global_state_{};
         GlobalState                   traits_{};   // trait store: same value-layer Map<string, Any> shape
+        GraphSchedulingMode           scheduling_mode_{GraphSchedulingMode::Scan};
+        GraphNodeLayout               node_layout_{GraphNodeLayout::Interleaved};
         mutable GraphTypeRef          root_type_{};
         mutable GraphTypeRef          nested_type_{};
         mutable bool                  types_compiled_{false};
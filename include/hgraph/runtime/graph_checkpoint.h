@@ -0,0 +1,240 @@
+#ifndef HGRAPH_RUNTIME_GRAPH_CHECKPOINT_H
+#define HGRAPH_RUNTIME_GRAPH_CHECKPOINT_H
+
+#include <hgraph/hgraph_export.h>
+#include <hgraph/runtime/lifecycle_observer.h>
+#include <hgraph/types/static_schema.h>
+#include <hgraph/types/value/value.h>
+#include <hgraph/util/date_time.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace hgraph
+{
+    class GraphView;
+
+    /** Select how a checkpoint treats nodes whose runtime state it cannot capture. */
+    struct HGRAPH_EXPORT GraphCheckpointOptions
+    {
+        /**
+         * Leave unsupported nodes to start fresh instead of throwing. A node
+         * is unsupported when it owns nested child graphs other than a
+         * ``map_`` child set (``mesh_``, ``switch_``, ``reduce`` and
+         * friends), has a REF or window output, or keeps state with no
+         * serialized form. Every node downstream of a skipped node, through
+         * any chain of edges, starts fresh as well, so a restore never pairs
+         * restored state with a reset input. Inside a ``map_`` child the same
+         * rule applies per child graph.
+         */
+        bool skip_unsupported{false};
+    };
+
+    /** What a checkpoint write or restore covered. */
+    struct HGRAPH_EXPORT GraphCheckpointInfo
+    {
+        /** Evaluation time of the cycle the checkpoint was taken after. */
+        DateTime    evaluation_time{MIN_DT};
+        std::size_t nodes{0};
+        /** Nodes left fresh under ``skip_unsupported``, including those downstream of one. */
+        std::size_t skipped{0};
+        /** ``map_`` child graphs written, or staged for restore when their key is created. */
+        std::size_t child_graphs{0};
+    };
+
+    /**
+     * Byte sink a checkpoint is written through. Values go through the
+     * interned per-schema codec; ``pod`` and ``text`` carry a state codec's
+     * own fields (see ``checkpoint_state``).
+     */
+    class HGRAPH_EXPORT CheckpointWriter
+    {
+      public:
+        template <typename T>
+        void pod(const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            bytes_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void text(std::string_view value);
+        void time(DateTime value);
+        /** Write ``value`` in its schema's checkpoint form; ``logic_error`` when it has none. */
+        void value(const ValueView &value);
+        /** Write a schema by its registered name; ``logic_error`` for one that does not resolve back. */
+        void schema(const ValueTypeMetaData *schema);
+
+        [[nodiscard]] std::string       &bytes() noexcept { return bytes_; }
+        [[nodiscard]] const std::string &bytes() const noexcept { return bytes_; }
+
+      private:
+        std::string bytes_{};
+    };
+
+    /** Reads back, in order, what a ``CheckpointWriter`` wrote; ``runtime_error`` on truncated data. */
+    class HGRAPH_EXPORT CheckpointReader
+    {
+      public:
+        explicit CheckpointReader(std::string_view bytes) noexcept : bytes_(bytes) {}
+
+        template <typename T>
+        [[nodiscard]] T pod()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            require(sizeof(T));
+            T value;
+            std::memcpy(&value, bytes_.data() + offset_, sizeof(T));
+            offset_ += sizeof(T);
+            return value;
+        }
+
+        [[nodiscard]] std::string_view         text();
+        [[nodiscard]] DateTime                 time();
+        [[nodiscard]] Value                    value(const ValueTypeMetaData *schema);
+        [[nodiscard]] const ValueTypeMetaData *schema();
+
+        [[nodiscard]] bool        at_end() const noexcept { return offset_ == bytes_.size(); }
+        [[nodiscard]] std::size_t offset() const noexcept { return offset_; }
+
+        void require(std::size_t size) const;
+
+      private:
+        std::string_view bytes_{};
+        std::size_t      offset_{0};
+    };
+
+    using CheckpointStateWriteFn = void (*)(const ValueView &state, CheckpointWriter &out);
+    using CheckpointStateReadFn  = Value (*)(CheckpointReader &in);
+
+    /**
+     * Give the opaque scalar registered as ``scalar_name`` a checkpoint form.
+     * Opaque node states (ring buffers, running moments, compiled caches)
+     * have no JSON form, so without one a node keeping them is unsupported.
+     * Registrations are keyed by name and survive a type registry reset;
+     * make them before the first checkpoint of a schema.
+     */
+    HGRAPH_EXPORT void register_checkpoint_state_codec(std::string_view      scalar_name,
+                                                       CheckpointStateWriteFn write,
+                                                       CheckpointStateReadFn  read);
+
+    /**
+     * Checkpoint form of an opaque state type. Specialise with
+     * ``static void write(const T &, CheckpointWriter &)`` and
+     * ``static void read(T &, CheckpointReader &)``, where ``read`` fills a
+     * value-initialised ``T``, then call ``register_checkpoint_state<T>()``.
+     */
+    template <typename T>
+    struct checkpoint_state;
+
+    /** ``checkpoint_state`` of a cache the node rebuilds from its inputs: nothing is written, restore starts empty. */
+    template <typename T>
+    struct checkpoint_state_rebuilt
+    {
+        static void write(const T &, CheckpointWriter &) noexcept {}
+        static void read(T &, CheckpointReader &) noexcept {}
+    };
+
+    template <typename T>
+    void register_checkpoint_state()
+    {
+        register_checkpoint_state_codec(
+            static_schema_detail::scalar_name<T>::value,
+            [](const ValueView &state, CheckpointWriter &out) { checkpoint_state<T>::write(state.checked_as<T>(), out); },
+            [](CheckpointReader &in) {
+                T state{};
+                checkpoint_state<T>::read(state, in);
+                return Value{std::move(state)};
+            });
+    }
+
+    /**
+     * Write the runtime state of a started root graph at a cycle boundary.
+     *
+     * Per node the snapshot holds the graph-schedule entry, the pending
+     * ``NodeScheduler`` events, the output and recordable state (value,
+     * validity and last-modified time per static TSB/TSL leaf) and the state
+     * value. Values go through an interned per-schema codec: fixed-width
+     * atomics as raw bytes, strings length-prefixed, tuples, bundles, lists,
+     * sets and maps field by field, opaque states through their registered
+     * ``checkpoint_state`` and any other atomic as its JSON token. A
+     * ``map_`` node also writes its key set and each child graph's records.
+     * Call it between cycles or from ``on_after_graph_evaluation``.
+     * Throws ``std::logic_error`` for a graph that is not started and, unless
+     * ``skip_unsupported`` is set, for a node it cannot capture.
+     */
+    HGRAPH_EXPORT GraphCheckpointInfo write_graph_checkpoint(const GraphView &graph, std::ostream &out,
+                                                             GraphCheckpointOptions options = {});
+    /** Write the checkpoint to ``path`` through a sibling temporary, replacing it atomically. */
+    HGRAPH_EXPORT GraphCheckpointInfo write_graph_checkpoint(const GraphView &graph,
+                                                             const std::filesystem::path &path,
+                                                             GraphCheckpointOptions options = {});
+
+    /**
+     * Restore a checkpoint into a freshly started root graph of the same
+     * ``GraphTypeMetaData``, before its first evaluation.
+     *
+     * Outputs are written at their recorded modification times, so nothing
+     * downstream ticks for them; schedule entries then replace whatever the
+     * node start hooks set, moved up to the graph's start time when the
+     * checkpoint predates it. A ``map_`` node is scheduled for the first
+     * cycle and restores each saved child as it creates the child for that
+     * key; a key no longer in the restored key set drops its child. Throws
+     * ``std::runtime_error`` for a checkpoint of another graph schema or a
+     * truncated file.
+     */
+    HGRAPH_EXPORT GraphCheckpointInfo restore_graph_checkpoint(const GraphView &graph, std::istream &in);
+    HGRAPH_EXPORT GraphCheckpointInfo restore_graph_checkpoint(const GraphView &graph,
+                                                               const std::filesystem::path &path);
+
+    /** Clear the interned checkpoint value codecs (registry reset — see registry_reset.h). */
+    HGRAPH_EXPORT void clear_graph_checkpoint_codecs() noexcept;
+
+    /** Select when a :cpp:class:`GraphCheckpointer` writes and whether it restores. */
+    struct HGRAPH_EXPORT GraphCheckpointerOptions
+    {
+        /** Root cycles between checkpoints. */
+        std::size_t every_cycles{1};
+        /** Restore from the file, when it exists, as the root graph starts. */
+        bool        restore{true};
+        bool        skip_unsupported{false};
+    };
+
+    /**
+     * Periodic checkpoint recorder.
+     *
+     * Writes the root graph to one file after every ``every_cycles`` root
+     * cycles and, when the file already exists at start, restores it before
+     * the first cycle. Register it with ``GraphExecutorBuilder`` like any
+     * other lifecycle observer; nested graphs are ignored.
+     */
+    class HGRAPH_EXPORT GraphCheckpointer final : public LifecycleObserver
+    {
+      public:
+        explicit GraphCheckpointer(std::filesystem::path path, GraphCheckpointerOptions options = {});
+
+        [[nodiscard]] const std::filesystem::path &path() const noexcept { return path_; }
+        /** Checkpoints written during the current run. */
+        [[nodiscard]] std::size_t checkpoints_written() const noexcept { return written_; }
+        /** The restore performed at start, if any. */
+        [[nodiscard]] const std::optional<GraphCheckpointInfo> &restored() const noexcept { return restored_; }
+
+        void on_after_start_graph(const GraphView &graph) override;
+        void on_after_graph_evaluation(const GraphView &graph) override;
+
+      private:
+        std::filesystem::path               path_;
+        GraphCheckpointerOptions            options_{};
+        std::uint64_t                       cycles_{0};
+        std::size_t                         written_{0};
+        std::optional<GraphCheckpointInfo>  restored_{};
+    };
+}  // namespace hgraph
+
+#endif  // HGRAPH_RUNTIME_GRAPH_CHECKPOINT_H
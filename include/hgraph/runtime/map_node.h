@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <vector>
 
@@ -63,6 +64,25 @@ namespace hgraph
         const TSValueTypeMetaData *key_output_schema{nullptr};
         /** Child-terminal connection direction; ignored for sink maps. */
         MapOutputBindingMode output_binding_mode{MapOutputBindingMode::ChildTerminalWritesElement};
+        /**
+         * Evaluate the due children of a cycle concurrently on the shared
+         * child-evaluation pool, joining before the map output is published.
+         * Opt-in: the caller asserts the children are independent (no
+         * services, contexts or feedback shared between keys). Binding
+         * refresh, error capture, output finalisation and schedule
+         * bookkeeping stay on the engine thread. The map falls back to
+         * serial evaluation while lifecycle observers are attached or the
+         * children allocate from a shared compound scalar storage.
+         */
+        bool parallel_children{false};
+        /**
+         * High-water mark of stopped child graphs kept for reuse; 0 (the
+         * default) disables recycling. When a key's entry is erased its
+         * child is reset in place (node storage rebuilt, schedules cleared,
+         * internal edges rebound) and the next key created in that slot
+         * rebinds and starts it instead of building a fresh graph.
+         */
+        std::size_t recycle_child_graphs{0};
     };
 
     /** Typed extension view exposed by ``map_node`` (runtime inspection surface). */
@@ -78,6 +98,20 @@ namespace hgraph
         [[nodiscard]] std::size_t     child_graph_count() const noexcept;
         /** True when every constructed child graph resides in its stable entry slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
+        /** Stopped child graphs currently held for reuse (see ``MapNodeSpec::recycle_child_graphs``). */
+        [[nodiscard]] std::size_t     recycled_child_graph_count() const noexcept;
+
+        /** Value schema of the map's keys (the ``__keys__`` element). */
+        [[nodiscard]] const ValueTypeMetaData *key_schema() const;
+        /** Visit each started child graph with its key, in slot order. */
+        void for_each_child(const std::function<void(const ValueView &, const GraphView &)> &visit) const;
+        /**
+         * Run ``restore`` on the child graph created for ``key`` during the
+         * map's next evaluation, right after it starts (checkpoint restore;
+         * see graph_checkpoint.h). Staged keys that the next evaluation does
+         * not create are dropped.
+         */
+        void stage_child_restore(Value key, std::function<void(const GraphView &)> restore) const;
 
         /** Internal (map_node implementation) — the registered context / storage. */
         [[nodiscard]] const void *internal_context() const noexcept { return context_; }
@@ -40,6 +40,8 @@ namespace hgraph
         const TSValueTypeMetaData *key_output_schema{nullptr};
         /** Direction used when connecting the child output to the mesh output element. */
         MapOutputBindingMode output_binding_mode{MapOutputBindingMode::ChildTerminalWritesElement};
+        /** High-water mark of stopped instance graphs kept for reuse (``MapNodeSpec::recycle_child_graphs``). */
+        std::size_t recycle_child_graphs{0};
     };
 
     /**
@@ -59,6 +61,8 @@ namespace hgraph
         [[nodiscard]] std::size_t     child_graph_count() const noexcept;
         /** True when every constructed instance graph resides in its stable key slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
+        /** Stopped instance graphs currently held for reuse. */
+        [[nodiscard]] std::size_t     recycled_child_graph_count() const noexcept;
 
         /**
          * The key of the instance whose child graph is currently being evaluated.
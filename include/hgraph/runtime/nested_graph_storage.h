@@ -1,6 +1,7 @@
 #ifndef HGRAPH_RUNTIME_NESTED_GRAPH_STORAGE_H
 #define HGRAPH_RUNTIME_NESTED_GRAPH_STORAGE_H
 
+#include <hgraph/runtime/graph.h>
 #include <hgraph/types/metadata/debug_descriptor.h>
 #include <hgraph/types/utils/stable_slot_store.h>
 
@@ -11,6 +12,7 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace hgraph
 {
@@ -22,6 +24,11 @@ namespace hgraph
      * existing slots remain stable. Entry destruction owns the GraphValue
      * handle and therefore destroys the externally-placed graph before the raw
      * slot memory is released.
+     *
+     * A freed slot may instead retain its stopped, reset graph (up to
+     * ``retained_graph_limit``) for the next entry constructed there; the
+     * retained handles travel with the slots on ``swap`` and are destroyed by
+     * ``destroy_all``.
      */
     template <typename Entry>
     class InPlaceGraphSlotStore
@@ -51,6 +58,8 @@ namespace hgraph
             swap(slot_layout_, other.slot_layout_);
             swap(graph_offset_, other.graph_offset_);
             swap(bound_, other.bound_);
+            swap(retained_, other.retained_);
+            swap(retained_count_, other.retained_count_);
         }
 
         void bind_graph_layout(MemoryUtils::StorageLayout graph_layout)
@@ -101,7 +110,7 @@ namespace hgraph
         }
         [[nodiscard]] size_t live_bytes() const noexcept
         {
-            return entry_count() * slot_layout_.size;
+            return (entry_count() + retained_count_) * slot_layout_.size;
         }
         [[nodiscard]] size_t reserved_bytes() const noexcept
         {
@@ -150,9 +159,46 @@ namespace hgraph
 
         void destroy_all() noexcept
         {
+            release_retained_graphs();
             for (size_t slot = 0; slot < slot_capacity(); ++slot) { destroy_at(slot); }
         }
 
+        /** Bound the freed slots that keep their graph; 0 (the default) disables retention. */
+        void retained_graph_limit(size_t limit) noexcept { retained_limit_ = limit; }
+        [[nodiscard]] size_t retained_graph_limit() const noexcept { return retained_limit_; }
+        [[nodiscard]] size_t retained_graph_count() const noexcept { return retained_count_; }
+        [[nodiscard]] bool can_retain_graph() const noexcept { return retained_count_ < retained_limit_; }
+
+        /**
+         * Keep ``graph`` — stopped, reset and placed in ``graph_memory(slot)``
+         * — for the next entry of ``slot``. Returns false, leaving ``graph``
+         * with the caller, once the limit is reached.
+         */
+        bool retain_graph(size_t slot, GraphValue &&graph)
+        {
+            require_slot(slot);
+            if (!can_retain_graph() || !graph.has_value()) { return false; }
+            if (retained_.size() <= slot) { retained_.resize(slot_capacity()); }
+            if (retained_[slot].has_value()) { return false; }
+            retained_[slot] = std::move(graph);
+            ++retained_count_;
+            return true;
+        }
+
+        /** The graph retained for ``slot``, or an empty value. */
+        [[nodiscard]] GraphValue take_retained_graph(size_t slot) noexcept
+        {
+            if (slot >= retained_.size() || !retained_[slot].has_value()) { return GraphValue{}; }
+            --retained_count_;
+            return std::move(retained_[slot]);
+        }
+
+        void release_retained_graphs() noexcept
+        {
+            retained_.clear();
+            retained_count_ = 0;
+        }
+
         [[nodiscard]] void *graph_memory(size_t slot)
         {
             require_slot(slot);
@@ -214,6 +260,11 @@ namespace hgraph
         MemoryUtils::StorageLayout    slot_layout_{};
         size_t                        graph_offset_{0};
         bool                          bound_{false};
+        // Indexed by slot and declared after ``storage_`` so the retained
+        // graphs are destroyed while their slot memory is still allocated.
+        std::vector<GraphValue>       retained_{};
+        size_t                        retained_count_{0};
+        size_t                        retained_limit_{0};
 
         [[nodiscard]] static size_t checked_align_to(size_t offset, size_t alignment)
         {
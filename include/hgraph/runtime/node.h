@@ -23,6 +23,7 @@
 #include <hgraph/types/value/value_view.h>
 #include <hgraph/util/date_time.h>
 
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <optional>
@@ -78,6 +79,12 @@ namespace hgraph
     {
         /** Work accepted by a source policy but not yet emitted. */
         std::optional<std::size_t> pending_items{};
+        /**
+         * Steady-clock time the oldest value applied by a push source's
+         * latest evaluation was sent; empty when that evaluation applied
+         * nothing.
+         */
+        std::optional<std::chrono::steady_clock::time_point> applied_enqueue_time{};
     };
 
     /**
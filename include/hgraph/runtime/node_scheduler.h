@@ -7,22 +7,250 @@
 #include <hgraph/util/date_time.h>
 
 #include <algorithm>
-#include <map>
-#include <optional>
-#include <set>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace hgraph
 {
+    struct NodeSchedulerState;
+
+    /**
+     * Identity of a scheduler tag.
+     *
+     * Events carry a 32-bit id, so rescheduling never copies a string. Id
+     * ``0`` is the untagged event. Names known at wiring or start are
+     * interned in a process-wide table: operators hold their tags as
+     * ``static const`` members, interning them once when the implementation
+     * is first wired. The table only grows through this constructor, so it
+     * stays bounded by the tags the code base declares. Names first seen at
+     * runtime (the ``std::string_view`` overloads on
+     * :cpp:class:`NodeScheduler`, the Python ``SCHEDULER``) never reach it:
+     * they resolve to an interned tag when one exists and otherwise to a
+     * node-local tag owned by that node's :cpp:struct:`NodeSchedulerState`.
+     */
+    class HGRAPH_EXPORT SchedulerTag
+    {
+      public:
+        /** Set on ids naming a node-local tag. */
+        static constexpr std::uint32_t local_bit = std::uint32_t{1} << 31U;
+
+        constexpr SchedulerTag() noexcept = default;
+
+        /** Intern ``name`` (wiring/start only); the empty name is the untagged event. */
+        explicit SchedulerTag(std::string_view name) : id_(name.empty() ? 0 : intern(name)) {}
+
+        /** The interned tag for ``name``, or the untagged tag when ``name`` was never interned. Lock-free. */
+        [[nodiscard]] static SchedulerTag find(std::string_view name) noexcept;
+
+        [[nodiscard]] constexpr std::uint32_t id() const noexcept { return id_; }
+        [[nodiscard]] constexpr bool          tagged() const noexcept { return id_ != 0; }
+        [[nodiscard]] constexpr bool          local() const noexcept { return (id_ & local_bit) != 0; }
+
+        /** The interned name; empty for the untagged tag and for node-local tags
+            (see ``NodeSchedulerState::tag_name``). */
+        [[nodiscard]] std::string_view name() const noexcept;
+
+        friend constexpr auto operator<=>(SchedulerTag, SchedulerTag) noexcept = default;
+
+      private:
+        friend struct NodeSchedulerState;
+
+        constexpr explicit SchedulerTag(std::uint32_t id, int) noexcept : id_(id) {}
+
+        [[nodiscard]] static std::uint32_t intern(std::string_view name);
+
+        std::uint32_t id_{0};
+    };
+
+    /**
+     * Pending ``(time, tag)`` events of one node as a binary min-heap.
+     *
+     * The first ``inline_capacity`` events live inline, so the common node
+     * with one untagged (or one tagged) pending event never allocates; larger
+     * heaps spill to a heap block that is kept across ``clear`` and reused.
+     * Events order by time, then by tag id. Tagged lookups scan the heap:
+     * a node holds a handful of tags at most, which is cheaper than keeping a
+     * separate index in step.
+     */
+    class HGRAPH_EXPORT SchedulerEventHeap
+    {
+      public:
+        struct Event
+        {
+            DateTime     when{MIN_DT};
+            SchedulerTag tag{};
+
+            friend constexpr bool operator==(const Event &, const Event &) noexcept = default;
+        };
+
+        static constexpr std::uint32_t inline_capacity = 2;
+        static constexpr std::size_t   npos            = static_cast<std::size_t>(-1);
+
+        SchedulerEventHeap() noexcept = default;
+
+        SchedulerEventHeap(const SchedulerEventHeap &other) { assign(other); }
+
+        SchedulerEventHeap(SchedulerEventHeap &&other) noexcept { take(other); }
+
+        SchedulerEventHeap &operator=(const SchedulerEventHeap &other)
+        {
+            if (this != &other) { assign(other); }
+            return *this;
+        }
+
+        SchedulerEventHeap &operator=(SchedulerEventHeap &&other) noexcept
+        {
+            if (this != &other) { take(other); }
+            return *this;
+        }
+
+        ~SchedulerEventHeap() = default;
+
+        [[nodiscard]] bool        empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+        /** The earliest event. Requires a non-empty heap. */
+        [[nodiscard]] const Event &top() const noexcept { return data()[0]; }
+
+        /** The events in heap (not time) order. */
+        [[nodiscard]] std::span<const Event> entries() const noexcept { return {data(), size_}; }
+
+        /** Index of the event carrying ``tag`` (tagged only), or ``npos``. */
+        [[nodiscard]] std::size_t find(SchedulerTag tag) const noexcept
+        {
+            if (!tag.tagged()) { return npos; }
+            const Event *events = data();
+            for (std::size_t index = 0; index < size_; ++index)
+            {
+                if (events[index].tag == tag) { return index; }
+            }
+            return npos;
+        }
+
+        /** Whether ``event`` is pending. */
+        [[nodiscard]] bool contains(const Event &event) const noexcept
+        {
+            const Event *events = data();
+            if (size_ == 0 || before(event, events[0])) { return false; }  // earlier than everything pending
+            for (std::size_t index = 0; index < size_; ++index)
+            {
+                if (events[index] == event) { return true; }
+            }
+            return false;
+        }
+
+        [[nodiscard]] const Event &operator[](std::size_t index) const noexcept { return data()[index]; }
+
+        void push(Event event)
+        {
+            if (size_ == capacity_) { grow(); }
+            Event *events = data();
+            events[size_] = event;
+            sift_up(size_++);
+        }
+
+        void pop() noexcept { erase(0); }
+
+        /** Remove the event at heap position ``index``. */
+        void erase(std::size_t index) noexcept
+        {
+            Event *events = data();
+            const Event last = events[--size_];
+            if (index == size_) { return; }
+            events[index] = last;
+            sift_up(index);
+            sift_down(index);
+        }
+
+        /** Drop every event, keeping any spilled capacity for reuse. */
+        void clear() noexcept { size_ = 0; }
+
+      private:
+        [[nodiscard]] static constexpr bool before(const Event &lhs, const Event &rhs) noexcept
+        {
+            return lhs.when < rhs.when || (lhs.when == rhs.when && lhs.tag < rhs.tag);
+        }
+
+        [[nodiscard]] Event       *data() noexcept { return spill_ != nullptr ? spill_.get() : inline_.data(); }
+        [[nodiscard]] const Event *data() const noexcept { return spill_ != nullptr ? spill_.get() : inline_.data(); }
+
+        void sift_up(std::size_t index) noexcept
+        {
+            Event *events = data();
+            while (index > 0)
+            {
+                const std::size_t parent = (index - 1) / 2;
+                if (!before(events[index], events[parent])) { return; }
+                std::swap(events[index], events[parent]);
+                index = parent;
+            }
+        }
+
+        void sift_down(std::size_t index) noexcept
+        {
+            Event *events = data();
+            for (;;)
+            {
+                const std::size_t left     = 2 * index + 1;
+                std::size_t       smallest = index;
+                if (left < size_ && before(events[left], events[smallest])) { smallest = left; }
+                if (left + 1 < size_ && before(events[left + 1], events[smallest])) { smallest = left + 1; }
+                if (smallest == index) { return; }
+                std::swap(events[index], events[smallest]);
+                index = smallest;
+            }
+        }
+
+        void grow()
+        {
+            const std::uint32_t capacity = capacity_ * 2;
+            auto                spill    = std::make_unique<Event[]>(capacity);
+            std::copy_n(data(), size_, spill.get());
+            spill_    = std::move(spill);
+            capacity_ = capacity;
+        }
+
+        void assign(const SchedulerEventHeap &other)
+        {
+            size_ = 0;
+            while (capacity_ < other.size_) { grow(); }
+            std::copy_n(other.data(), other.size_, data());
+            size_ = other.size_;
+        }
+
+        void take(SchedulerEventHeap &other) noexcept
+        {
+            inline_   = other.inline_;
+            spill_    = std::move(other.spill_);
+            size_     = other.size_;
+            capacity_ = spill_ != nullptr ? other.capacity_ : inline_capacity;
+            other.size_     = 0;
+            other.capacity_ = inline_capacity;
+        }
+
+        std::array<Event, inline_capacity> inline_{};
+        std::unique_ptr<Event[]>           spill_{};
+        std::uint32_t                      size_{0};
+        std::uint32_t                      capacity_{inline_capacity};
+    };
+
     /**
      * Persistent per-node scheduler **state** — the small footprint stored on a
-     * node that declares a ``NodeScheduler``. It holds the set of pending
-     * ``(time, tag)`` events (ordered by time then tag) and the ``tag -> time``
-     * index used to replace/cancel tagged schedules. A node that never schedules
-     * stores nothing (the slot exists only when ``uses_scheduler`` is set).
+     * node that declares a ``NodeScheduler``. It holds the pending ``(time,
+     * tag)`` events as a :cpp:class:`SchedulerEventHeap`; a tag is unique
+     * within the heap, so the event carrying it is also the ``tag -> time``
+     * index used to replace/cancel tagged schedules. A node that never
+     * schedules stores nothing (the slot exists only when ``uses_scheduler``
+     * is set).
      *
      * Behaviour lives on the :cpp:class:`NodeScheduler` view, constructed on
      * demand when the scheduler is injected — the value/view split keeps the node
@@ -30,8 +258,28 @@ namespace hgraph
      */
     struct HGRAPH_EXPORT NodeSchedulerState
     {
-        std::set<std::pair<DateTime, std::string>> events{};
-        std::map<std::string, DateTime>            tags{};
+        /** A name this node resolved at runtime and the id it resolved to. */
+        struct RuntimeTag
+        {
+            std::string  name{};
+            SchedulerTag tag{};
+        };
+
+        SchedulerEventHeap events{};
+        /** The one name -> id mapping for runtime names, interned or not:
+            slot ``i`` owns the local tag id ``SchedulerTag::local_bit | (i + 1)``,
+            used when its name was never interned. A name keeps its id while an
+            event carries it; a slot no pending event uses is re-resolved or
+            handed to the next unseen name, so the table is bounded by the
+            node's concurrently pending tags. */
+        std::vector<RuntimeTag> runtime_tags{};
+
+        /** The tag named ``name``: the id it holds on this node, else the interned one, else untagged. */
+        [[nodiscard]] SchedulerTag find_tag(std::string_view name) const noexcept;
+        /** As ``find_tag``, but records the name, making an unseen one a node-local tag. */
+        [[nodiscard]] SchedulerTag tag(std::string_view name);
+        /** The name of ``tag``, local or interned. */
+        [[nodiscard]] std::string_view tag_name(SchedulerTag tag) const noexcept;
     };
 
     /**
@@ -119,7 +367,7 @@ namespace hgraph
         /** Earliest pending time, or ``MIN_DT`` when nothing is scheduled. */
         [[nodiscard]] DateTime next_scheduled_time() const noexcept
         {
-            return (state_ != nullptr && !state_->events.empty()) ? state_->events.begin()->first : MIN_DT;
+            return (state_ != nullptr && !state_->events.empty()) ? state_->events.top().when : MIN_DT;
         }
 
         /** Whether any events are pending. */
@@ -137,51 +385,73 @@ namespace hgraph
          */
         [[nodiscard]] bool is_scheduled_now() const noexcept
         {
-            return state_ != nullptr && !state_->events.empty() && state_->events.begin()->first == now_;
+            return state_ != nullptr && !state_->events.empty() && state_->events.top().when == now_;
         }
 
         /** Whether a schedule is registered under ``tag``. */
-        [[nodiscard]] bool has_tag(std::string_view tag) const
+        [[nodiscard]] bool has_tag(SchedulerTag tag) const noexcept
+        {
+            return state_ != nullptr && state_->events.find(tag) != SchedulerEventHeap::npos;
+        }
+
+        [[nodiscard]] bool has_tag(std::string_view tag) const noexcept
         {
-            return state_ != nullptr && state_->tags.contains(std::string{tag});
+            return state_ != nullptr && has_tag(state_->find_tag(tag));
         }
 
         /** Time registered under ``tag``, or ``default_time`` when absent. */
-        [[nodiscard]] DateTime tag_time(std::string_view tag, DateTime default_time = MIN_DT) const
+        [[nodiscard]] DateTime tag_time(SchedulerTag tag, DateTime default_time = MIN_DT) const noexcept
         {
             if (state_ == nullptr) { return default_time; }
-            const auto it = state_->tags.find(std::string{tag});
-            return it != state_->tags.end() ? it->second : default_time;
+            const std::size_t index = state_->events.find(tag);
+            return index != SchedulerEventHeap::npos ? state_->events[index].when : default_time;
+        }
+
+        [[nodiscard]] DateTime tag_time(std::string_view tag, DateTime default_time = MIN_DT) const noexcept
+        {
+            return state_ != nullptr ? tag_time(state_->find_tag(tag), default_time) : default_time;
         }
 
         /** Whether ``tag``'s schedule is due in the current cycle. */
-        [[nodiscard]] bool tag_is_scheduled_now(std::string_view tag) const { return has_tag(tag) && tag_time(tag) == now_; }
+        [[nodiscard]] bool tag_is_scheduled_now(SchedulerTag tag) const noexcept
+        {
+            return has_tag(tag) && tag_time(tag) == now_;
+        }
+
+        [[nodiscard]] bool tag_is_scheduled_now(std::string_view tag) const noexcept
+        {
+            return state_ != nullptr && tag_is_scheduled_now(state_->find_tag(tag));
+        }
 
         /** Remove ``tag``'s event and return its time, or ``default_time`` when absent. */
-        DateTime pop_tag(std::string_view tag, DateTime default_time = MIN_DT) const
+        DateTime pop_tag(SchedulerTag tag, DateTime default_time = MIN_DT) const
         {
             require_state("pop_tag");
-            const auto it = state_->tags.find(std::string{tag});
-            if (it == state_->tags.end()) { return default_time; }
-            const DateTime when = it->second;
-            state_->events.erase({when, it->first});
-            state_->tags.erase(it);
+            const std::size_t index = state_->events.find(tag);
+            if (index == SchedulerEventHeap::npos) { return default_time; }
+            const DateTime when = state_->events[index].when;
+            state_->events.erase(index);
             return when;
         }
 
+        DateTime pop_tag(std::string_view tag, DateTime default_time = MIN_DT) const
+        {
+            require_state("pop_tag");
+            return pop_tag(state_->find_tag(tag), default_time);
+        }
+
         /**
          * Schedule the node at ``when``. Once the node is started this must be
          * strictly in the future; **during ``start``** (before the node is
          * started) a node may schedule its first evaluation at the current
          * (start) time via ``schedule(now())`` — this is how a source initiates
-         * itself. A non-empty ``tag`` replaces any prior event under the same tag.
+         * itself. A tagged schedule replaces any prior event under the same tag.
          * ``on_wall_clock`` interprets ``when`` as an absolute host wall-clock
          * time and requires a real-time graph executor. Mirrors the authoritative
          * Python guard for started nodes, while preserving the start-cycle
          * ``schedule(now())`` source pattern before the node has started.
          */
-        void schedule(DateTime when, std::optional<std::string> tag = std::nullopt,
-                      bool on_wall_clock = false) const
+        void schedule(DateTime when, SchedulerTag tag = {}, bool on_wall_clock = false) const
         {
             require_state("schedule");
             const DateTime reference_now = scheduling_reference_time(on_wall_clock);
@@ -207,51 +477,71 @@ namespace hgraph
                 when = reference_now;
             }
 
-            const bool        tagged    = tag.has_value() && !tag->empty();
-            const std::string tag_value = tagged ? *tag : std::string{};
-
-            if (tagged)
+            SchedulerEventHeap &events     = state_->events;
+            const DateTime      prev_first = events.empty() ? MAX_DT : events.top().when;
+            if (tag.tagged())
             {
-                if (const auto it = state_->tags.find(tag_value); it != state_->tags.end())
+                // Replace the existing tagged event in place.
+                if (const std::size_t index = events.find(tag); index != SchedulerEventHeap::npos)
                 {
-                    state_->events.erase({it->second, tag_value});  // replace existing tagged event
+                    events.erase(index);
                 }
             }
-
-            const DateTime prev_first = state_->events.empty() ? MAX_DT : state_->events.begin()->first;
-            if (tagged) { state_->tags[tag_value] = when; }  // only tagged events are indexed
-            state_->events.insert({when, tag_value});
-            const DateTime next = state_->events.begin()->first;
+            else if (events.contains({.when = when, .tag = tag}))
+            {
+                return;  // untagged events at one time are a single event
+            }
+            events.push({.when = when, .tag = tag});
+            const DateTime next = events.top().when;
             if (graph_ != nullptr && next < prev_first) { graph_->schedule_node(node_index_, next); }
         }
 
+        /** Schedule under the tag named ``tag`` (empty for an untagged event); an unseen name becomes node-local. */
+        void schedule(DateTime when, std::string_view tag, bool on_wall_clock = false) const
+        {
+            require_state("schedule");
+            schedule(when, state_->tag(tag), on_wall_clock);
+        }
+
         /** Schedule the node ``delta`` after the current evaluation time. */
-        void schedule(TimeDelta delta, std::optional<std::string> tag = std::nullopt,
-                      bool on_wall_clock = false) const
+        void schedule(TimeDelta delta, SchedulerTag tag = {}, bool on_wall_clock = false) const
+        {
+            require_state("schedule");
+            schedule(scheduling_reference_time(on_wall_clock) + delta, tag, on_wall_clock);
+        }
+
+        void schedule(TimeDelta delta, std::string_view tag, bool on_wall_clock = false) const
         {
             require_state("schedule");
-            schedule(scheduling_reference_time(on_wall_clock) + delta, std::move(tag), on_wall_clock);
+            schedule(delta, state_->tag(tag), on_wall_clock);
         }
 
         /** Cancel the event registered under ``tag`` (no-op if absent). */
-        void un_schedule(const std::string &tag) const
+        void un_schedule(SchedulerTag tag) const
         {
             require_state("un_schedule");
-            if (const auto it = state_->tags.find(tag); it != state_->tags.end())
+            if (const std::size_t index = state_->events.find(tag); index != SchedulerEventHeap::npos)
             {
-                state_->events.erase({it->second, it->first});
-                state_->tags.erase(it);
+                state_->events.erase(index);
             }
         }
 
-        /** Cancel the next (earliest) pending event. */
+        void un_schedule(std::string_view tag) const
+        {
+            require_state("un_schedule");
+            un_schedule(state_->find_tag(tag));
+        }
+
+        /**
+         * Cancel the next (earliest) pending event. Events at the same time
+         * go untagged first, then by tag id: interned tags in the order they
+         * were interned, then node-local ones. Ties no longer follow the tag
+         * name's spelling.
+         */
         void un_schedule() const
         {
             require_state("un_schedule");
-            if (state_->events.empty()) { return; }
-            const auto ev = *state_->events.begin();
-            state_->events.erase(state_->events.begin());
-            state_->tags.erase(ev.second);
+            if (!state_->events.empty()) { state_->events.pop(); }
         }
 
         /** Remove all pending events. */
@@ -259,7 +549,6 @@ namespace hgraph
         {
             require_state("reset");
             state_->events.clear();
-            state_->tags.clear();
         }
 
         /**
@@ -273,16 +562,9 @@ namespace hgraph
         void advance() const
         {
             if (state_ == nullptr) { return; }
-            while (!state_->events.empty() && state_->events.begin()->first <= now_)
-            {
-                const std::string &tag = state_->events.begin()->second;
-                if (!tag.empty()) { state_->tags.erase(tag); }  // only tagged events are indexed
-                state_->events.erase(state_->events.begin());
-            }
-            if (graph_ != nullptr && !state_->events.empty())
-            {
-                graph_->schedule_node(node_index_, state_->events.begin()->first);
-            }
+            SchedulerEventHeap &events = state_->events;
+            while (!events.empty() && events.top().when <= now_) { events.pop(); }
+            if (graph_ != nullptr && !events.empty()) { graph_->schedule_node(node_index_, events.top().when); }
         }
 
       private:
@@ -3,6 +3,7 @@
 
 #include <hgraph/runtime/executor.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <utility>
@@ -17,6 +18,7 @@ namespace hgraph
     {
         struct PushSourcePolicyOps;
         struct PushSourcePolicyAccess;
+        struct PushSourceEmit;
         struct PushSourcePolicyStorageRef;
     }
 
@@ -24,8 +26,13 @@ namespace hgraph
     {
         Queue,
         Conflating,
+        /** Lock-free multi-producer ring of preallocated value slots. */
+        BoundedQueue,
     };
 
+    /** Slot count used by ``PushSourcePolicyKind::BoundedQueue`` when none is given. */
+    inline constexpr std::size_t default_push_source_queue_capacity = 4096;
+
     class HGRAPH_EXPORT PushSourcePolicy
     {
       public:
@@ -74,9 +81,9 @@ namespace hgraph
                               void *storage,
                               const TSValueTypeMetaData &output_schema);
             static void stop(const PushSourcePolicy &policy, void *storage);
-            static bool emit_next(const PushSourcePolicy &policy,
-                                  void *storage,
-                                  const TSOutputView &output);
+            static PushSourceEmit emit_next(const PushSourcePolicy &policy,
+                                            void *storage,
+                                            const TSOutputView &output);
             [[nodiscard]] static std::size_t pending_items(
                 const PushSourcePolicy &policy, const void *storage) noexcept;
         };
@@ -87,7 +94,9 @@ namespace hgraph
      *
      * The sender is a lightweight handle onto the owning node's policy storage.
      * Sending copies/moves an owned value into the policy and marks the root
-     * real-time executor when the policy accepts a ready update.
+     * real-time executor when the policy accepts a ready update. Each value
+     * is stamped with the steady-clock time it was sent; the node reports
+     * the stamp of what it applied through ``NodeInspectionMetrics``.
      */
     class HGRAPH_EXPORT PushSourceSender
     {
@@ -125,6 +134,23 @@ namespace hgraph
     [[nodiscard]] HGRAPH_EXPORT PushSourcePolicy make_push_source_conflating_policy(
         const ValueTypeMetaData &sender_schema);
 
+    /**
+     * Queue policy for high-rate multi-threaded senders.
+     *
+     * Values are handed over through a bounded ring of ``capacity`` slots
+     * (rounded up to a power of two) allocated when the node starts; senders
+     * claim slots with a compare-and-swap and never take a lock. Only the send
+     * that finds the queue drained signals the executor, so a burst costs one
+     * wake-up. A sender that finds the ring full yields until the evaluation
+     * thread frees a slot or the node stops; a send from the evaluation thread
+     * itself into a full ring throws ``std::logic_error`` rather than waiting
+     * on its own progress. Delivery matches the ``Queue``
+     * policy: one value per cycle, in per-sender order.
+     */
+    [[nodiscard]] HGRAPH_EXPORT PushSourcePolicy make_push_source_bounded_queue_policy(
+        const ValueTypeMetaData &sender_schema,
+        std::size_t capacity = default_push_source_queue_capacity);
+
     /**
      * Build a root push-source node for ``output_schema``.
      *
@@ -3,6 +3,7 @@
 
 #include <hgraph/runtime/evaluation_clock.h>
 #include <hgraph/runtime/evaluation_profiler.h>
+#include <hgraph/runtime/evaluation_timeline.h>
 #include <hgraph/runtime/evaluation_trace.h>
 #include <hgraph/runtime/graph_diagnostics.h>
 #include <hgraph/runtime/lifecycle_observer.h>
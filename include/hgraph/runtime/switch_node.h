@@ -35,6 +35,27 @@ namespace hgraph
          * instead of re-homing that terminal onto switch-owned storage.
          */
         bool output_forwards_to_child_terminal{false};
+        /**
+         * Keep up to this many stopped branch graphs, keyed by switch key, in
+         * least-recently-used order. Re-selecting a cached key resets that
+         * graph in place (fresh node state, see
+         * ``GraphBuilder::reset_nested_graph``) instead of building a new one.
+         * Zero keeps the plain two-slot behaviour.
+         */
+        std::size_t branch_cache_size{0};
+    };
+
+    /** Memory and reuse counters of a ``switch_`` branch cache. */
+    struct HGRAPH_EXPORT SwitchBranchCacheMetrics
+    {
+        std::size_t capacity{0};
+        std::size_t cached_graph_count{0};
+        /** Graph-slot bytes held in node storage for the cache, and the share occupied by cached graphs. */
+        std::size_t reserved_bytes{0};
+        std::size_t live_bytes{0};
+        std::size_t hits{0};
+        std::size_t misses{0};
+        std::size_t evictions{0};
     };
 
     /**
@@ -55,6 +76,8 @@ namespace hgraph
         [[nodiscard]] std::size_t     stored_graph_count() const noexcept;
         /** True when every constructed branch graph resides in its fixed node-storage slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
+        /** Occupancy, slot memory and hit/miss/eviction counts of the branch cache. */
+        [[nodiscard]] SwitchBranchCacheMetrics branch_cache_metrics() const noexcept;
 
         /** Internal (switch_node implementation) — the registered context / storage. */
         [[nodiscard]] const void *internal_context() const noexcept { return context_; }
@@ -80,6 +103,10 @@ namespace hgraph
      * its output forwards to the active terminal instead. A VALUE branch under a
      * REF-shaped switch owns its output in its graph slot and the switch publishes
      * a reference to that terminal.
+     *
+     * With ``branch_cache_size`` N the node reserves N further slots. A stopped
+     * child then moves into the cache instead of the previous slot; the least
+     * recently used cached graph is destroyed when the cache overflows.
      */
     [[nodiscard]] HGRAPH_EXPORT NodeBuilder switch_node(NodeTypeMetaData meta, SwitchNodeSpec spec);
 }  // namespace hgraph
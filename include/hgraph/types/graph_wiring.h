@@ -55,6 +55,7 @@ namespace hgraph
 
     struct WiringInstance;
     struct WiringDelayedBindingState;
+    struct LiftedKernel;
     struct WiringDelayedBindingControl;
 
     /**
@@ -789,6 +790,9 @@ namespace hgraph
         NodeBuilder                         builder;
         std::vector<WiringInputRef>          inputs;
         std::vector<const WiringInstance *> rank_dependencies;
+        /** The pure scalar kernel this node evaluates, when it is a lifted
+            node; candidates for ``finish``-time kernel fusion. */
+        const LiftedKernel                 *lifted_kernel{nullptr};
     };
 
     struct CompiledSubGraph;   // defined in subgraph_wiring.h
@@ -890,6 +894,22 @@ namespace hgraph
         Wiring &label(std::string label);
         [[nodiscard]] std::string_view label() const noexcept;
 
+        /**
+         * Lifted-kernel fusion (off by default, inherited by child
+         * wirings). When enabled, ``finish`` and ``finish_subgraph``
+         * collapse each tree of lifted scalar nodes whose intermediate
+         * outputs have exactly one reader into one node that evaluates the
+         * expression through per-node scratch values, so ``(a + b) * c - d`` costs one node rather
+         * than three. Ticking and validity are unchanged: the fused node
+         * fires when any leaf ticks and emits once every leaf is valid.
+         * ``snapshot`` never fuses, as the wiring stays open to new readers.
+         */
+        Wiring &fuse_lifted_kernels(bool enabled) noexcept;
+        [[nodiscard]] bool fuse_lifted_kernels() const noexcept;
+
+        /** Mark ``node`` as evaluating the pure scalar ``kernel`` (``lift<F>``). */
+        void mark_lifted_kernel(const WiringInstance *node, const LiftedKernel &kernel);
+
         /**
          * Intern a node with its input edges + scalar configuration and return its
          * output port. ``def`` is the node *definition's* stable identity
@@ -13,6 +13,7 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <stdexcept>
 #include <string>
@@ -23,6 +24,14 @@
 #include <utility>
 #include <vector>
 
+// Column loops are cloned for AVX2 and AVX-512 and picked at runtime on x86
+// GCC/Clang builds; elsewhere the portable loop is left to the auto-vectoriser.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HGRAPH_LIFT_COLUMN_DISPATCH 1
+#else
+#define HGRAPH_LIFT_COLUMN_DISPATCH 0
+#endif
+
 namespace hgraph
 {
     namespace lift_detail
@@ -229,6 +238,133 @@ namespace hgraph
                               std::make_index_sequence<arity_v<F>>{});
         }
 
+        template <typename F, std::size_t... I>
+        void eval_assign_impl(const ValueView &destination, std::span<const ValueView> args,
+                              std::index_sequence<I...>)
+        {
+            using R = result_t<F>;
+            using tuple = arg_tuple_t<F>;
+            if (args.size() != sizeof...(I))
+            {
+                throw std::invalid_argument("lifted function argument count does not match the kernel arity");
+            }
+            R result = invoke<F>(args[I].template checked_as<tuple_arg_t<tuple, I>>()...);
+            destination.binding().move_assign_at(destination.mutable_data(), static_cast<void *>(&result));
+        }
+
+        template <typename F>
+        void eval_assign(const ValueView &destination, std::span<const ValueView> args)
+        {
+            eval_assign_impl<F>(destination, args, std::make_index_sequence<arity_v<F>>{});
+        }
+
+        template <typename F, typename = std::make_index_sequence<arity_v<F>>>
+        inline constexpr bool columnar_v = false;
+
+        /** Kernels whose arguments and result are all arithmetic run over packed columns. */
+        template <typename F, std::size_t... I>
+        inline constexpr bool columnar_v<F, std::index_sequence<I...>> =
+            std::is_arithmetic_v<result_t<F>> && (std::is_arithmetic_v<tuple_arg_t<arg_tuple_t<F>, I>> && ...);
+
+        template <typename F, std::size_t... I>
+        [[nodiscard]] constexpr std::array<std::size_t, sizeof...(I) + 1> column_widths_impl(std::index_sequence<I...>)
+        {
+            return {sizeof(tuple_arg_t<arg_tuple_t<F>, I>)..., sizeof(result_t<F>)};
+        }
+
+        template <typename F>
+        inline constexpr std::array<std::size_t, arity_v<F> + 1> column_widths_v =
+            column_widths_impl<F>(std::make_index_sequence<arity_v<F>>{});
+
+        enum class ColumnIsa : std::uint8_t
+        {
+            Scalar,
+            Avx2,
+            Avx512,
+        };
+
+        /** The widest vector ISA the column loops may use, probed once per process. */
+        [[nodiscard]] inline ColumnIsa column_isa() noexcept
+        {
+#if HGRAPH_LIFT_COLUMN_DISPATCH
+            static const ColumnIsa isa = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+                    __builtin_cpu_supports("avx512vl"))
+                {
+                    return ColumnIsa::Avx512;
+                }
+                if (__builtin_cpu_supports("avx2")) { return ColumnIsa::Avx2; }
+                return ColumnIsa::Scalar;
+            }();
+            return isa;
+#else
+            return ColumnIsa::Scalar;
+#endif
+        }
+
+        // Forced inline so each ISA clone below compiles its own copy of the loop.
+        template <typename F, std::size_t... I>
+#if HGRAPH_LIFT_COLUMN_DISPATCH
+        [[gnu::always_inline]]
+#endif
+        inline void eval_columns_loop(std::span<const void *const> columns, void *out, std::size_t count,
+                                      std::index_sequence<I...>)
+        {
+            using R     = result_t<F>;
+            using tuple = arg_tuple_t<F>;
+            const std::tuple<const tuple_arg_t<tuple, I> *...> in{
+                static_cast<const tuple_arg_t<tuple, I> *>(columns[I])...};
+            R *result = static_cast<R *>(out);
+            for (std::size_t n = 0; n < count; ++n) { result[n] = invoke<F>(std::get<I>(in)[n]...); }
+        }
+
+#if HGRAPH_LIFT_COLUMN_DISPATCH
+        template <typename F, std::size_t... I>
+        [[gnu::target("avx2")]] void eval_columns_avx2(std::span<const void *const> columns, void *out,
+                                                       std::size_t count, std::index_sequence<I...> seq)
+        {
+            eval_columns_loop<F>(columns, out, count, seq);
+        }
+
+        template <typename F, std::size_t... I>
+        [[gnu::target("avx512f,avx512dq,avx512vl")]] void eval_columns_avx512(std::span<const void *const> columns,
+                                                                              void *out, std::size_t count,
+                                                                              std::index_sequence<I...> seq)
+        {
+            eval_columns_loop<F>(columns, out, count, seq);
+        }
+#endif
+
+        template <typename F>
+        void eval_columns(std::span<const void *const> columns, void *out, std::size_t count)
+        {
+            constexpr auto seq = std::make_index_sequence<arity_v<F>>{};
+#if HGRAPH_LIFT_COLUMN_DISPATCH
+            switch (column_isa())
+            {
+                case ColumnIsa::Avx512: eval_columns_avx512<F>(columns, out, count, seq); return;
+                case ColumnIsa::Avx2: eval_columns_avx2<F>(columns, out, count, seq); return;
+                case ColumnIsa::Scalar: break;
+            }
+#endif
+            eval_columns_loop<F>(columns, out, count, seq);
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr LiftedKernel::EvalColumnsThunk eval_columns_thunk()
+        {
+            if constexpr (columnar_v<F>) { return &eval_columns<F>; }
+            else { return nullptr; }
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr const std::size_t *column_widths()
+        {
+            if constexpr (columnar_v<F>) { return column_widths_v<F>.data(); }
+            else { return nullptr; }
+        }
+
         template <typename F, std::size_t... I>
         [[nodiscard]] const TSValueTypeMetaData *input_schema_impl(std::size_t index, std::index_sequence<I...>)
         {
@@ -379,6 +515,9 @@ namespace hgraph
                 .eval_values_fn    = &eval_values<F>,
                 .eval_bound_values_fn = &eval_bound_values<F>,
                 .eval_into_fn      = &eval_into<F>,
+                .eval_assign_fn    = &eval_assign<F>,
+                .eval_columns_fn   = eval_columns_thunk<F>(),
+                .column_widths     = column_widths<F>(),
                 .identity_value_fn = identity_value_thunk<F, Identity>(),
                 .associative       = associative<F>(),
                 .commutative       = commutative<F>(),
@@ -496,10 +635,12 @@ namespace hgraph
             builder.input_endpoint(graph_wiring_detail::input_endpoint_for_sources(
                 input_schema, std::span<const WiringPortRef>{inputs.data(), inputs.size()}));
 
-            return w.add_node(std::type_index(typeid(lifted_node_identity<F, Identity>)),
-                              std::move(builder),
-                              std::span<const WiringPortRef>{inputs.data(), inputs.size()},
-                              Value{static_cast<WiredFn>(lift<F, Identity>{})});
+            WiringPortRef out = w.add_node(std::type_index(typeid(lifted_node_identity<F, Identity>)),
+                                           std::move(builder),
+                                           std::span<const WiringPortRef>{inputs.data(), inputs.size()},
+                                           Value{static_cast<WiredFn>(lift<F, Identity>{})});
+            w.mark_lifted_kernel(out.peered_node(), k);
+            return out;
         }
 
         template <typename F, auto Identity>
@@ -74,11 +74,19 @@ namespace hgraph::record_replay
     /** The Arrow data-frame record/replay model (frame-store backed). */
     inline constexpr std::string_view DATA_FRAME = "DataFrame";
 
+    /** The file-backed streaming model: ``record`` appends Arrow IPC record
+        batches to ``<directory>/<fq_recordable_id>.<key>.arrows`` as the run
+        advances; ``replay`` memory-maps that file and decodes one batch at a
+        time as evaluation time reaches it, so neither side holds the whole
+        recording in memory (``record_replay_mmap_impl.h``). */
+    inline constexpr std::string_view MEMORY_MAPPED = "MemoryMapped";
+
     /**
      * Explicit wiring-time configuration. ``model`` selects the backend
      * (overloads guard on it via ``requires_``); the date / as-of keys name
      * the bitemporal table columns; ``as_of`` overrides the as-of time
-     * (unset = the evaluation clock).
+     * (unset = the evaluation clock); ``directory`` roots the per-key files
+     * of the ``MEMORY_MAPPED`` model (required by that model only).
      */
     struct Config
     {
@@ -86,6 +94,7 @@ namespace hgraph::record_replay
         std::string             date_key{"__date_time__"};
         std::string             as_of_key{"__as_of__"};
         std::optional<DateTime> as_of{};
+        std::string             directory{};
     };
 
     /** Set the configuration in ``state`` before wiring. */
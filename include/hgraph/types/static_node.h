@@ -1570,6 +1570,12 @@ namespace hgraph
 
         [[nodiscard]] value_type get() const { return view_.template checked_as<TValue>(); }
 
+        /** In-place access, for state too large to copy on every evaluation. */
+        [[nodiscard]] value_type &mutable_value()
+        {
+            return view_.begin_mutation().template checked_mutable_as<TValue>();
+        }
+
         template <typename U>
         void set(U &&value)
         {
@@ -10,6 +10,7 @@
 #include <hgraph/types/value/value_ops.h>
 #include <hgraph/util/date_time.h>
 #include <hgraph/util/tagged_ptr.h>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
@@ -22,6 +23,7 @@ namespace hgraph
 
     class GraphView;
     struct TSDataTracking;
+    class TSDataDeferredPublication;
     struct TSDataParent;
     class TSInput;
     class TSOutput;
@@ -193,6 +195,8 @@ namespace hgraph
         [[nodiscard]] TSDataView root_view() const;
 
       private:
+        friend class TSDataDeferredPublication;
+
         [[nodiscard]] const TSDataTracking &parent_tracking() const;
         [[nodiscard]] TSDataTracking &mutable_parent_tracking() const;
     };
@@ -312,11 +316,101 @@ namespace hgraph
          */
         [[nodiscard]] bool record_modified(DateTime modified_time);
 
+        /** Notify this level's observers, or queue them on the thread's deferred publication. */
+        void notify_observers(DateTime modified_time);
+
         DateTime last_modified_time{MIN_DT};
         TSParentLink parent{};
         TSDataObserverSet observers{};
     };
 
+    /**
+     * Publication buffer for a nested child graph evaluated off the engine
+     * thread.
+     *
+     * The child owns the parent's ``boundary`` element (a keyed output slot)
+     * for the evaluation, but that element's observers and its parent
+     * container are shared with every other key. While a ``Scope`` is
+     * installed on a worker, modifications inside the boundary subtree still
+     * record their times; their observer notifications and the bubble-up past
+     * the boundary are queued instead, and ``replay`` delivers them in order
+     * on the engine thread after the join.
+     */
+    class TSDataDeferredPublication
+    {
+      public:
+        class Scope
+        {
+          public:
+            explicit Scope(TSDataDeferredPublication &publication) noexcept;
+            ~Scope();
+
+            Scope(const Scope &)            = delete;
+            Scope &operator=(const Scope &) = delete;
+
+          private:
+            TSDataDeferredPublication *previous_;
+        };
+
+        /**
+         * Marks a parallel child evaluation as in flight, from the fan-out
+         * until the workers join. Held on the engine thread.
+         */
+        class InFlight
+        {
+          public:
+            InFlight() noexcept { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+            ~InFlight() { in_flight_.fetch_sub(1, std::memory_order_relaxed); }
+
+            InFlight(const InFlight &)            = delete;
+            InFlight &operator=(const InFlight &) = delete;
+        };
+
+        /**
+         * True while any ``InFlight`` is held. Modifications test this before
+         * the thread-local ``current`` lookup, so a serial cycle never pays
+         * for it; the pool's task hand-off orders it for the workers.
+         */
+        [[nodiscard]] static bool any_in_flight() noexcept
+        {
+            return in_flight_.load(std::memory_order_relaxed) != 0;
+        }
+
+        /** Start a new evaluation owning ``boundary`` (null owns nothing); drops queued entries. */
+        void reset(TSDataTracking *boundary) noexcept;
+
+        /** Deliver the queued notifications and bubble-ups, then clear them. Engine thread only. */
+        void replay();
+
+        /** The publication installed on this thread, or null. */
+        [[nodiscard]] static TSDataDeferredPublication *current() noexcept;
+
+        /** True when ``tracking`` is the boundary or lies beneath it. */
+        [[nodiscard]] bool covers(const TSDataTracking &tracking) const noexcept;
+
+        /** True when ``link`` is the boundary's own link to its parent container. */
+        [[nodiscard]] bool is_boundary_link(const TSParentLink &link) const noexcept
+        {
+            return boundary_ != nullptr && &boundary_->parent == &link;
+        }
+
+        void defer_notify(TSDataTracking &tracking, DateTime modified_time);
+        void defer_bubble(const TSParentLink &link, DateTime modified_time);
+
+      private:
+        struct Pending
+        {
+            TSDataTracking     *tracking{nullptr};
+            const TSParentLink *link{nullptr};
+            DateTime            time{MIN_DT};
+        };
+
+        TSDataTracking      *boundary_{nullptr};
+        std::vector<Pending> pending_{};
+
+        inline static std::atomic<std::size_t> in_flight_{0};
+    };
+
     /**
      * Memory offsets for one TSData implementation.
      *
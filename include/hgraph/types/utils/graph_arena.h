@@ -0,0 +1,141 @@
+#ifndef HGRAPH_CPP_ROOT_V2_GRAPH_ARENA_H
+#define HGRAPH_CPP_ROOT_V2_GRAPH_ARENA_H
+
+#include <hgraph/hgraph_export.h>
+#include <hgraph/types/utils/memory_utils.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hgraph
+{
+    /**
+     * Per-run allocator for plan-driven runtime storage.
+     *
+     * Memory is carved from large chunks by bumping a cursor, so storage
+     * constructed in sequence (a graph's nodes, then their outputs and
+     * state) sits contiguously in construction order. Two regimes share the
+     * chunks:
+     *
+     * - Inside a ``StaticScope`` (the executor opens one while it builds the
+     *   root graph) blocks are bumped at their exact size and never reused.
+     *   Releasing one mid-run leaves its bytes in place until the arena is
+     *   destroyed; the waste is bounded by what the build allocated.
+     * - Everything else is dynamic: blocks are rounded up to power-of-two
+     *   size classes, and a released block goes onto its class's free list
+     *   and is handed out again before the cursor moves, which is what keeps
+     *   dynamic TSD/TSL slot churn bounded.
+     *
+     * Dynamic blocks come from a per-thread cache (free lists and a bump
+     * cursor into a chunk that thread owns), so the evaluation thread and
+     * parallel workers allocate and release without a lock; only taking a
+     * new chunk, the static regime and ``stats`` lock. A block released on
+     * another thread than the one that allocated it joins the releasing
+     * thread's free list. Nothing is returned to the process until the
+     * arena itself is destroyed, so tearing down a run costs one release per
+     * chunk rather than one per allocation.
+     *
+     * ``ops()`` is the ``MemoryUtils::AllocatorOps`` storage binds to. It
+     * does not propagate on copy: a value copied out of the run binds to the
+     * default allocator. Storage *moved* out keeps its arena binding and
+     * must not outlive the arena.
+     */
+    class HGRAPH_EXPORT GraphArena
+    {
+      public:
+        /** Default size of each chunk requested from the process allocator. */
+        static constexpr std::size_t default_chunk_bytes = std::size_t{256} << 10;
+        /** Requests aligned more strictly than this bypass the arena. */
+        static constexpr std::size_t max_alignment = 4096;
+
+        struct Stats
+        {
+            /** Bytes obtained from the process allocator (sum of chunk sizes). */
+            std::size_t reserved_bytes{0};
+            /** Size-class bytes currently handed out. */
+            std::size_t live_bytes{0};
+            /** Exact-size bytes bumped inside a ``StaticScope``. */
+            std::size_t static_bytes{0};
+            /** Chunks obtained from the process allocator. */
+            std::size_t chunk_count{0};
+            /** Allocations served, including free-list reuse. */
+            std::size_t allocation_count{0};
+            /** Allocations served from a free list rather than the cursor. */
+            std::size_t reuse_count{0};
+        };
+
+        /** RAII scope allocating the arena's static storage at exact sizes. Scopes nest. */
+        class StaticScope
+        {
+          public:
+            explicit StaticScope(GraphArena &arena) noexcept;
+            StaticScope(const StaticScope &)            = delete;
+            StaticScope &operator=(const StaticScope &) = delete;
+            ~StaticScope();
+
+          private:
+            GraphArena &arena_;
+            bool        previous_{false};
+        };
+
+        explicit GraphArena(std::size_t chunk_bytes = default_chunk_bytes);
+        GraphArena(const GraphArena &)            = delete;
+        GraphArena &operator=(const GraphArena &) = delete;
+        ~GraphArena();
+
+        /** The allocator ops table bound to this arena. */
+        [[nodiscard]] const MemoryUtils::AllocatorOps &ops() const noexcept { return ops_; }
+
+        [[nodiscard]] void *allocate(MemoryUtils::StorageLayout layout);
+        void                deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept;
+
+        [[nodiscard]] Stats stats() const;
+
+      private:
+        struct FreeBlock
+        {
+            FreeBlock *next{nullptr};
+        };
+
+        struct Chunk
+        {
+            std::byte  *memory{nullptr};
+            std::size_t size{0};
+        };
+
+        struct ThreadCache;
+
+        static constexpr std::size_t min_class_shift = 4;   // 16 bytes: room for a FreeBlock link
+        static constexpr std::size_t class_count     = sizeof(std::size_t) * 8;
+
+        [[nodiscard]] static std::size_t size_class(MemoryUtils::StorageLayout layout) noexcept;
+        [[nodiscard]] ThreadCache       &thread_cache();
+        [[nodiscard]] std::byte         *bump(ThreadCache &cache, std::size_t size, std::size_t alignment);
+        [[nodiscard]] std::byte         *new_chunk(std::size_t size);
+        [[nodiscard]] void              *allocate_static(MemoryUtils::StorageLayout layout);
+        [[nodiscard]] bool               release_static(void *memory, MemoryUtils::StorageLayout layout) noexcept;
+
+        static void *allocate_hook(void *context, MemoryUtils::StorageLayout layout);
+        static void  deallocate_hook(void *context, void *memory, MemoryUtils::StorageLayout layout) noexcept;
+
+        mutable std::mutex                         mutex_{};
+        std::uint64_t                              id_{0};
+        std::vector<std::unique_ptr<ThreadCache>>  caches_{};
+        std::vector<Chunk>                         chunks_{};
+        /** Static chunks, sorted by address; immutable outside a ``StaticScope``. */
+        std::vector<Chunk>                         static_chunks_{};
+        std::byte                                 *static_cursor_{nullptr};
+        std::byte                                 *static_limit_{nullptr};
+        std::atomic<bool>                          static_phase_{false};
+        std::size_t                                chunk_bytes_{default_chunk_bytes};
+        std::size_t                                reserved_bytes_{0};
+        std::size_t                                static_bytes_{0};
+        MemoryUtils::AllocatorOps                  ops_{};
+    };
+}  // namespace hgraph
+
+#endif  // HGRAPH_CPP_ROOT_V2_GRAPH_ARENA_H
@@ -468,38 +468,82 @@ namespace hgraph
          * Type-erased ops table for raw heap allocation and deallocation.
          *
          * Defaults to the runtime's aligned-new / aligned-delete pair.
-         * Custom allocators provide their own functions and may carry
-         * additional state by capturing it in the function pointers
-         * themselves.
+         * Custom allocators provide their own functions; ``context`` is
+         * handed back to both hooks so a stateful allocator (for example a
+         * per-run ``GraphArena``) needs no global state.
          */
         struct AllocatorOps
         {
-            using allocate_fn   = void *(*)(StorageLayout);
-            using deallocate_fn = void (*)(void *, StorageLayout) noexcept;
+            using allocate_fn   = void *(*)(void *context, StorageLayout);
+            using deallocate_fn = void (*)(void *context, void *, StorageLayout) noexcept;
 
             /** Allocation hook. */
             allocate_fn   allocate{&MemoryUtils::default_allocate};
             /** Deallocation hook. */
             deallocate_fn deallocate{&MemoryUtils::default_deallocate};
+            /** Allocator state passed to both hooks. */
+            void         *context{nullptr};
+            /**
+             * Whether copies of storage bound to this allocator stay bound to
+             * it. Allocators scoped to one run set this to false so a value
+             * copied out of the run binds to ``MemoryUtils::allocator()``
+             * instead and cannot outlive its memory (``std::pmr`` semantics).
+             */
+            bool          propagate_on_copy{true};
 
             /** Allocate a block matching ``layout``; throws if no hook is configured. */
             [[nodiscard]] void *allocate_storage(StorageLayout layout) const {
                 if (allocate == nullptr) { throw std::logic_error("MemoryUtils::AllocatorOps is missing an allocation hook"); }
-                return allocate(layout);
+                return allocate(context, layout);
             }
 
             /** Deallocate a block previously returned by ``allocate_storage``. */
             void deallocate_storage(void *memory, StorageLayout layout) const noexcept {
-                if (deallocate != nullptr && memory != nullptr) { deallocate(memory, layout); }
+                if (deallocate != nullptr && memory != nullptr) { deallocate(context, memory, layout); }
+            }
+
+            /** The allocator a copy of storage bound to this allocator should use. */
+            [[nodiscard]] const AllocatorOps &copy_allocator() const noexcept {
+                return propagate_on_copy ? *this : MemoryUtils::allocator();
             }
         };
 
-        /** Process-wide default allocator (aligned ``new`` / ``delete``). */
+        /**
+         * The allocator fresh storage binds to: the innermost
+         * ``AllocatorScope`` on this thread, else the process-wide default
+         * (aligned ``new`` / ``delete``).
+         */
         [[nodiscard]] static const AllocatorOps &allocator() noexcept {
+            const AllocatorOps *active = active_allocator();
+            return active != nullptr ? *active : default_allocator();
+        }
+
+        /** The process-wide default allocator, ignoring any active scope. */
+        [[nodiscard]] static const AllocatorOps &default_allocator() noexcept {
             static const AllocatorOps allocator_ops{};
             return allocator_ops;
         }
 
+        /**
+         * RAII scope routing ``MemoryUtils::allocator()`` on the current
+         * thread to ``ops``. Storage constructed inside the scope keeps the
+         * allocator it bound to, so later growth and release go through it
+         * after the scope has closed. Scopes nest.
+         */
+        class AllocatorScope
+        {
+          public:
+            explicit AllocatorScope(const AllocatorOps &ops) noexcept : previous_(active_allocator()) {
+                active_allocator() = &ops;
+            }
+            AllocatorScope(const AllocatorScope &)            = delete;
+            AllocatorScope &operator=(const AllocatorScope &) = delete;
+            ~AllocatorScope() { active_allocator() = previous_; }
+
+          private:
+            const AllocatorOps *previous_{nullptr};
+        };
+
         /**
          * Concept satisfied by binding types that expose a ``StoragePlan``
          * via ``plan()`` / ``checked_plan()``. Used by ``ErasedOwner`` to
@@ -683,9 +727,9 @@ namespace hgraph
                 }
 
                 if constexpr (std::is_void_v<Binding>) {
-                    construct_owned_copy(*other.plan(), other.data(), *other.allocator());
+                    construct_owned_copy(*other.plan(), other.data(), other.allocator()->copy_allocator());
                 } else {
-                    construct_owned_copy(*other.binding(), other.data(), *other.allocator());
+                    construct_owned_copy(*other.binding(), other.data(), other.allocator()->copy_allocator());
                 }
             }
 
@@ -698,9 +742,9 @@ namespace hgraph
                     reset();
                     if (other.has_value()) {
                         if constexpr (std::is_void_v<Binding>) {
-                            construct_owned_copy(*other.plan(), other.data(), *other.allocator());
+                            construct_owned_copy(*other.plan(), other.data(), other.allocator()->copy_allocator());
                         } else {
-                            construct_owned_copy(*other.binding(), other.data(), *other.allocator());
+                            construct_owned_copy(*other.binding(), other.data(), other.allocator()->copy_allocator());
                         }
                     } else {
                         m_identity = other.m_identity;
@@ -871,9 +915,9 @@ namespace hgraph
                 }
 
                 if constexpr (std::is_void_v<Binding>) {
-                    return owning_copy(*plan(), data(), *allocator());
+                    return owning_copy(*plan(), data(), allocator()->copy_allocator());
                 } else {
-                    return owning_copy(*binding(), data(), *allocator());
+                    return owning_copy(*binding(), data(), allocator()->copy_allocator());
                 }
             }
 
@@ -1527,12 +1571,17 @@ namespace hgraph
             return (offset + mask) & ~mask;
         }
 
-        [[nodiscard]] static void *default_allocate(StorageLayout layout) {
+        [[nodiscard]] static const AllocatorOps *&active_allocator() noexcept {
+            static thread_local const AllocatorOps *active{nullptr};
+            return active;
+        }
+
+        [[nodiscard]] static void *default_allocate(void *, StorageLayout layout) {
             if (!layout.valid()) { throw std::logic_error("MemoryUtils::AllocatorOps requires a valid layout"); }
             return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
         }
 
-        static void default_deallocate(void *memory, StorageLayout layout) noexcept {
+        static void default_deallocate(void *, void *memory, StorageLayout layout) noexcept {
             if (memory != nullptr && layout.valid()) { ::operator delete(memory, std::align_val_t{layout.alignment}); }
         }
 
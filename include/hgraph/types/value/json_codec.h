@@ -16,6 +16,8 @@ namespace hgraph
     {
         /** Minimal recursive-descent JSON reader; parsing is meta-directed. */
         struct Reader;
+        /** A simdjson on-demand value the converter tree walks in place. */
+        struct DocumentValue;
     }  // namespace json_detail
 
     /**
@@ -31,15 +33,23 @@ namespace hgraph
      * HH:MM:SS.ffffff"``, times ``"HH:MM:SS.ffffff"``, timedeltas
      * ``"D:H:M:S.ffffff"``), bundles/tuples as objects/arrays, lists and sets
      * as arrays, maps as objects (non-string keys rendered then quoted).
+     *
+     * Each converter carries two read thunks: ``read_`` over the
+     * recursive-descent ``Reader`` (fragment cursors, leaf text forms) and
+     * ``read_document_`` over a simdjson on-demand document, which whole-text
+     * reads use — unknown bundle fields are skipped by the parser without
+     * being decoded.
      */
     class HGRAPH_EXPORT JsonConverter
     {
       public:
         using WriteFn = void (*)(const JsonConverter &, const ValueView &, std::string &);
         using ReadFn  = Value (*)(const JsonConverter &, json_detail::Reader &);
+        using DocumentReadFn = Value (*)(const JsonConverter &, json_detail::DocumentValue &);
 
         void write(const ValueView &view, std::string &out) const { write_(*this, view, out); }
         [[nodiscard]] Value read(json_detail::Reader &reader) const;
+        [[nodiscard]] Value read(json_detail::DocumentValue &value) const;
 
         /** Which atomic wire form this converter uses (Atomic kinds only). */
         enum class AtomicTag : unsigned char
@@ -65,6 +75,7 @@ namespace hgraph
 
         WriteFn                            write_{nullptr};
         ReadFn                             read_{nullptr};
+        DocumentReadFn                     read_document_{nullptr};
         const ValueTypeMetaData           *meta{nullptr};
         ValueTypeRef binding{nullptr};   ///< construction binding for reads
         AtomicTag                          atomic_tag{AtomicTag::None};
@@ -104,6 +115,16 @@ namespace hgraph
     /** Parse with a pre-resolved converter (the node-State fast path). */
     [[nodiscard]] HGRAPH_EXPORT Value from_json_string(const JsonConverter &converter, std::string_view text);
 
+    /**
+     * Parse a newline-delimited stream of ``converter`` documents (NDJSON),
+     * appending one value per document to ``out``. The stream is indexed in
+     * fixed 1 MB batches rather than document by document, so a single
+     * document larger than a batch is rejected. This is a library entry
+     * point for callers holding a whole stream; no operator wraps it.
+     */
+    HGRAPH_EXPORT void from_json_lines(const JsonConverter &converter, std::string_view text,
+                                       std::vector<Value> &out);
+
     /**
      * Fragment cursor: lets TS-aware operators (the friendly JSON delta
      * forms) drive object/array structure themselves while delegating leaf
@@ -127,6 +148,8 @@ namespace hgraph
         HGRAPH_EXPORT std::string parse_string(Cursor &cursor);
         /** Parse one meta-directed value at the cursor. */
         HGRAPH_EXPORT Value parse_value(const JsonConverter &converter, Cursor &cursor);
+        /** Read an object key's unquoted content as a value of the converter's type. */
+        HGRAPH_EXPORT Value parse_key(const JsonConverter &converter, std::string_view key_text);
         /** Throw a parse error at the cursor position. */
         [[noreturn]] HGRAPH_EXPORT void fail(Cursor &cursor, std::string_view message);
     }  // namespace json_fragment
@@ -86,6 +86,10 @@ namespace hgraph
      * row values), then ``finish`` into a ``Frame``. Constructed in a node's
      * ``start`` (against the pre-resolved converter) and finished in
      * ``stop``. Move-only; Arrow internals stay behind the pimpl.
+     *
+     * ``finish`` leaves the recorder empty and ready for further appends,
+     * so a long recording can be drained in chunks (``FrameStreamWriter``
+     * flushes one record batch per chunk).
      */
     class HGRAPH_EXPORT FrameRecorder
     {
@@ -98,6 +102,8 @@ namespace hgraph
         ~FrameRecorder();
 
         void append(DateTime value_time, DateTime as_of, const ValueView &value);
+        /** Rows appended since construction or the last ``finish``. */
+        [[nodiscard]] std::int64_t rows() const noexcept;
         [[nodiscard]] Frame finish();
 
       private:
@@ -105,6 +111,35 @@ namespace hgraph
         std::unique_ptr<Impl> impl_;
     };
 
+    /**
+     * A ``FrameRecorder`` drained to a local Arrow IPC stream file in the
+     * converter's ``[date, as_of, *columns]`` layout. Buffered rows are
+     * written as one record batch every ``batch_rows`` appends, or once they
+     * span ``flush_interval`` of value time (zero disables the time
+     * trigger), so resident memory is bounded by one batch rather than the
+     * run length. Opening truncates ``path``; ``close`` flushes the final
+     * partial batch and writes the end-of-stream marker (the destructor
+     * closes best-effort when ``close`` was not reached).
+     */
+    class HGRAPH_EXPORT FrameStreamWriter
+    {
+      public:
+        FrameStreamWriter(const TableConverter &converter, const std::string &path, std::int64_t batch_rows,
+                          TimeDelta flush_interval = TimeDelta{0});
+        FrameStreamWriter(const FrameStreamWriter &)            = delete;
+        FrameStreamWriter &operator=(const FrameStreamWriter &) = delete;
+        ~FrameStreamWriter();
+
+        void append(DateTime value_time, DateTime as_of, const ValueView &value);
+        /** Write the buffered rows as one record batch (no-op when empty). */
+        void flush();
+        void close();
+
+      private:
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
     /** The ``date_key`` (value-time) column entry for ``row``. */
     [[nodiscard]] HGRAPH_EXPORT DateTime frame_value_time(const TableConverter &converter, const Frame &frame,
                                                           std::int64_t row);
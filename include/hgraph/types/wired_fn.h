@@ -27,6 +27,8 @@ namespace hgraph
         using EvalValuesThunk = Value (*)(std::span<const ValueView>);
         using EvalBoundValuesThunk = Value (*)(ValueTypeRef, std::span<const ValueView>);
         using EvalIntoThunk = void (*)(TSDataMutationView &, std::span<const ValueView>);
+        using EvalAssignThunk = void (*)(const ValueView &, std::span<const ValueView>);
+        using EvalColumnsThunk = void (*)(std::span<const void *const>, void *, std::size_t);
 
         const char *name{nullptr};
         const std::type_info *identity{nullptr};
@@ -38,6 +40,10 @@ namespace hgraph
         EvalValuesThunk eval_values_fn{nullptr};
         EvalBoundValuesThunk eval_bound_values_fn{nullptr};
         EvalIntoThunk eval_into_fn{nullptr};
+        EvalAssignThunk eval_assign_fn{nullptr};
+        EvalColumnsThunk eval_columns_fn{nullptr};
+        /** Byte width of each argument column followed by the result column; set with ``eval_columns_fn``. */
+        const std::size_t *column_widths{nullptr};
         Value (*identity_value_fn)() = nullptr;
 
         bool associative{false};
@@ -91,6 +97,50 @@ namespace hgraph
             if (eval_into_fn == nullptr) { throw std::logic_error("LiftedKernel has no in-place eval thunk"); }
             eval_into_fn(destination, args);
         }
+
+        /** Whether ``eval_assign`` can write a result into existing storage. */
+        [[nodiscard]] bool can_eval_assign() const noexcept { return eval_assign_fn != nullptr; }
+
+        /**
+         * Assign the result into ``destination``, a mutation view over a live
+         * value of the output value type. No value is allocated, so fused
+         * kernels can chain through per-node scratch storage.
+         */
+        void eval_assign(const ValueView &destination, std::span<const ValueView> args) const
+        {
+            if (eval_assign_fn == nullptr) { throw std::logic_error("LiftedKernel has no assigning eval thunk"); }
+            eval_assign_fn(destination, args);
+        }
+
+        /** Whether ``eval_columns`` can apply the kernel over packed columns. */
+        [[nodiscard]] bool can_eval_columns() const noexcept
+        {
+            return eval_columns_fn != nullptr && column_widths != nullptr;
+        }
+
+        /** Byte width of argument column ``index``; ``index == arity`` is the result column. */
+        [[nodiscard]] std::size_t column_width(std::size_t index) const
+        {
+            if (column_widths == nullptr) { throw std::logic_error("LiftedKernel has no column layout"); }
+            if (index > arity) { throw std::out_of_range("LiftedKernel column index out of range"); }
+            return column_widths[index];
+        }
+
+        /**
+         * Apply the kernel ``count`` times over contiguous argument columns,
+         * writing the results contiguously into ``out``. Only kernels over
+         * arithmetic scalars provide it; the loop is selected for the widest
+         * vector ISA the CPU supports.
+         */
+        void eval_columns(std::span<const void *const> columns, void *out, std::size_t count) const
+        {
+            if (eval_columns_fn == nullptr) { throw std::logic_error("LiftedKernel has no column eval thunk"); }
+            if (columns.size() != arity)
+            {
+                throw std::invalid_argument("lifted function column count does not match the kernel arity");
+            }
+            eval_columns_fn(columns, out, count);
+        }
     };
 
     /**
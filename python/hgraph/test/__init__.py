@@ -1,7 +1,7 @@
 """hgraph.test - the test utilities (hgraph-compatible import path)."""
 from contextlib import contextmanager
 
-from _hgraph import EvaluationProfiler, EvaluationProfileEntry, EvaluationProfilePhase, EvaluationProfileSnapshot, EvaluationTrace, GraphDiagnostics, WiringTracer
+from _hgraph import EvaluationProfiler, EvaluationProfileEntry, EvaluationProfilePhase, EvaluationProfileSnapshot, EvaluationTimeline, EvaluationTrace, GraphDiagnostics, WiringTracer
 
 from .._wiring import eval_node
 from ._breakpoint import breakpoint_
@@ -25,7 +25,8 @@ def use_wiring(wiring):
 __all__ = [
     "breakpoint_",
     "eval_node", "EvaluationProfiler", "EvaluationProfileEntry",
-    "EvaluationProfilePhase", "EvaluationProfileSnapshot", "EvaluationTrace", "WiringTracer",
+    "EvaluationProfilePhase", "EvaluationProfileSnapshot", "EvaluationTimeline", "EvaluationTrace",
+    "WiringTracer",
     "GraphDiagnostics",
     "use_wiring",
 ]
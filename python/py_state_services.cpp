@@ -215,6 +215,11 @@ namespace hgraph::python_bridge
         config.model = model;
         record_replay::set_config(state.view(), std::move(config));
     });
+    m.def("_set_record_replay_directory", [](GlobalState &state, const std::string &directory) {
+        auto config = record_replay::config(state.view());
+        config.directory = directory;
+        record_replay::set_config(state.view(), std::move(config));
+    });
     m.def("_set_pooled_compound_scalar_storage",
           [](GlobalState &state, bool enabled) {
               set_pooled_compound_scalar_storage(state.view(), enabled);
@@ -547,6 +552,7 @@ namespace hgraph::python_bridge
     m.attr("IN_MEMORY")       = std::string{record_replay::IN_MEMORY};
     m.attr("IN_MEMORY_DENSE")  = std::string{record_replay::IN_MEMORY_DENSE};
     m.attr("DATA_FRAME")       = std::string{record_replay::DATA_FRAME};
+    m.attr("MEMORY_MAPPED")    = std::string{record_replay::MEMORY_MAPPED};
     m.attr("MIN_ST")     = nb::cast(MIN_ST);
     m.attr("MIN_TD")     = nb::cast(MIN_TD);
     m.attr("MAX_DT")     = nb::cast(MAX_DT);
@@ -949,12 +955,12 @@ namespace hgraph::python_bridge
         // relative deltas; a non-empty tag replaces any prior event under it.
         .def("schedule",
              [](const PyScheduler &self, DateTime when, std::optional<std::string> tag, bool on_wall_clock) {
-                 self.scheduler.schedule(when, std::move(tag), on_wall_clock);
+                 self.scheduler.schedule(when, tag ? std::string_view{*tag} : std::string_view{}, on_wall_clock);
              },
              nb::arg("when"), nb::arg("tag") = nb::none(), nb::arg("on_wall_clock") = false)
         .def("schedule",
              [](const PyScheduler &self, TimeDelta delta, std::optional<std::string> tag, bool on_wall_clock) {
-                 self.scheduler.schedule(delta, std::move(tag), on_wall_clock);
+                 self.scheduler.schedule(delta, tag ? std::string_view{*tag} : std::string_view{}, on_wall_clock);
              },
              nb::arg("when"), nb::arg("tag") = nb::none(), nb::arg("on_wall_clock") = false)
         .def("schedule_delta", [](const PyScheduler &self, TimeDelta delta) { self.scheduler.schedule(delta); })
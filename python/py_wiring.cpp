@@ -666,6 +666,11 @@ namespace hgraph::python_bridge
                 owned.push_back(std::make_unique<EvaluationProfiler>(
                     nb::cast<const EvaluationProfiler &>(observer)));
             }
+            else if (nb::isinstance<EvaluationTimeline>(observer))
+            {
+                owned.push_back(std::make_unique<EvaluationTimeline>(
+                    nb::cast<const EvaluationTimeline &>(observer)));
+            }
             else if (nb::isinstance<GraphDiagnostics>(observer))
             {
                 owned.push_back(std::make_unique<GraphDiagnostics>(
@@ -839,30 +844,67 @@ namespace hgraph::python_bridge
         .def_ro("total_time", &EvaluationProfilePhase::total_time)
         .def_ro("max_time", &EvaluationProfilePhase::max_time)
         .def_ro("recent_time", &EvaluationProfilePhase::recent_time);
+    nb::class_<EvaluationLatencyHistogram>(m, "EvaluationLatencyHistogram")
+        .def_prop_ro("count", &EvaluationLatencyHistogram::count)
+        .def_prop_ro("max", &EvaluationLatencyHistogram::max)
+        .def_prop_ro("p50", &EvaluationLatencyHistogram::p50)
+        .def_prop_ro("p99", &EvaluationLatencyHistogram::p99)
+        .def_prop_ro("p999", &EvaluationLatencyHistogram::p999)
+        .def("percentile", &EvaluationLatencyHistogram::percentile, nb::arg("fraction"));
+    nb::class_<EvaluationHardwareCounters>(m, "EvaluationHardwareCounters")
+        .def_ro("cycles", &EvaluationHardwareCounters::cycles)
+        .def_ro("instructions", &EvaluationHardwareCounters::instructions)
+        .def_ro("llc_misses", &EvaluationHardwareCounters::llc_misses)
+        .def_ro("branch_misses", &EvaluationHardwareCounters::branch_misses)
+        .def_prop_ro("ipc", &EvaluationHardwareCounters::ipc);
     nb::class_<EvaluationProfileEntry>(m, "EvaluationProfileEntry")
         .def_ro("path", &EvaluationProfileEntry::path)
         .def_ro("label", &EvaluationProfileEntry::label)
         .def_ro("graph", &EvaluationProfileEntry::graph)
         .def_ro("start", &EvaluationProfileEntry::start)
         .def_ro("evaluation", &EvaluationProfileEntry::evaluation)
-        .def_ro("stop", &EvaluationProfileEntry::stop);
+        .def_ro("stop", &EvaluationProfileEntry::stop)
+        .def_ro("evaluation_latency", &EvaluationProfileEntry::evaluation_latency)
+        .def_ro("hardware_counters", &EvaluationProfileEntry::hardware_counters);
     nb::class_<EvaluationProfileSnapshot>(m, "EvaluationProfileSnapshot")
         .def_ro("graph_cycles", &EvaluationProfileSnapshot::graph_cycles)
+        .def_ro("sampled_cycles", &EvaluationProfileSnapshot::sampled_cycles)
         .def_ro("wall_time", &EvaluationProfileSnapshot::wall_time)
         .def_ro("root_evaluation_time", &EvaluationProfileSnapshot::root_evaluation_time)
         .def_ro("scheduling_lag_total", &EvaluationProfileSnapshot::scheduling_lag_total)
         .def_ro("scheduling_lag_max", &EvaluationProfileSnapshot::scheduling_lag_max)
         .def_ro("scheduling_lag_samples", &EvaluationProfileSnapshot::scheduling_lag_samples)
         .def_ro("runtime_load", &EvaluationProfileSnapshot::runtime_load)
+        .def_ro("cycle_duration", &EvaluationProfileSnapshot::cycle_duration)
+        .def_ro("push_queue_dwell", &EvaluationProfileSnapshot::push_queue_dwell)
+        .def_ro("push_to_sink", &EvaluationProfileSnapshot::push_to_sink)
+        .def_ro("hardware_counters_available",
+                &EvaluationProfileSnapshot::hardware_counters_available)
+        .def_ro("hardware_counters_error", &EvaluationProfileSnapshot::hardware_counters_error)
         .def_ro("entries", &EvaluationProfileSnapshot::entries);
     nb::class_<EvaluationProfiler>(m, "EvaluationProfiler")
-        .def(nb::init<bool, bool, bool, bool, bool, std::size_t>(),
+        .def(nb::init<bool, bool, bool, bool, bool, std::size_t, bool, std::size_t, bool, bool>(),
              nb::arg("start") = true, nb::arg("eval") = true,
              nb::arg("stop") = true, nb::arg("node") = true,
-             nb::arg("graph") = true, nb::arg("recent_window") = 100)
+             nb::arg("graph") = true, nb::arg("recent_window") = 100,
+             nb::arg("histograms") = true, nb::arg("sample_every") = 1,
+             nb::arg("hardware_counters") = false, nb::arg("node_histograms") = false)
         .def("snapshot", &EvaluationProfiler::snapshot)
         .def("reset", &EvaluationProfiler::reset);
 
+    nb::class_<EvaluationTimeline>(m, "EvaluationTimeline")
+        .def(nb::init<std::size_t, bool, bool, bool>(),
+             nb::arg("capacity") = std::size_t{1} << 20, nb::arg("node") = true,
+             nb::arg("graph") = true, nb::arg("lifecycle") = true)
+        .def_prop_ro("size", &EvaluationTimeline::size)
+        .def_prop_ro("dropped", &EvaluationTimeline::dropped)
+        .def("clear", &EvaluationTimeline::clear)
+        .def("write_chrome_trace",
+             [](const EvaluationTimeline &self, const std::string &path) {
+                 self.write_chrome_trace(std::filesystem::path{path});
+             },
+             nb::arg("path"));
+
     nb::enum_<GraphDiagnosticEntityKind>(m, "GraphDiagnosticEntityKind")
         .value("GRAPH", GraphDiagnosticEntityKind::Graph)
         .value("NODE", GraphDiagnosticEntityKind::Node);
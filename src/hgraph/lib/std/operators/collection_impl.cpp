@@ -1,10 +1,25 @@
 #include <hgraph/lib/std/operators/container.h>
 #include <hgraph/lib/std/operators/impl/collection_impl.h>
+#include <hgraph/runtime/graph_checkpoint.h>
+
+namespace hgraph
+{
+    // The running moments rescan their collection whenever the source differs,
+    // which it always does after a restore.
+    template <typename T>
+    struct checkpoint_state<stdlib::collection_impl_detail::CollectionAggregateState<T>>
+        : checkpoint_state_rebuilt<stdlib::collection_impl_detail::CollectionAggregateState<T>>
+    {
+    };
+}  // namespace hgraph
 
 namespace hgraph::stdlib
 {
     void register_collection_operators()
     {
+        register_checkpoint_state<collection_impl_detail::CollectionAggregateState<Int>>();
+        register_checkpoint_state<collection_impl_detail::CollectionAggregateState<Float>>();
+
         using tsl_itemwise_impl_detail::tsl_binary_map;
         using tsl_itemwise_impl_detail::tsl_lhs_broadcast_map;
         using tsl_itemwise_impl_detail::tsl_rhs_broadcast_map;
@@ -247,6 +247,13 @@ namespace hgraph::stdlib
             }
         }
 
+        std::optional<DateTime> next_from_frame_time(const FromFramePlan &plan)
+        {
+            const auto rows = plan.frame.has_value() ? frame_rows(plan.frame) : 0;
+            if (plan.row >= rows) { return std::nullopt; }
+            return read_dt(plan.frame, plan.dt_col, plan.row) + plan.offset;
+        }
+
         // -----------------------------------------------------------------
         // replay_data_frame
         // -----------------------------------------------------------------
@@ -1617,6 +1624,9 @@ namespace hgraph::stdlib
         register_overload<from_data_frame, from_data_frame_impl>();
         register_overload<from_data_frame_batches, from_data_frame_batches_impl>();
         register_overload<replay_data_frame, replay_data_frame_impl>();
+        register_overload<from_arrow_stream, from_arrow_stream_impl>();
+        register_overload<from_parquet, from_parquet_impl>();
+        register_overload<to_arrow_stream, to_arrow_stream_impl>();
         register_overload<to_data_frame, to_data_frame_tsd_impl>();
         register_overload<to_data_frame, to_data_frame_impl>();
         register_overload<group_by, group_by_impl>();
@@ -0,0 +1,166 @@
+#include <hgraph/lib/std/operators/impl/data_frame_impl.h>
+
+#include <arrow/api.h>
+#include <arrow/io/buffered.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <fmt/format.h>
+
+#if HGRAPH_WITH_PARQUET
+#include <parquet/arrow/reader.h>
+#include <parquet/properties.h>
+#endif
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace hgraph::stdlib::data_frame_detail
+{
+    namespace
+    {
+        /** Read buffer between the file and the IPC decoder. */
+        constexpr std::int64_t stream_read_buffer_bytes = std::int64_t{1} << 20;
+        /** Rows per record batch decoded from a Parquet row group. */
+        constexpr std::int64_t parquet_batch_rows = 65536;
+
+        [[nodiscard]] const char *operator_name(FrameFileFormat format) noexcept
+        {
+            return format == FrameFileFormat::Parquet ? "from_parquet" : "from_arrow_stream";
+        }
+
+        void check(const arrow::Status &status, FrameFileFormat format, const char *what)
+        {
+            if (!status.ok())
+            {
+                throw std::runtime_error(
+                    fmt::format("{}: {} failed: {}", operator_name(format), what, status.ToString()));
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] T unwrap(arrow::Result<T> result, FrameFileFormat format, const char *what)
+        {
+            check(result.status(), format, what);
+            return std::move(result).ValueUnsafe();
+        }
+    }  // namespace
+
+    struct FrameStreamSource
+    {
+        FrameFileFormat                                   format{FrameFileFormat::ArrowStream};
+        std::string                                       dt_col{};
+        std::string                                       key_col{};
+        std::string                                       value_col{};
+        TimeDelta                                         offset{};
+        std::shared_ptr<void>                             owner{};    // keeps a format reader alive under `reader`
+        std::shared_ptr<arrow::RecordBatchReader>         reader{};
+        std::future<std::shared_ptr<arrow::RecordBatch>> ahead{};     // declared after `reader`: joins first
+        std::unique_ptr<FromFramePlan>                    plan{};
+
+        void open(const std::string &path)
+        {
+            auto file = unwrap(arrow::io::ReadableFile::Open(path), format, "open file");
+            if (format == FrameFileFormat::ArrowStream)
+            {
+                auto buffered = unwrap(arrow::io::BufferedInputStream::Create(
+                                           stream_read_buffer_bytes, arrow::default_memory_pool(), std::move(file)),
+                                       format, "buffer file");
+                reader = unwrap(arrow::ipc::RecordBatchStreamReader::Open(std::move(buffered)), format,
+                                "open IPC stream");
+                return;
+            }
+#if HGRAPH_WITH_PARQUET
+            parquet::ReaderProperties properties{arrow::default_memory_pool()};
+            properties.enable_buffered_stream();
+            parquet::ArrowReaderProperties arrow_properties;
+            arrow_properties.set_batch_size(parquet_batch_rows);
+            arrow_properties.set_pre_buffer(true);
+            parquet::arrow::FileReaderBuilder builder;
+            check(builder.Open(std::move(file), properties), format, "open Parquet file");
+            builder.properties(arrow_properties);
+            std::unique_ptr<parquet::arrow::FileReader> file_reader;
+            check(builder.Build(&file_reader), format, "build Parquet reader");
+            reader = unwrap(file_reader->GetRecordBatchReader(), format, "open Parquet batches");
+            owner  = std::shared_ptr<parquet::arrow::FileReader>{std::move(file_reader)};
+#else
+            static_cast<void>(parquet_batch_rows);
+            throw std::runtime_error(
+                "from_parquet: this build has no Parquet support (configure with HGRAPH_WITH_PARQUET=ON)");
+#endif
+        }
+
+        /** Decode the following batch on a background thread while the graph consumes the current one. */
+        void read_ahead()
+        {
+            ahead = std::async(std::launch::async, [this] {
+                std::shared_ptr<arrow::RecordBatch> batch;
+                check(reader->ReadNext(&batch), format, "read record batch");
+                return batch;
+            });
+        }
+
+        /** The read-ahead batch (null at the end of the file), issuing the next read. */
+        [[nodiscard]] std::shared_ptr<arrow::RecordBatch> next_batch()
+        {
+            if (!ahead.valid()) { return nullptr; }
+            auto batch = ahead.get();
+            if (batch != nullptr) { read_ahead(); }
+            return batch;
+        }
+
+        /**
+         * Move the plan onto the next batch holding a row at or after
+         * ``start_time``. False (and no plan) once the file is exhausted.
+         */
+        bool load_next(DateTime start_time, const TSOutputView &out)
+        {
+            while (auto batch = next_batch())
+            {
+                if (batch->num_rows() == 0) { continue; }
+                const Frame   frame{unwrap(arrow::Table::FromRecordBatches({std::move(batch)}), format,
+                                           "wrap record batch")};
+                FromFramePlan *loaded = nullptr;
+                load_from_frame(frame, dt_col, key_col, value_col, offset, start_time, out, loaded);
+                plan.reset(loaded);
+                if (next_from_frame_time(*plan).has_value()) { return true; }
+            }
+            plan.reset();
+            return false;
+        }
+    };
+
+    void start_from_stream(FrameFileFormat format, std::string_view path, std::string_view dt_col,
+                           std::string_view key_col, std::string_view value_col, TimeDelta offset,
+                           DateTime start_time, const TSOutputView &out, SingleShotScheduler &sched,
+                           FrameStreamSource *&source_out)
+    {
+        auto source = std::make_unique<FrameStreamSource>();
+        source->format    = format;
+        source->dt_col    = std::string{dt_col};
+        source->key_col   = std::string{key_col};
+        source->value_col = std::string{value_col};
+        source->offset    = offset;
+        source->open(std::string{path});
+        source->read_ahead();
+        if (source->load_next(start_time, out)) { sched.schedule(*next_from_frame_time(*source->plan)); }
+        source_out = source.release();
+    }
+
+    void eval_from_stream(FrameStreamSource &source, DateTime now, NodeScheduler &sched, const TSOutputView &out)
+    {
+        // Rows stamped ``now`` may straddle a batch boundary: keep emitting
+        // until a batch still has rows left (which eval_from_frame has
+        // scheduled) or the file ends.
+        while (source.plan != nullptr)
+        {
+            eval_from_frame(*source.plan, now, sched, out);
+            if (next_from_frame_time(*source.plan).has_value()) { return; }
+            if (!source.load_next(now, out)) { return; }
+        }
+    }
+
+    void release_stream_source(FrameStreamSource *source) noexcept { delete source; }
+}  // namespace hgraph::stdlib::data_frame_detail
@@ -769,13 +769,11 @@ namespace hgraph::stdlib
                     }
                     auto mutation = dict.begin_mutation(dict.evaluation_time());
                     if (json_fragment::consume(cursor, '}')) { return; }
-                    const auto *key_meta   = dict.schema()->key_type();
-                    const bool  string_key = key_meta == scalar_descriptor<Str>::value_meta();
+                    const auto &key_converter = json_converter(dict.schema()->key_type());
                     while (true)
                     {
-                        const std::string key_text = json_fragment::parse_string(cursor);
-                        const Value       key =
-                            string_key ? Value{Str{key_text}} : from_json_string(key_meta, key_text);
+                        const Value key =
+                            json_fragment::parse_key(key_converter, json_fragment::parse_string(cursor));
                         if (!json_fragment::consume(cursor, ':'))
                         {
                             json_fragment::fail(cursor, "expected ':' after a TSD key");
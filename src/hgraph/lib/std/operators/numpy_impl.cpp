@@ -570,28 +570,6 @@ namespace hgraph::stdlib
                 "quantile");
         }
 
-        template <typename T>
-        Float quantile(const TSWInputView &input, Float q, std::string_view method)
-        {
-            std::vector<T> values;
-            values.reserve(input.size());
-            for (std::size_t index = 0; index < input.size(); ++index)
-            {
-                values.push_back(input.at(index).checked_as<T>());
-            }
-            if (values.empty()) { throw std::invalid_argument("quantile requires at least one value"); }
-            if (!(q >= 0.0 && q <= 1.0))
-            {
-                throw std::invalid_argument("quantile q must be in [0, 1]");
-            }
-            const arrow::compute::QuantileOptions options{
-                q, quantile_interpolation(method), false, 1};
-            return numeric_array_scalar(
-                checked_arrow_result(
-                    arrow::compute::Quantile(numeric_datum(values), options), "quantile"),
-                "quantile");
-        }
-
         template <typename T>
         Float standard_deviation(ValueView input, Int ddof)
         {
@@ -621,8 +599,6 @@ namespace hgraph::stdlib
                                           const ValueTypeMetaData *);
         template Float quantile<Int>(ValueView, Float, std::string_view);
         template Float quantile<Float>(ValueView, Float, std::string_view);
-        template Float quantile<Int>(const TSWInputView &, Float, std::string_view);
-        template Float quantile<Float>(const TSWInputView &, Float, std::string_view);
         template Float standard_deviation<Int>(ValueView, Int);
         template Float standard_deviation<Float>(ValueView, Int);
     }  // namespace numpy_detail
@@ -0,0 +1,98 @@
+#include <hgraph/lib/std/operators/impl/record_replay_mmap_impl.h>
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace hgraph::stdlib
+{
+    namespace record_replay_mmap_detail
+    {
+        namespace
+        {
+            void check(const arrow::Status &status, const char *what)
+            {
+                if (!status.ok())
+                {
+                    throw std::runtime_error(std::string{"memory-mapped record/replay: "} + what +
+                                             " failed: " + status.ToString());
+                }
+            }
+
+            template <typename T>
+            [[nodiscard]] T unwrap(arrow::Result<T> result, const char *what)
+            {
+                check(result.status(), what);
+                return std::move(result).ValueUnsafe();
+            }
+        }  // namespace
+
+        std::filesystem::path recording_path(std::string_view directory, std::string_view fq_key)
+        {
+            std::string file{fq_key};
+            std::ranges::replace(file, '/', '_');
+            std::ranges::replace(file, '\\', '_');
+            return std::filesystem::path{directory} / (file + ".arrows");
+        }
+
+        struct MappedFrameReader::Impl
+        {
+            const TableConverter                               *converter{nullptr};
+            std::shared_ptr<arrow::io::MemoryMappedFile>        file{};
+            std::shared_ptr<arrow::ipc::RecordBatchStreamReader> reader{};
+            Frame                                               batch{};
+            std::int64_t                                        row{0};
+
+            /** Move the cursor onto the next non-empty batch; an empty ``batch`` marks the end. */
+            void advance_batch()
+            {
+                batch = Frame{};
+                row   = 0;
+                std::shared_ptr<arrow::RecordBatch> next;
+                do
+                {
+                    check(reader->ReadNext(&next), "read record batch");
+                } while (next != nullptr && next->num_rows() == 0);
+                if (next == nullptr) { return; }
+                batch = Frame{unwrap(arrow::Table::FromRecordBatches({std::move(next)}), "wrap record batch")};
+            }
+        };
+
+        MappedFrameReader::MappedFrameReader(const TableConverter &converter, const std::filesystem::path &path)
+            : impl_(std::make_unique<Impl>())
+        {
+            impl_->converter = &converter;
+            impl_->file = unwrap(arrow::io::MemoryMappedFile::Open(path.string(), arrow::io::FileMode::READ),
+                                 "map recording");
+            impl_->reader = unwrap(arrow::ipc::RecordBatchStreamReader::Open(impl_->file), "open IPC stream");
+            impl_->advance_batch();
+        }
+
+        MappedFrameReader::~MappedFrameReader() = default;
+
+        bool MappedFrameReader::exhausted() const noexcept { return !impl_->batch.has_value(); }
+
+        DateTime MappedFrameReader::next_time() const
+        {
+            return frame_value_time(*impl_->converter, impl_->batch, impl_->row);
+        }
+
+        Value MappedFrameReader::read_next()
+        {
+            Value value = read_row(*impl_->converter, impl_->batch, impl_->row);
+            if (++impl_->row == frame_rows(impl_->batch)) { impl_->advance_batch(); }
+            return value;
+        }
+    }  // namespace record_replay_mmap_detail
+
+    void register_record_replay_mmap_operators()
+    {
+        register_overload<record, record_mmap_impl>();
+        register_overload<replay, replay_mmap_impl>();
+    }
+}  // namespace hgraph::stdlib
@@ -21,6 +21,7 @@ namespace hgraph::stdlib
         register_table_operators();
         register_data_frame_operators();
         register_record_replay_frame_operators();
+        register_record_replay_mmap_operators();
         register_stream_operators();
         register_series_operators();
         register_string_operators();
@@ -2,11 +2,123 @@
 #include <hgraph/lib/std/operators/impl/tsb_itemwise_impl.h>
 #include <hgraph/lib/std/operators/comparison.h>
 #include <hgraph/lib/std/operators/arithmetic.h>
+#include <hgraph/runtime/graph_checkpoint.h>
+
+namespace hgraph
+{
+    namespace
+    {
+        // Capacity, count, then the delta schema by name and each stamped
+        // delta; the capacity comes back as a reserve so the ring keeps its size.
+        template <typename Stamp>
+        void write_delta_ring(const stdlib::stream_impl_detail::DeltaRing<Stamp> &ring, CheckpointWriter &out)
+        {
+            out.pod(static_cast<std::uint64_t>(ring.capacity()));
+            out.pod(static_cast<std::uint64_t>(ring.size()));
+            if (ring.empty()) { return; }
+            out.schema(ring.front().schema());
+            for (std::size_t index = 0; index < ring.size(); ++index)
+            {
+                if constexpr (!std::is_same_v<Stamp, stdlib::stream_impl_detail::NoStamp>)
+                {
+                    out.pod(ring.stamp_at(index));
+                }
+                out.value(ring.at(index));
+            }
+        }
+
+        template <typename Stamp>
+        void read_delta_ring(stdlib::stream_impl_detail::DeltaRing<Stamp> &ring, CheckpointReader &in)
+        {
+            ring.reserve(static_cast<std::size_t>(in.pod<std::uint64_t>()));
+            auto count = in.pod<std::uint64_t>();
+            if (count == 0) { return; }
+            const ValueTypeMetaData *schema = in.schema();
+            for (; count > 0; --count)
+            {
+                Stamp stamp{};
+                if constexpr (!std::is_same_v<Stamp, stdlib::stream_impl_detail::NoStamp>) { stamp = in.pod<Stamp>(); }
+                ring.push_back(in.value(schema), stamp);
+            }
+        }
+    }  // namespace
+
+    template <>
+    struct checkpoint_state<stdlib::stream_impl_detail::DeltaQueueState>
+    {
+        static void write(const stdlib::stream_impl_detail::DeltaQueueState &state, CheckpointWriter &out)
+        {
+            write_delta_ring(state.buffer, out);
+        }
+
+        static void read(stdlib::stream_impl_detail::DeltaQueueState &state, CheckpointReader &in)
+        {
+            read_delta_ring(state.buffer, in);
+        }
+    };
+
+    template <>
+    struct checkpoint_state<stdlib::stream_impl_detail::TimedDeltaQueueState>
+    {
+        static void write(const stdlib::stream_impl_detail::TimedDeltaQueueState &state, CheckpointWriter &out)
+        {
+            write_delta_ring(state.buffer, out);
+        }
+
+        static void read(stdlib::stream_impl_detail::TimedDeltaQueueState &state, CheckpointReader &in)
+        {
+            read_delta_ring(state.buffer, in);
+        }
+    };
+
+    template <>
+    struct checkpoint_state<stdlib::stream_impl_detail::LagProxyState>
+    {
+        static void write(const stdlib::stream_impl_detail::LagProxyState &state, CheckpointWriter &out)
+        {
+            write_delta_ring(state.cache, out);
+        }
+
+        static void read(stdlib::stream_impl_detail::LagProxyState &state, CheckpointReader &in)
+        {
+            read_delta_ring(state.cache, in);
+        }
+    };
+
+    template <>
+    struct checkpoint_state<stdlib::stream_impl_detail::ThrottleState>
+    {
+        static void write(const stdlib::stream_impl_detail::ThrottleState &state, CheckpointWriter &out)
+        {
+            out.pod(state.period);
+            out.pod(state.has_period);
+            out.pod(static_cast<std::uint64_t>(state.pending.size()));
+            if (state.pending.empty()) { return; }
+            out.schema(state.pending.front().schema());
+            for (const Value &delta : state.pending) { out.value(delta.view()); }
+        }
+
+        static void read(stdlib::stream_impl_detail::ThrottleState &state, CheckpointReader &in)
+        {
+            state.period     = in.pod<TimeDelta>();
+            state.has_period = in.pod<bool>();
+            auto count       = in.pod<std::uint64_t>();
+            if (count == 0) { return; }
+            const ValueTypeMetaData *schema = in.schema();
+            for (; count > 0; --count) { state.pending.push_back(in.value(schema)); }
+        }
+    };
+}  // namespace hgraph
 
 namespace hgraph::stdlib
 {
     void register_stream_operators()
     {
+        register_checkpoint_state<stream_impl_detail::DeltaQueueState>();
+        register_checkpoint_state<stream_impl_detail::TimedDeltaQueueState>();
+        register_checkpoint_state<stream_impl_detail::LagProxyState>();
+        register_checkpoint_state<stream_impl_detail::ThrottleState>();
+
         register_overload<sample, sample_impl>();
         register_overload<filter_, filter_impl>();
         register_overload<lag, lag_tick_impl>();
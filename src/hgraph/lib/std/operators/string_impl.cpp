@@ -1,9 +1,51 @@
 #include <hgraph/lib/std/operators/impl/string_impl.h>
+#include <hgraph/runtime/graph_checkpoint.h>
+
+namespace hgraph
+{
+    template <>
+    struct checkpoint_state<stdlib::string_impl_detail::CompiledRegex>
+        : checkpoint_state_rebuilt<stdlib::string_impl_detail::CompiledRegex>
+    {
+    };
+
+    template <>
+    struct checkpoint_state<stdlib::string_impl_detail::ReplaceState>
+        : checkpoint_state_rebuilt<stdlib::string_impl_detail::ReplaceState>
+    {
+    };
+
+    template <>
+    struct checkpoint_state<stdlib::string_impl_detail::StringBufferState>
+        : checkpoint_state_rebuilt<stdlib::string_impl_detail::StringBufferState>
+    {
+    };
+
+    /** Only the sample counter carries over; the rendered values are scratch. */
+    template <>
+    struct checkpoint_state<stdlib::string_impl_detail::FormatState>
+    {
+        static void write(const stdlib::string_impl_detail::FormatState &state, CheckpointWriter &out)
+        {
+            out.pod(state.count);
+        }
+
+        static void read(stdlib::string_impl_detail::FormatState &state, CheckpointReader &in)
+        {
+            state.count = in.pod<Int>();
+        }
+    };
+}  // namespace hgraph
 
 namespace hgraph::stdlib
 {
     void register_string_operators()
     {
+        register_checkpoint_state<string_impl_detail::CompiledRegex>();
+        register_checkpoint_state<string_impl_detail::ReplaceState>();
+        register_checkpoint_state<string_impl_detail::StringBufferState>();
+        register_checkpoint_state<string_impl_detail::FormatState>();
+
         register_overload<match_, match_impl>();
         register_overload<replace, replace_impl>();
         register_overload<substr, substr_impl>();
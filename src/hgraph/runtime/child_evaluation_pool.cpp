@@ -0,0 +1,134 @@
+#include "child_evaluation_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hgraph::runtime_detail
+{
+    namespace
+    {
+        // Indices claimed per cursor bump. Child graphs are coarse units of
+        // work; a small grain keeps the tail balanced without making the
+        // shared cursor the hot spot.
+        constexpr std::size_t claim_grain = 4;
+
+        thread_local bool inside_pool_task = false;
+
+        struct Batch
+        {
+            ChildEvaluationPool::Task task{nullptr};
+            void                     *context{nullptr};
+            std::size_t               count{0};
+            std::atomic<std::size_t>  next{0};
+
+            void drain() noexcept
+            {
+                for (;;)
+                {
+                    const std::size_t begin = next.fetch_add(claim_grain, std::memory_order_relaxed);
+                    if (begin >= count) { return; }
+                    const std::size_t end = std::min(begin + claim_grain, count);
+                    for (std::size_t index = begin; index < end; ++index) { task(context, index); }
+                }
+            }
+        };
+    }  // namespace
+
+    struct ChildEvaluationPool::State
+    {
+        std::mutex              run_mutex{};
+        std::mutex              mutex{};
+        std::condition_variable wake{};
+        std::condition_variable detached{};
+        Batch                  *current{nullptr};
+        std::uint64_t           generation{0};
+        std::size_t             attached{0};
+        bool                    stopping{false};
+        std::vector<std::thread> workers{};
+
+        void worker_loop()
+        {
+            inside_pool_task = true;
+            std::uint64_t seen = 0;
+            std::unique_lock lock{mutex};
+            for (;;)
+            {
+                wake.wait(lock, [&] { return stopping || (current != nullptr && generation != seen); });
+                if (stopping) { return; }
+                seen = generation;
+                Batch *batch = current;
+                ++attached;
+                lock.unlock();
+                batch->drain();
+                lock.lock();
+                if (--attached == 0) { detached.notify_all(); }
+            }
+        }
+    };
+
+    ChildEvaluationPool &ChildEvaluationPool::instance()
+    {
+        static ChildEvaluationPool pool;
+        return pool;
+    }
+
+    ChildEvaluationPool::ChildEvaluationPool()
+        : state_(new State{})
+    {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        const std::size_t workers = hardware > 1 ? hardware - 1 : 0;
+        state_->workers.reserve(workers);
+        for (std::size_t index = 0; index < workers; ++index)
+        {
+            state_->workers.emplace_back([state = state_] { state->worker_loop(); });
+        }
+    }
+
+    ChildEvaluationPool::~ChildEvaluationPool()
+    {
+        {
+            std::lock_guard lock{state_->mutex};
+            state_->stopping = true;
+        }
+        state_->wake.notify_all();
+        for (auto &worker : state_->workers) { worker.join(); }
+        delete state_;
+    }
+
+    std::size_t ChildEvaluationPool::worker_count() const noexcept { return state_->workers.size(); }
+
+    void ChildEvaluationPool::run(std::size_t count, Task task, void *context) noexcept
+    {
+        if (count == 0) { return; }
+
+        std::unique_lock run_lock{state_->run_mutex, std::defer_lock};
+        if (count == 1 || state_->workers.empty() || inside_pool_task || !run_lock.try_lock())
+        {
+            for (std::size_t index = 0; index < count; ++index) { task(context, index); }
+            return;
+        }
+
+        Batch batch{.task = task, .context = context, .count = count};
+        {
+            std::lock_guard lock{state_->mutex};
+            state_->current = &batch;
+            ++state_->generation;
+        }
+        state_->wake.notify_all();
+
+        inside_pool_task = true;
+        batch.drain();
+        inside_pool_task = false;
+
+        // The batch lives on this frame: retire it and wait for every worker
+        // that attached to finish its claimed indices before returning.
+        std::unique_lock lock{state_->mutex};
+        state_->current = nullptr;
+        state_->detached.wait(lock, [&] { return state_->attached == 0; });
+    }
+}  // namespace hgraph::runtime_detail
@@ -0,0 +1,59 @@
+#ifndef HGRAPH_RUNTIME_CHILD_EVALUATION_POOL_H
+#define HGRAPH_RUNTIME_CHILD_EVALUATION_POOL_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hgraph::runtime_detail
+{
+    /**
+     * Process-wide worker pool used to fan out independent evaluations
+     * within one engine cycle: the due children of an opt-in parallel
+     * ``map_`` and the due nodes of one ``LevelParallel`` root level.
+     *
+     * ``run`` is a fork/join: the calling (engine) thread participates and
+     * returns only once every task index has executed. Indices are claimed
+     * from a shared cursor in small chunks, so an idle worker picks up the
+     * remaining work of a slower one instead of owning a fixed partition.
+     *
+     * A ``run`` issued from inside a pool task, or while another engine
+     * thread owns the pool, executes inline on the caller: nested fan-out
+     * never blocks on the pool it is running on. Tasks must not throw;
+     * callers capture failures per index and surface them after the join.
+     */
+    class ChildEvaluationPool
+    {
+      public:
+        using Task = void (*)(void *context, std::size_t index) noexcept;
+
+        [[nodiscard]] static ChildEvaluationPool &instance();
+
+        /** Number of background workers (the caller is not counted). */
+        [[nodiscard]] std::size_t worker_count() const noexcept;
+
+        void run(std::size_t count, Task task, void *context) noexcept;
+
+        template <typename Fn>
+        void run(std::size_t count, Fn &fn) noexcept
+        {
+            static_assert(std::is_nothrow_invocable_v<Fn &, std::size_t>,
+                          "ChildEvaluationPool tasks must be noexcept");
+            run(count,
+                [](void *context, std::size_t index) noexcept { (*static_cast<Fn *>(context))(index); },
+                &fn);
+        }
+
+        ChildEvaluationPool(const ChildEvaluationPool &)            = delete;
+        ChildEvaluationPool &operator=(const ChildEvaluationPool &) = delete;
+
+      private:
+        struct State;
+
+        ChildEvaluationPool();
+        ~ChildEvaluationPool();
+
+        State *state_{nullptr};
+    };
+}  // namespace hgraph::runtime_detail
+
+#endif  // HGRAPH_RUNTIME_CHILD_EVALUATION_POOL_H
@@ -1,5 +1,7 @@
 #include <hgraph/runtime/evaluation_profiler.h>
 
+#include "hardware_counters.h"
+
 #include <hgraph/runtime/diagnostic_path.h>
 #include <hgraph/runtime/executor.h>
 #include <hgraph/runtime/graph.h>
@@ -7,7 +9,10 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cmath>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
@@ -31,11 +36,146 @@ enum class ProfilePhase : std::uint8_t {
 [[nodiscard]] DateTime current_wall_time() noexcept {
   return std::chrono::time_point_cast<TimeDelta>(engine_clock::now());
 }
+
+using Histogram = EvaluationLatencyHistogram;
+
+[[nodiscard]] std::size_t histogram_bucket(std::uint64_t value) noexcept {
+  if (value < Histogram::sub_bucket_count) {
+    return static_cast<std::size_t>(value);
+  }
+  const auto exponent = static_cast<std::size_t>(std::bit_width(value)) - 1;
+  if (exponent >= Histogram::max_value_bits) {
+    return Histogram::bucket_count - 1;
+  }
+  const std::size_t shift = exponent - Histogram::sub_bucket_bits;
+  return (shift + 1) * Histogram::sub_bucket_count +
+         static_cast<std::size_t>(value >> shift) - Histogram::sub_bucket_count;
+}
+
+/** Largest value that lands in ``bucket``. */
+[[nodiscard]] std::uint64_t histogram_bucket_bound(std::size_t bucket) noexcept {
+  if (bucket < Histogram::sub_bucket_count) {
+    return bucket;
+  }
+  const std::size_t shift = bucket / Histogram::sub_bucket_count - 1;
+  const std::uint64_t mantissa =
+      Histogram::sub_bucket_count + bucket % Histogram::sub_bucket_count;
+  return ((mantissa + 1) << shift) - 1;
+}
+} // namespace
+
+void EvaluationLatencyHistogram::record(Duration value) noexcept {
+  if (value < Duration{0}) {
+    value = Duration{0};
+  }
+  ++buckets_[histogram_bucket(static_cast<std::uint64_t>(value.count()))];
+  ++count_;
+  max_ = std::max(max_, value);
+}
+
+void EvaluationLatencyHistogram::merge(
+    const EvaluationLatencyHistogram &other) noexcept {
+  for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    buckets_[bucket] += other.buckets_[bucket];
+  }
+  count_ += other.count_;
+  max_ = std::max(max_, other.max_);
+}
+
+void EvaluationLatencyHistogram::clear() noexcept { *this = {}; }
+
+EvaluationLatencyHistogram::Duration
+EvaluationLatencyHistogram::percentile(double fraction) const noexcept {
+  if (count_ == 0) {
+    return Duration{0};
+  }
+  const double clamped = std::clamp(fraction, 0.0, 1.0);
+  const auto rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(
+             std::ceil(clamped * static_cast<double>(count_))));
+  std::uint64_t seen = 0;
+  for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    seen += buckets_[bucket];
+    if (seen >= rank) {
+      return std::min(
+          Duration{static_cast<Duration::rep>(histogram_bucket_bound(bucket))},
+          max_);
+    }
+  }
+  return max_;
+}
+
+namespace {
+/**
+ * Profile counter with one writer, the evaluation thread, and concurrent
+ * snapshot readers. Updates are a relaxed load and store rather than a
+ * read-modify-write, so the evaluation path never takes a lock or a locked
+ * instruction.
+ */
+template <typename T> class ProfileCounter {
+public:
+  [[nodiscard]] T load() const noexcept {
+    return value_.load(std::memory_order_relaxed);
+  }
+  void store(T value) noexcept {
+    value_.store(value, std::memory_order_relaxed);
+  }
+  void add(T delta) noexcept { store(load() + delta); }
+  void raise(T value) noexcept {
+    if (load() < value) {
+      store(value);
+    }
+  }
+
+private:
+  std::atomic<T> value_{};
+};
 } // namespace
 
 struct EvaluationProfiler::State {
+  template <typename T> using Counter = ProfileCounter<T>;
+  using HardwareCounters = runtime_detail::HardwareCounterGroup;
+
+  struct Histogram {
+    std::array<Counter<std::uint64_t>, EvaluationLatencyHistogram::bucket_count>
+        buckets{};
+    Counter<EvaluationLatencyHistogram::Duration> max{};
+
+    void record(EvaluationLatencyHistogram::Duration value) noexcept {
+      if (value < EvaluationLatencyHistogram::Duration{0}) {
+        value = EvaluationLatencyHistogram::Duration{0};
+      }
+      buckets[histogram_bucket(static_cast<std::uint64_t>(value.count()))]
+          .add(1);
+      max.raise(value);
+    }
+
+    void clear() noexcept {
+      for (auto &bucket : buckets) {
+        bucket.store(0);
+      }
+      max.store(EvaluationLatencyHistogram::Duration{0});
+    }
+
+    [[nodiscard]] EvaluationLatencyHistogram load() const noexcept {
+      EvaluationLatencyHistogram result;
+      for (std::size_t bucket = 0;
+           bucket < EvaluationLatencyHistogram::bucket_count; ++bucket) {
+        result.buckets_[bucket] = buckets[bucket].load();
+        result.count_ += result.buckets_[bucket];
+      }
+      result.max_ = max.load();
+      return result;
+    }
+  };
+
   struct PhaseState {
-    EvaluationProfilePhase snapshot{};
+    Counter<std::uint64_t> count{};
+    Counter<std::uint64_t> failures{};
+    Counter<TimeDelta> total_time{};
+    Counter<TimeDelta> max_time{};
+    Counter<TimeDelta> recent_time{};
+    // Evaluation thread only.
     std::vector<TimeDelta> recent{};
     std::size_t recent_cursor{0};
   };
@@ -45,34 +185,70 @@ struct EvaluationProfiler::State {
     PhaseState start{};
     PhaseState evaluation{};
     PhaseState stop{};
+    std::unique_ptr<Histogram> evaluation_latency{};
+    std::array<Counter<std::uint64_t>, HardwareCounters::counter_count>
+        hardware{};
+    // Running graph or node slots bound to this entry.
+    std::size_t live{0};
   };
 
-  struct EntityState {
+  /** One graph or node of a running graph. */
+  struct Slot {
     EntryState *entry{nullptr};
+    NodeKind kind{NodeKind::Compute};
     std::array<std::optional<ProfileTime>, 3> active{};
+    HardwareCounters::Values hardware_begin{};
+  };
+
+  /** Slots of one running graph; nodes are indexed by node index. */
+  struct GraphProfile {
+    Slot graph{};
+    std::vector<Slot> nodes{};
   };
 
+  // Shared with snapshot() and reset(). Entry creation and removal, the wall
+  // clock and the running flag are guarded by the mutex; measurements are
+  // counters written by the evaluation thread alone.
   mutable std::mutex mutex{};
   std::unordered_map<std::string, EntryState> entries{};
-  std::unordered_map<const void *, EntityState> graph_entities{};
-  std::unordered_map<const void *, EntityState> node_entities{};
   std::optional<ProfileTime> wall_started{};
-  std::optional<ProfileTime> root_evaluation_started{};
   TimeDelta wall_time{0};
-  std::uint64_t graph_cycles{0};
-  TimeDelta root_evaluation_time{0};
-  TimeDelta scheduling_lag_total{0};
-  TimeDelta scheduling_lag_max{0};
-  std::uint64_t scheduling_lag_samples{0};
+  bool running{false};
+  bool hardware_available{false};
+  std::string hardware_error{};
+  std::atomic_bool reset_pending{false};
+  Counter<std::uint64_t> graph_cycles{};
+  Counter<std::uint64_t> sampled_cycles{};
+  Counter<TimeDelta> root_evaluation_time{};
+  Counter<TimeDelta> scheduling_lag_total{};
+  Counter<TimeDelta> scheduling_lag_max{};
+  Counter<std::uint64_t> scheduling_lag_samples{};
+  Histogram cycle_duration{};
+  Histogram push_queue_dwell{};
+  Histogram push_to_sink{};
+
+  // Evaluation thread only. Node callbacks resolve their graph through a
+  // one-entry cache, so a cycle of one graph never touches the map.
+  std::unordered_map<const void *, std::unique_ptr<GraphProfile>> graphs{};
+  HardwareCounters counters{};
+  const GraphValue *cached_graph{nullptr};
+  GraphProfile *cached_profile{nullptr};
+  std::uint64_t cycle_index{0};
+  bool sampled{true};
+  std::optional<ProfileTime> root_evaluation_started{};
+  // Oldest enqueue stamp applied by a push source in the current root cycle.
+  std::optional<ProfileTime> cycle_push_origin{};
 };
 
 namespace {
+using ProfileState = EvaluationProfiler::State;
+
 [[nodiscard]] constexpr std::size_t phase_index(ProfilePhase phase) noexcept {
   return static_cast<std::size_t>(phase);
 }
 
-EvaluationProfiler::State::PhaseState &
-phase_state(EvaluationProfiler::State::EntryState &entry, ProfilePhase phase) {
+ProfileState::PhaseState &phase_state(ProfileState::EntryState &entry,
+                                      ProfilePhase phase) {
   switch (phase) {
   case ProfilePhase::Start:
     return entry.start;
@@ -84,22 +260,21 @@ phase_state(EvaluationProfiler::State::EntryState &entry, ProfilePhase phase) {
   std::terminate();
 }
 
-void record_duration(EvaluationProfiler::State::PhaseState &phase,
-                     TimeDelta duration, bool failed,
-                     std::size_t recent_window) {
+void record_duration(ProfileState::PhaseState &phase, TimeDelta duration,
+                     bool failed, std::size_t recent_window) {
   if (duration < TimeDelta{0}) {
     duration = TimeDelta{0};
   }
-  ++phase.snapshot.count;
+  phase.count.add(1);
   if (failed) {
-    ++phase.snapshot.failures;
+    phase.failures.add(1);
   }
-  phase.snapshot.total_time += duration;
-  phase.snapshot.max_time = std::max(phase.snapshot.max_time, duration);
+  phase.total_time.add(duration);
+  phase.max_time.raise(duration);
   if (recent_window == 0) {
     phase.recent.clear();
     phase.recent_cursor = 0;
-    phase.snapshot.recent_time = TimeDelta{0};
+    phase.recent_time.store(TimeDelta{0});
     return;
   }
   if (phase.recent.capacity() < recent_window) {
@@ -107,18 +282,66 @@ void record_duration(EvaluationProfiler::State::PhaseState &phase,
   }
   if (phase.recent.size() < recent_window) {
     phase.recent.push_back(duration);
-    phase.snapshot.recent_time += duration;
+    phase.recent_time.add(duration);
     return;
   }
-  phase.snapshot.recent_time -= phase.recent[phase.recent_cursor];
+  phase.recent_time.add(duration - phase.recent[phase.recent_cursor]);
   phase.recent[phase.recent_cursor] = duration;
-  phase.snapshot.recent_time += duration;
   phase.recent_cursor = (phase.recent_cursor + 1) % recent_window;
 }
 
-EvaluationProfiler::State::EntryState &
-ensure_entry(EvaluationProfiler::State &state, std::string path,
-             std::string label, bool graph) {
+[[nodiscard]] EvaluationProfilePhase
+load_phase(const ProfileState::PhaseState &phase) noexcept {
+  return EvaluationProfilePhase{
+      .count = phase.count.load(),
+      .failures = phase.failures.load(),
+      .total_time = phase.total_time.load(),
+      .max_time = phase.max_time.load(),
+      .recent_time = phase.recent_time.load(),
+  };
+}
+
+void clear_phase(ProfileState::PhaseState &phase) noexcept {
+  phase.count.store(0);
+  phase.failures.store(0);
+  phase.total_time.store(TimeDelta{0});
+  phase.max_time.store(TimeDelta{0});
+  phase.recent_time.store(TimeDelta{0});
+  phase.recent.clear();
+  phase.recent_cursor = 0;
+}
+
+/** Requires the state mutex, and no evaluation in flight. */
+void clear_measurements(ProfileState &state) {
+  std::erase_if(state.entries,
+                [](const auto &entry) { return entry.second.live == 0; });
+  for (auto &[path, entry] : state.entries) {
+    static_cast<void>(path);
+    clear_phase(entry.start);
+    clear_phase(entry.evaluation);
+    clear_phase(entry.stop);
+    if (entry.evaluation_latency != nullptr) {
+      entry.evaluation_latency->clear();
+    }
+    for (auto &counter : entry.hardware) {
+      counter.store(0);
+    }
+  }
+  state.wall_time = TimeDelta{0};
+  state.graph_cycles.store(0);
+  state.sampled_cycles.store(0);
+  state.root_evaluation_time.store(TimeDelta{0});
+  state.scheduling_lag_total.store(TimeDelta{0});
+  state.scheduling_lag_max.store(TimeDelta{0});
+  state.scheduling_lag_samples.store(0);
+  state.cycle_duration.clear();
+  state.push_queue_dwell.clear();
+  state.push_to_sink.clear();
+  state.cycle_push_origin.reset();
+}
+
+ProfileState::EntryState &ensure_entry(ProfileState &state, std::string path,
+                                       std::string label, bool graph) {
   auto [it, inserted] = state.entries.try_emplace(path);
   if (inserted) {
     it->second.identity.path = std::move(path);
@@ -128,44 +351,134 @@ ensure_entry(EvaluationProfiler::State &state, std::string path,
   return it->second;
 }
 
-EvaluationProfiler::State::EntityState &register_entity(
-    EvaluationProfiler::State &state,
-    std::unordered_map<const void *, EvaluationProfiler::State::EntityState>
-        &entities,
-    const void *identity, std::string path, std::string label, bool graph) {
-  auto [entity, inserted] = entities.try_emplace(identity);
-  if (inserted || entity->second.entry == nullptr) {
-    entity->second.entry =
-        &ensure_entry(state, std::move(path), std::move(label), graph);
+/** Requires the state mutex. */
+void bind_slot(ProfileState::Slot &slot, ProfileState::EntryState &entry) {
+  if (slot.entry == &entry) {
+    return;
+  }
+  if (slot.entry != nullptr) {
+    --slot.entry->live;
+  }
+  slot.entry = &entry;
+  ++entry.live;
+}
+
+/** Requires the state mutex. */
+void release_slot(ProfileState::Slot &slot) noexcept {
+  if (slot.entry != nullptr) {
+    --slot.entry->live;
+    slot.entry = nullptr;
+  }
+  slot.active = {};
+}
+
+void invalidate_graph_cache(ProfileState &state) noexcept {
+  state.cached_graph = nullptr;
+  state.cached_profile = nullptr;
+}
+
+[[nodiscard]] ProfileState::GraphProfile *
+find_graph_profile(ProfileState &state, const GraphView &graph) {
+  const auto found = state.graphs.find(graph.data());
+  return found != state.graphs.end() ? found->second.get() : nullptr;
+}
+
+/** Requires the state mutex. */
+void erase_graph_profile(ProfileState &state, const GraphView &graph) {
+  const auto found = state.graphs.find(graph.data());
+  if (found == state.graphs.end()) {
+    return;
+  }
+  release_slot(found->second->graph);
+  for (auto &slot : found->second->nodes) {
+    release_slot(slot);
+  }
+  state.graphs.erase(found);
+  invalidate_graph_cache(state);
+}
+
+[[nodiscard]] ProfileState::Slot *node_slot(ProfileState &state,
+                                            const NodeView &node) {
+  const GraphValue *graph = node.graph_value();
+  if (graph == nullptr) {
+    return nullptr;
+  }
+  if (graph != state.cached_graph) {
+    state.cached_graph = graph;
+    state.cached_profile = find_graph_profile(state, graph->view());
+  }
+  ProfileState::GraphProfile *profile = state.cached_profile;
+  if (profile == nullptr) {
+    return nullptr;
   }
-  return entity->second;
+  const std::size_t index = node.node_index();
+  return index < profile->nodes.size() ? &profile->nodes[index] : nullptr;
 }
 
-void begin_phase(EvaluationProfiler::State::EntityState &entity,
-                 ProfilePhase phase) {
-  entity.active[phase_index(phase)] = ProfileClock::now();
+void begin_phase(ProfileState::Slot &slot, ProfilePhase phase) {
+  if (slot.entry != nullptr) {
+    slot.active[phase_index(phase)] = ProfileClock::now();
+  }
 }
 
-TimeDelta end_phase(EvaluationProfiler::State::EntityState &entity,
-                    ProfilePhase phase, bool failed,
-                    std::size_t recent_window) {
-  auto &started = entity.active[phase_index(phase)];
-  if (!started.has_value() || entity.entry == nullptr) {
-    return TimeDelta{0};
+void end_phase(ProfileState::Slot &slot, ProfilePhase phase, bool failed,
+               std::size_t recent_window) {
+  auto &started = slot.active[phase_index(phase)];
+  if (!started.has_value() || slot.entry == nullptr) {
+    return;
   }
-  const TimeDelta duration = elapsed(*started, ProfileClock::now());
-  record_duration(phase_state(*entity.entry, phase), duration, failed,
+  const auto raw = ProfileClock::now() - *started;
+  record_duration(phase_state(*slot.entry, phase),
+                  std::chrono::duration_cast<TimeDelta>(raw), failed,
                   recent_window);
+  if (phase == ProfilePhase::Evaluation &&
+      slot.entry->evaluation_latency != nullptr) {
+    slot.entry->evaluation_latency->record(
+        std::chrono::duration_cast<EvaluationLatencyHistogram::Duration>(raw));
+  }
   started.reset();
-  return duration;
 }
 
-EvaluationProfiler::State::EntityState *find_entity(
-    std::unordered_map<const void *, EvaluationProfiler::State::EntityState>
-        &entities,
-    const void *identity) noexcept {
-  const auto found = entities.find(identity);
-  return found != entities.end() ? &found->second : nullptr;
+/** Read the counters last before an evaluation starts. */
+void begin_counters(ProfileState &state, ProfileState::Slot &slot) noexcept {
+  if (slot.entry != nullptr && state.counters.is_open()) {
+    slot.hardware_begin = state.counters.read();
+  }
+}
+
+/** Read the counters first after an evaluation ends. */
+void end_counters(ProfileState &state, ProfileState::Slot &slot) noexcept {
+  if (slot.entry == nullptr || !state.counters.is_open()) {
+    return;
+  }
+  const auto now = state.counters.read();
+  for (std::size_t counter = 0; counter < now.size(); ++counter) {
+    if (now[counter] >= slot.hardware_begin[counter]) {
+      slot.entry->hardware[counter].add(now[counter] -
+                                        slot.hardware_begin[counter]);
+    }
+  }
+}
+
+void record_latency(ProfileState::Histogram &histogram, ProfileTime start,
+                    ProfileTime end) noexcept {
+  histogram.record(
+      std::chrono::duration_cast<EvaluationLatencyHistogram::Duration>(end -
+                                                                       start));
+}
+
+/** Apply a reset() requested while a run was active. Evaluation thread. */
+void apply_pending_reset(ProfileState &state) {
+  if (!state.reset_pending.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::scoped_lock lock{state.mutex};
+  if (!state.reset_pending.exchange(false)) {
+    return;
+  }
+  clear_measurements(state);
+  state.wall_started = ProfileClock::now();
+  state.cycle_index = 0;
 }
 
 [[nodiscard]] bool failed_node_is(const NodeView &node) {
@@ -175,11 +488,17 @@ EvaluationProfiler::State::EntityState *find_entity(
 } // namespace
 
 EvaluationProfiler::EvaluationProfiler(EvaluationProfilerOptions options)
-    : options_(options), state_(std::make_shared<State>()) {}
+    : options_(options), state_(std::make_shared<State>()) {
+  options_.sample_every = std::max<std::size_t>(options_.sample_every, 1);
+}
 
 EvaluationProfiler::EvaluationProfiler(bool start, bool eval, bool stop,
                                        bool node, bool graph,
-                                       std::size_t recent_window)
+                                       std::size_t recent_window,
+                                       bool histograms,
+                                       std::size_t sample_every,
+                                       bool hardware_counters,
+                                       bool node_histograms)
     : EvaluationProfiler(EvaluationProfilerOptions{
           .start = start,
           .eval = eval,
@@ -187,22 +506,35 @@ EvaluationProfiler::EvaluationProfiler(bool start, bool eval, bool stop,
           .node = node,
           .graph = graph,
           .recent_window = recent_window,
+          .histograms = histograms,
+          .node_histograms = node_histograms,
+          .sample_every = sample_every,
+          .hardware_counters = hardware_counters,
       }) {}
 
 EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
   std::scoped_lock lock{state_->mutex};
   EvaluationProfileSnapshot result;
-  result.graph_cycles = state_->graph_cycles;
+  result.graph_cycles = state_->graph_cycles.load();
+  result.sampled_cycles = state_->sampled_cycles.load();
   result.wall_time = state_->wall_started.has_value()
                          ? elapsed(*state_->wall_started, ProfileClock::now())
                          : state_->wall_time;
-  result.root_evaluation_time = state_->root_evaluation_time;
-  result.scheduling_lag_total = state_->scheduling_lag_total;
-  result.scheduling_lag_max = state_->scheduling_lag_max;
-  result.scheduling_lag_samples = state_->scheduling_lag_samples;
-  if (result.wall_time > TimeDelta{0}) {
+  result.root_evaluation_time = state_->root_evaluation_time.load();
+  result.scheduling_lag_total = state_->scheduling_lag_total.load();
+  result.scheduling_lag_max = state_->scheduling_lag_max.load();
+  result.scheduling_lag_samples = state_->scheduling_lag_samples.load();
+  result.cycle_duration = state_->cycle_duration.load();
+  result.push_queue_dwell = state_->push_queue_dwell.load();
+  result.push_to_sink = state_->push_to_sink.load();
+  result.hardware_counters_available = state_->hardware_available;
+  result.hardware_counters_error = state_->hardware_error;
+  if (result.wall_time > TimeDelta{0} && result.sampled_cycles > 0) {
+    // Sampled cycles stand in for the ones that were not timed.
+    const double scale = static_cast<double>(result.graph_cycles) /
+                         static_cast<double>(result.sampled_cycles);
     result.runtime_load =
-        static_cast<double>(result.root_evaluation_time.count()) /
+        static_cast<double>(result.root_evaluation_time.count()) * scale /
         static_cast<double>(result.wall_time.count());
   }
 
@@ -210,9 +542,20 @@ EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
   for (const auto &[path, entry] : state_->entries) {
     static_cast<void>(path);
     EvaluationProfileEntry copy = entry.identity;
-    copy.start = entry.start.snapshot;
-    copy.evaluation = entry.evaluation.snapshot;
-    copy.stop = entry.stop.snapshot;
+    copy.start = load_phase(entry.start);
+    copy.evaluation = load_phase(entry.evaluation);
+    copy.stop = load_phase(entry.stop);
+    if (entry.evaluation_latency != nullptr) {
+      copy.evaluation_latency = entry.evaluation_latency->load();
+    }
+    if (state_->hardware_available) {
+      copy.hardware_counters = EvaluationHardwareCounters{
+          .cycles = entry.hardware[0].load(),
+          .instructions = entry.hardware[1].load(),
+          .llc_misses = entry.hardware[2].load(),
+          .branch_misses = entry.hardware[3].load(),
+      };
+    }
     result.entries.push_back(std::move(copy));
   }
 
@@ -222,32 +565,46 @@ EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
 
 void EvaluationProfiler::reset() {
   std::scoped_lock lock{state_->mutex};
-  state_->entries.clear();
-  state_->graph_entities.clear();
-  state_->node_entities.clear();
+  if (state_->running) {
+    // The evaluation thread owns the counters; it clears them before its
+    // next root cycle.
+    state_->reset_pending.store(true, std::memory_order_release);
+    return;
+  }
+  state_->reset_pending.store(false);
+  clear_measurements(*state_);
   state_->wall_started.reset();
-  state_->root_evaluation_started.reset();
-  state_->wall_time = TimeDelta{0};
-  state_->graph_cycles = 0;
-  state_->root_evaluation_time = TimeDelta{0};
-  state_->scheduling_lag_total = TimeDelta{0};
-  state_->scheduling_lag_max = TimeDelta{0};
-  state_->scheduling_lag_samples = 0;
 }
 
 void EvaluationProfiler::on_before_start_graph(const GraphView &graph) {
   std::scoped_lock lock{state_->mutex};
   if (graph.is_root()) {
     state_->wall_started = ProfileClock::now();
+    state_->running = true;
+    state_->sampled = true;
+    state_->cycle_index = 0;
+    // Root start runs on the evaluation thread the counters must follow. A
+    // run that cannot open them is reported unavailable even if an earlier
+    // run on this profiler had them.
+    if (options_.hardware_counters) {
+      state_->hardware_available = state_->counters.open();
+      state_->hardware_error = state_->counters.error();
+    }
   }
+  auto &profile = state_->graphs[graph.data()];
+  if (profile == nullptr) {
+    profile = std::make_unique<State::GraphProfile>();
+  }
+  profile->nodes.resize(std::max(profile->nodes.size(), graph.node_count()));
+  invalidate_graph_cache(*state_);
   if (!options_.graph) {
     return;
   }
-  auto &entity = register_entity(*state_, state_->graph_entities, graph.data(),
-                                 diagnostic::graph_path(graph),
-                                 diagnostic::graph_label(graph), true);
+  bind_slot(profile->graph,
+            ensure_entry(*state_, diagnostic::graph_path(graph),
+                         diagnostic::graph_label(graph), true));
   if (options_.start) {
-    begin_phase(entity, ProfilePhase::Start);
+    begin_phase(profile->graph, ProfilePhase::Start);
   }
 }
 
@@ -255,36 +612,51 @@ void EvaluationProfiler::on_after_start_graph(const GraphView &graph) {
   if (!options_.start || !options_.graph) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-    end_phase(*entity, ProfilePhase::Start, false, options_.recent_window);
+  if (auto *profile = find_graph_profile(*state_, graph)) {
+    end_phase(profile->graph, ProfilePhase::Start, false,
+              options_.recent_window);
   }
 }
 
 void EvaluationProfiler::on_start_graph_failed(const GraphView &graph) {
   std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-    if (options_.start) {
-      end_phase(*entity, ProfilePhase::Start, true, options_.recent_window);
-    }
-    state_->graph_entities.erase(graph.data());
+  if (auto *profile = find_graph_profile(*state_, graph);
+      profile != nullptr && options_.start) {
+    end_phase(profile->graph, ProfilePhase::Start, true,
+              options_.recent_window);
   }
-  if (graph.is_root() && state_->wall_started.has_value()) {
-    state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
-    state_->wall_started.reset();
+  erase_graph_profile(*state_, graph);
+  if (graph.is_root()) {
+    state_->running = false;
+    state_->counters.close();
+    if (state_->wall_started.has_value()) {
+      state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
+      state_->wall_started.reset();
+    }
   }
 }
 
 void EvaluationProfiler::on_before_start_node(const NodeView &node) {
+  auto *slot = node_slot(*state_, node);
+  if (slot == nullptr) {
+    return;
+  }
+  slot->kind = node.node_kind();
   if (!options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  auto &entity = register_entity(*state_, state_->node_entities, node.data(),
-                                 diagnostic::node_path(node),
-                                 diagnostic::node_label(node), false);
+  {
+    std::scoped_lock lock{state_->mutex};
+    auto &entry = ensure_entry(*state_, diagnostic::node_path(node),
+                               diagnostic::node_label(node), false);
+    bind_slot(*slot, entry);
+    if (options_.eval && options_.node_histograms &&
+        entry.evaluation_latency == nullptr) {
+      entry.evaluation_latency = std::make_unique<State::Histogram>();
+    }
+  }
   if (options_.start) {
-    begin_phase(entity, ProfilePhase::Start);
+    begin_phase(*slot, ProfilePhase::Start);
   }
 }
 
@@ -292,9 +664,8 @@ void EvaluationProfiler::on_after_start_node(const NodeView &node) {
   if (!options_.start || !options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
-    end_phase(*entity, ProfilePhase::Start, false, options_.recent_window);
+  if (auto *slot = node_slot(*state_, node)) {
+    end_phase(*slot, ProfilePhase::Start, false, options_.recent_window);
   }
 }
 
@@ -302,12 +673,12 @@ void EvaluationProfiler::on_start_node_failed(const NodeView &node) {
   if (!options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
+  if (auto *slot = node_slot(*state_, node)) {
     if (options_.start) {
-      end_phase(*entity, ProfilePhase::Start, true, options_.recent_window);
+      end_phase(*slot, ProfilePhase::Start, true, options_.recent_window);
     }
-    state_->node_entities.erase(node.data());
+    std::scoped_lock lock{state_->mutex};
+    release_slot(*slot);
   }
 }
 
@@ -315,20 +686,29 @@ void EvaluationProfiler::on_before_graph_evaluation(const GraphView &graph) {
   if (!options_.eval) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
+  State &state = *state_;
   if (graph.is_root()) {
-    state_->root_evaluation_started = ProfileClock::now();
+    apply_pending_reset(state);
+    state.sampled = state.cycle_index++ % options_.sample_every == 0;
+    if (!state.sampled) {
+      return;
+    }
+    state.root_evaluation_started = ProfileClock::now();
+    state.cycle_push_origin.reset();
     if (graph.executor().schema()->mode == GraphExecutorMode::RealTime) {
       const TimeDelta lag =
           std::max(current_wall_time() - graph.evaluation_time(), TimeDelta{0});
-      state_->scheduling_lag_total += lag;
-      state_->scheduling_lag_max = std::max(state_->scheduling_lag_max, lag);
-      ++state_->scheduling_lag_samples;
+      state.scheduling_lag_total.add(lag);
+      state.scheduling_lag_max.raise(lag);
+      state.scheduling_lag_samples.add(1);
     }
+  } else if (!state.sampled) {
+    return;
   }
   if (options_.graph) {
-    if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-      begin_phase(*entity, ProfilePhase::Evaluation);
+    if (auto *profile = find_graph_profile(state, graph)) {
+      begin_phase(profile->graph, ProfilePhase::Evaluation);
+      begin_counters(state, profile->graph);
     }
   }
 }
@@ -337,40 +717,75 @@ void EvaluationProfiler::on_after_graph_evaluation(const GraphView &graph) {
   if (!options_.eval) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
+  State &state = *state_;
+  const bool root = graph.is_root();
+  if (root) {
+    state.graph_cycles.add(1);
+  }
+  if (!state.sampled) {
+    return;
+  }
   if (options_.graph) {
-    if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-      end_phase(*entity, ProfilePhase::Evaluation, graph.failed_node().valid(),
-                options_.recent_window);
+    if (auto *profile = find_graph_profile(state, graph)) {
+      end_counters(state, profile->graph);
+      end_phase(profile->graph, ProfilePhase::Evaluation,
+                graph.failed_node().valid(), options_.recent_window);
     }
   }
-  if (graph.is_root()) {
-    ++state_->graph_cycles;
-    if (state_->root_evaluation_started.has_value()) {
-      state_->root_evaluation_time +=
-          elapsed(*state_->root_evaluation_started, ProfileClock::now());
-      state_->root_evaluation_started.reset();
+  if (root) {
+    state.sampled_cycles.add(1);
+    if (state.root_evaluation_started.has_value()) {
+      const ProfileTime now = ProfileClock::now();
+      state.root_evaluation_time.add(
+          elapsed(*state.root_evaluation_started, now));
+      if (options_.histograms) {
+        record_latency(state.cycle_duration, *state.root_evaluation_started,
+                       now);
+      }
+      state.root_evaluation_started.reset();
     }
   }
 }
 
 void EvaluationProfiler::on_before_node_evaluation(const NodeView &node) {
-  if (!options_.eval || !options_.node) {
+  if (!options_.eval || !options_.node || !state_->sampled) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
-    begin_phase(*entity, ProfilePhase::Evaluation);
+  if (auto *slot = node_slot(*state_, node)) {
+    begin_phase(*slot, ProfilePhase::Evaluation);
+    begin_counters(*state_, *slot);
   }
 }
 
 void EvaluationProfiler::on_after_node_evaluation(const NodeView &node) {
-  if (!options_.eval || !options_.node) {
+  if (!options_.eval || !state_->sampled ||
+      (!options_.node && !options_.histograms)) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
-    end_phase(*entity, ProfilePhase::Evaluation, failed_node_is(node),
+  State &state = *state_;
+  auto *slot = node_slot(state, node);
+  if (slot == nullptr) {
+    return;
+  }
+  end_counters(state, *slot);
+  if (options_.histograms) {
+    if (slot->kind == NodeKind::PushSource) {
+      if (const auto enqueued = node.inspection_metrics().applied_enqueue_time;
+          enqueued.has_value()) {
+        record_latency(state.push_queue_dwell, *enqueued, ProfileClock::now());
+        if (!state.cycle_push_origin.has_value() ||
+            *enqueued < *state.cycle_push_origin) {
+          state.cycle_push_origin = *enqueued;
+        }
+      }
+    } else if (slot->kind == NodeKind::Sink &&
+               state.cycle_push_origin.has_value()) {
+      record_latency(state.push_to_sink, *state.cycle_push_origin,
+                     ProfileClock::now());
+    }
+  }
+  if (slot->entry != nullptr) {
+    end_phase(*slot, ProfilePhase::Evaluation, failed_node_is(node),
               options_.recent_window);
   }
 }
@@ -379,9 +794,8 @@ void EvaluationProfiler::on_before_stop_node(const NodeView &node) {
   if (!options_.stop || !options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
-    begin_phase(*entity, ProfilePhase::Stop);
+  if (auto *slot = node_slot(*state_, node)) {
+    begin_phase(*slot, ProfilePhase::Stop);
   }
 }
 
@@ -389,12 +803,12 @@ void EvaluationProfiler::on_after_stop_node(const NodeView &node) {
   if (!options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
+  if (auto *slot = node_slot(*state_, node)) {
     if (options_.stop) {
-      end_phase(*entity, ProfilePhase::Stop, false, options_.recent_window);
+      end_phase(*slot, ProfilePhase::Stop, false, options_.recent_window);
     }
-    state_->node_entities.erase(node.data());
+    std::scoped_lock lock{state_->mutex};
+    release_slot(*slot);
   }
 }
 
@@ -402,12 +816,12 @@ void EvaluationProfiler::on_stop_node_failed(const NodeView &node) {
   if (!options_.node) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->node_entities, node.data())) {
+  if (auto *slot = node_slot(*state_, node)) {
     if (options_.stop) {
-      end_phase(*entity, ProfilePhase::Stop, true, options_.recent_window);
+      end_phase(*slot, ProfilePhase::Stop, true, options_.recent_window);
     }
-    state_->node_entities.erase(node.data());
+    std::scoped_lock lock{state_->mutex};
+    release_slot(*slot);
   }
 }
 
@@ -415,39 +829,44 @@ void EvaluationProfiler::on_before_stop_graph(const GraphView &graph) {
   if (!options_.stop || !options_.graph) {
     return;
   }
-  std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-    begin_phase(*entity, ProfilePhase::Stop);
+  if (auto *profile = find_graph_profile(*state_, graph)) {
+    begin_phase(profile->graph, ProfilePhase::Stop);
   }
 }
 
 void EvaluationProfiler::on_after_stop_graph(const GraphView &graph) {
   std::scoped_lock lock{state_->mutex};
-  if (options_.stop && options_.graph) {
-    if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-      end_phase(*entity, ProfilePhase::Stop, false, options_.recent_window);
-    }
-  }
-  if (graph.is_root() && state_->wall_started.has_value()) {
-    state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
-    state_->wall_started.reset();
+  if (auto *profile = find_graph_profile(*state_, graph);
+      profile != nullptr && options_.stop) {
+    end_phase(profile->graph, ProfilePhase::Stop, false,
+              options_.recent_window);
   }
-  if (options_.graph) {
-    state_->graph_entities.erase(graph.data());
+  erase_graph_profile(*state_, graph);
+  if (graph.is_root()) {
+    state_->running = false;
+    state_->counters.close();
+    if (state_->wall_started.has_value()) {
+      state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
+      state_->wall_started.reset();
+    }
   }
 }
 
 void EvaluationProfiler::on_stop_graph_failed(const GraphView &graph) {
   std::scoped_lock lock{state_->mutex};
-  if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
-    if (options_.stop) {
-      end_phase(*entity, ProfilePhase::Stop, true, options_.recent_window);
-    }
-    state_->graph_entities.erase(graph.data());
+  if (auto *profile = find_graph_profile(*state_, graph);
+      profile != nullptr && options_.stop) {
+    end_phase(profile->graph, ProfilePhase::Stop, true,
+              options_.recent_window);
   }
-  if (graph.is_root() && state_->wall_started.has_value()) {
-    state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
-    state_->wall_started.reset();
+  erase_graph_profile(*state_, graph);
+  if (graph.is_root()) {
+    state_->running = false;
+    state_->counters.close();
+    if (state_->wall_started.has_value()) {
+      state_->wall_time = elapsed(*state_->wall_started, ProfileClock::now());
+      state_->wall_started.reset();
+    }
   }
 }
 } // namespace hgraph
@@ -0,0 +1,518 @@
+#include <hgraph/runtime/evaluation_timeline.h>
+
+#include <hgraph/runtime/diagnostic_path.h>
+#include <hgraph/runtime/graph.h>
+#include <hgraph/runtime/node.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hgraph
+{
+    namespace
+    {
+        using TimelineClock = std::chrono::steady_clock;
+
+        enum class SpanKind : std::uint8_t
+        {
+            GraphStart,
+            Cycle,
+            GraphEvaluation,
+            GraphStop,
+            NodeStart,
+            NodeEvaluation,
+            PushDrain,
+            NodeStop,
+        };
+
+        constexpr std::int64_t  no_arg     = std::numeric_limits<std::int64_t>::min();
+        constexpr std::uint32_t unresolved = std::numeric_limits<std::uint32_t>::max();
+
+        /** One complete span; 32 bytes, written once when the span ends. */
+        struct Span
+        {
+            std::int64_t  begin_ns{0};
+            std::int64_t  duration_ns{0};
+            // Cycle: evaluation time in microseconds since the epoch.
+            // PushDrain: dwell of the oldest applied value in nanoseconds.
+            std::int64_t  arg{no_arg};
+            std::uint32_t name{0};
+            SpanKind      kind{SpanKind::NodeEvaluation};
+            bool          failed{false};
+        };
+
+        [[nodiscard]] std::int64_t timeline_now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(TimelineClock::now().time_since_epoch())
+                .count();
+        }
+    }  // namespace
+
+    struct EvaluationTimeline::State
+    {
+        struct NodeTrack
+        {
+            std::uint32_t name{0};
+            NodeKind      kind{NodeKind::Compute};
+            std::int64_t  begin{0};
+            // Names of the nested graphs this node owns, by child graph
+            // schema; every key instance of one template shares its entry.
+            std::vector<std::pair<const void *, std::uint32_t>> child_names{};
+        };
+
+        /** Tracks of one running graph; nodes are indexed by node index. */
+        struct GraphTrack
+        {
+            std::uint32_t          name{0};
+            bool                   root{false};
+            std::int64_t           begin{0};
+            std::int64_t           evaluation_time{0};
+            std::vector<NodeTrack> nodes{};
+            // Node name ids shared by every instance of this graph template.
+            std::vector<std::uint32_t> *node_names{nullptr};
+        };
+
+        explicit State(std::size_t requested) : capacity(std::bit_ceil(std::max<std::size_t>(requested, 1))) {}
+
+        std::size_t       capacity;
+        std::vector<Span> spans{};
+        // Written only by the evaluation thread; atomic so size() may be read
+        // during a run.
+        std::atomic<std::uint64_t> head{0};
+        std::atomic_bool           running{false};
+
+        // Names are structural (graph template and node position), never
+        // per key, so the table is bounded by the graph shape however many
+        // keys a nested operator churns through.
+        std::vector<std::string>                                       names{};
+        std::unordered_map<std::string, std::uint32_t>                 name_ids{};
+        // Node name ids by graph name and schema, indexed by node index.
+        std::map<std::pair<std::uint32_t, const void *>, std::vector<std::uint32_t>> node_names{};
+        std::unordered_map<const void *, std::unique_ptr<GraphTrack>> graphs{};
+        // Node callbacks resolve their graph through a one-entry cache.
+        const GraphValue *cached_graph{nullptr};
+        GraphTrack       *cached_track{nullptr};
+    };
+
+    namespace
+    {
+        using TimelineState = EvaluationTimeline::State;
+
+        [[nodiscard]] std::uint32_t intern(TimelineState &state, std::string name)
+        {
+            const auto [it, inserted] = state.name_ids.try_emplace(name, static_cast<std::uint32_t>(state.names.size()));
+            if (inserted) { state.names.push_back(std::move(name)); }
+            return it->second;
+        }
+
+        void push(TimelineState &state, SpanKind kind, std::uint32_t name, std::int64_t begin, bool failed = false,
+                  std::int64_t arg = no_arg)
+        {
+            if (state.spans.empty()) { return; }
+            const std::uint64_t head = state.head.load(std::memory_order_relaxed);
+            state.spans[head & (state.capacity - 1)] = Span{
+                .begin_ns    = begin,
+                .duration_ns = timeline_now() - begin,
+                .arg         = arg,
+                .name        = name,
+                .kind        = kind,
+                .failed      = failed,
+            };
+            state.head.store(head + 1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] TimelineState::GraphTrack *find_track(TimelineState &state, const GraphView &graph)
+        {
+            const auto found = state.graphs.find(graph.data());
+            return found != state.graphs.end() ? found->second.get() : nullptr;
+        }
+
+        [[nodiscard]] std::uint32_t graph_name(TimelineState &state, const GraphView &graph)
+        {
+            const auto resolve = [&] {
+                return intern(state, diagnostic::graph_label(graph) + ' ' + diagnostic::graph_path(graph));
+            };
+            if (!graph.is_nested()) { return resolve(); }
+
+            // A keyed child is named after its parent node and template, so
+            // the name is resolved once and reused by every later key.
+            const NodeView parent = graph.as_nested().parent_node();
+            const auto     found  = state.graphs.find(parent.graph().data());
+            if (found == state.graphs.end() || parent.node_index() >= found->second->nodes.size())
+            {
+                return resolve();
+            }
+            auto      &children = found->second->nodes[parent.node_index()].child_names;
+            const auto cached   = std::ranges::find(children, static_cast<const void *>(graph.schema()),
+                                                    &std::pair<const void *, std::uint32_t>::first);
+            if (cached != children.end()) { return cached->second; }
+            return children.emplace_back(graph.schema(), resolve()).second;
+        }
+
+        void erase_track(TimelineState &state, const GraphView &graph)
+        {
+            state.graphs.erase(graph.data());
+            state.cached_graph = nullptr;
+            state.cached_track = nullptr;
+        }
+
+        [[nodiscard]] TimelineState::NodeTrack *node_track(TimelineState &state, const NodeView &node)
+        {
+            const GraphValue *graph = node.graph_value();
+            if (graph == nullptr) { return nullptr; }
+            if (graph != state.cached_graph)
+            {
+                state.cached_graph = graph;
+                state.cached_track = find_track(state, graph->view());
+            }
+            if (state.cached_track == nullptr) { return nullptr; }
+            const std::size_t index = node.node_index();
+            return index < state.cached_track->nodes.size() ? &state.cached_track->nodes[index] : nullptr;
+        }
+
+        [[nodiscard]] bool failed_node_is(const NodeView &node)
+        {
+            NodeView failed = node.graph().failed_node();
+            return failed.valid() && failed.pointer() == node.pointer();
+        }
+
+        void end_run(TimelineState &state, const GraphView &graph)
+        {
+            erase_track(state, graph);
+            if (graph.is_root()) { state.running.store(false, std::memory_order_release); }
+        }
+
+        [[nodiscard]] std::string_view category(SpanKind kind) noexcept
+        {
+            switch (kind)
+            {
+                case SpanKind::GraphStart:
+                case SpanKind::NodeStart: return "start";
+                case SpanKind::Cycle: return "cycle";
+                case SpanKind::GraphEvaluation: return "graph";
+                case SpanKind::NodeEvaluation: return "node";
+                case SpanKind::PushDrain: return "push_drain";
+                case SpanKind::GraphStop:
+                case SpanKind::NodeStop: return "stop";
+            }
+            return "node";
+        }
+
+        void write_json_string(std::ostream &out, std::string_view text)
+        {
+            static constexpr char hex[] = "0123456789abcdef";
+            out << '"';
+            for (const char c : text)
+            {
+                switch (c)
+                {
+                    case '"': out << "\\\""; break;
+                    case '\\': out << "\\\\"; break;
+                    case '\n': out << "\\n"; break;
+                    case '\r': out << "\\r"; break;
+                    case '\t': out << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            out << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+                        }
+                        else { out << c; }
+                }
+            }
+            out << '"';
+        }
+
+        /** Trace-event timestamps are microseconds; keep nanosecond digits. */
+        void write_micros(std::ostream &out, std::int64_t nanoseconds)
+        {
+            if (nanoseconds < 0)
+            {
+                out << '-';
+                nanoseconds = -nanoseconds;
+            }
+            const std::int64_t fraction = nanoseconds % 1000;
+            out << nanoseconds / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+                << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+        }
+
+        void require_idle(const TimelineState &state, std::string_view operation)
+        {
+            if (state.running.load(std::memory_order_acquire))
+            {
+                throw std::logic_error("EvaluationTimeline::" + std::string{operation} +
+                                       " cannot be called while a run is recording");
+            }
+        }
+    }  // namespace
+
+    EvaluationTimeline::EvaluationTimeline(EvaluationTimelineOptions options)
+        : options_(options), state_(std::make_shared<State>(options.capacity))
+    {
+    }
+
+    EvaluationTimeline::EvaluationTimeline(std::size_t capacity, bool node, bool graph, bool lifecycle)
+        : EvaluationTimeline(EvaluationTimelineOptions{
+              .capacity  = capacity,
+              .node      = node,
+              .graph     = graph,
+              .lifecycle = lifecycle,
+          })
+    {
+    }
+
+    std::size_t EvaluationTimeline::size() const
+    {
+        return static_cast<std::size_t>(
+            std::min<std::uint64_t>(state_->head.load(std::memory_order_relaxed), state_->spans.size()));
+    }
+
+    std::uint64_t EvaluationTimeline::dropped() const
+    {
+        return state_->head.load(std::memory_order_relaxed) - size();
+    }
+
+    std::size_t EvaluationTimeline::name_count() const
+    {
+        require_idle(*state_, "name_count");
+        return state_->names.size();
+    }
+
+    void EvaluationTimeline::clear()
+    {
+        require_idle(*state_, "clear");
+        state_->head.store(0, std::memory_order_relaxed);
+    }
+
+    void EvaluationTimeline::write_chrome_trace(std::ostream &out) const
+    {
+        require_idle(*state_, "write_chrome_trace");
+        const State        &state    = *state_;
+        const std::uint64_t head     = state.head.load(std::memory_order_relaxed);
+        const std::uint64_t retained = std::min<std::uint64_t>(head, state.spans.size());
+
+        std::vector<Span> spans;
+        spans.reserve(retained);
+        for (std::uint64_t index = head - retained; index < head; ++index)
+        {
+            spans.push_back(state.spans[index & (state.capacity - 1)]);
+        }
+        // Spans are stored as they end; order by start, outermost first, so
+        // viewers nest spans that share a start tick correctly.
+        std::ranges::sort(spans, [](const Span &lhs, const Span &rhs) {
+            return lhs.begin_ns != rhs.begin_ns ? lhs.begin_ns < rhs.begin_ns : lhs.duration_ns > rhs.duration_ns;
+        });
+        const std::int64_t origin = spans.empty() ? 0 : spans.front().begin_ns;
+
+        out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_spans\":" << head - retained
+            << "},\"traceEvents\":[\n"
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"hgraph\"}},\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"evaluation\"}}";
+        for (const Span &span : spans)
+        {
+            out << ",\n{\"name\":";
+            write_json_string(out, state.names[span.name]);
+            out << ",\"cat\":\"" << category(span.kind) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+            write_micros(out, span.begin_ns - origin);
+            out << ",\"dur\":";
+            write_micros(out, span.duration_ns);
+            out << ",\"args\":{";
+            const char *separator = "";
+            if (span.arg != no_arg)
+            {
+                if (span.kind == SpanKind::Cycle) { out << "\"evaluation_time_us\":" << span.arg; }
+                else
+                {
+                    out << "\"dwell_us\":";
+                    write_micros(out, span.arg);
+                }
+                separator = ",";
+            }
+            if (span.failed) { out << separator << "\"failed\":true"; }
+            out << "}}";
+        }
+        out << "\n]}\n";
+    }
+
+    void EvaluationTimeline::write_chrome_trace(const std::filesystem::path &path) const
+    {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        if (!out) { throw std::runtime_error("EvaluationTimeline could not open '" + path.string() + "'"); }
+        write_chrome_trace(out);
+        out.flush();
+        if (!out) { throw std::runtime_error("EvaluationTimeline could not write '" + path.string() + "'"); }
+    }
+
+    void EvaluationTimeline::on_before_start_graph(const GraphView &graph)
+    {
+        State &state = *state_;
+        if (graph.is_root())
+        {
+            if (state.spans.size() != state.capacity) { state.spans.resize(state.capacity); }
+            state.running.store(true, std::memory_order_release);
+        }
+        auto &track = state.graphs[graph.data()];
+        if (track == nullptr) { track = std::make_unique<State::GraphTrack>(); }
+        track->root = graph.is_root();
+        track->name = graph_name(state, graph);
+        track->nodes.assign(graph.node_count(), State::NodeTrack{});
+        track->node_names = &state.node_names[{track->name, graph.schema()}];
+        if (track->node_names->size() < track->nodes.size())
+        {
+            track->node_names->resize(track->nodes.size(), unresolved);
+        }
+        state.cached_graph = nullptr;
+        state.cached_track = nullptr;
+        if (options_.lifecycle && options_.graph) { track->begin = timeline_now(); }
+    }
+
+    void EvaluationTimeline::on_after_start_graph(const GraphView &graph)
+    {
+        if (!options_.lifecycle || !options_.graph) { return; }
+        if (auto *track = find_track(*state_, graph)) { push(*state_, SpanKind::GraphStart, track->name, track->begin); }
+    }
+
+    void EvaluationTimeline::on_start_graph_failed(const GraphView &graph)
+    {
+        if (auto *track = find_track(*state_, graph); track != nullptr && options_.lifecycle && options_.graph)
+        {
+            push(*state_, SpanKind::GraphStart, track->name, track->begin, true);
+        }
+        end_run(*state_, graph);
+    }
+
+    void EvaluationTimeline::on_before_start_node(const NodeView &node)
+    {
+        auto *track = node_track(*state_, node);
+        if (track == nullptr) { return; }
+        track->kind = node.node_kind();
+        if (!options_.node) { return; }
+        // node_track leaves the owning graph's track in the cache.
+        std::uint32_t &name = (*state_->cached_track->node_names)[node.node_index()];
+        if (name == unresolved) { name = intern(*state_, diagnostic::node_path(node)); }
+        track->name = name;
+        if (options_.lifecycle) { track->begin = timeline_now(); }
+    }
+
+    void EvaluationTimeline::on_after_start_node(const NodeView &node)
+    {
+        if (!options_.lifecycle || !options_.node) { return; }
+        if (auto *track = node_track(*state_, node)) { push(*state_, SpanKind::NodeStart, track->name, track->begin); }
+    }
+
+    void EvaluationTimeline::on_start_node_failed(const NodeView &node)
+    {
+        if (!options_.lifecycle || !options_.node) { return; }
+        if (auto *track = node_track(*state_, node))
+        {
+            push(*state_, SpanKind::NodeStart, track->name, track->begin, true);
+        }
+    }
+
+    void EvaluationTimeline::on_before_graph_evaluation(const GraphView &graph)
+    {
+        if (!options_.graph) { return; }
+        if (auto *track = find_track(*state_, graph))
+        {
+            if (track->root)
+            {
+                track->evaluation_time =
+                    std::chrono::duration_cast<std::chrono::microseconds>(graph.evaluation_time().time_since_epoch())
+                        .count();
+            }
+            track->begin = timeline_now();
+        }
+    }
+
+    void EvaluationTimeline::on_after_graph_evaluation(const GraphView &graph)
+    {
+        if (!options_.graph) { return; }
+        if (auto *track = find_track(*state_, graph))
+        {
+            push(*state_, track->root ? SpanKind::Cycle : SpanKind::GraphEvaluation, track->name, track->begin,
+                 graph.failed_node().valid(), track->root ? track->evaluation_time : no_arg);
+        }
+    }
+
+    void EvaluationTimeline::on_before_node_evaluation(const NodeView &node)
+    {
+        if (!options_.node) { return; }
+        if (auto *track = node_track(*state_, node)) { track->begin = timeline_now(); }
+    }
+
+    void EvaluationTimeline::on_after_node_evaluation(const NodeView &node)
+    {
+        if (!options_.node) { return; }
+        auto *track = node_track(*state_, node);
+        if (track == nullptr) { return; }
+        if (track->kind == NodeKind::PushSource)
+        {
+            std::int64_t dwell = no_arg;
+            if (const auto enqueued = node.inspection_metrics().applied_enqueue_time; enqueued.has_value())
+            {
+                dwell = track->begin - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           enqueued->time_since_epoch())
+                                           .count();
+            }
+            push(*state_, SpanKind::PushDrain, track->name, track->begin, failed_node_is(node), dwell);
+            return;
+        }
+        push(*state_, SpanKind::NodeEvaluation, track->name, track->begin, failed_node_is(node));
+    }
+
+    void EvaluationTimeline::on_before_stop_node(const NodeView &node)
+    {
+        if (!options_.lifecycle || !options_.node) { return; }
+        if (auto *track = node_track(*state_, node)) { track->begin = timeline_now(); }
+    }
+
+    void EvaluationTimeline::on_after_stop_node(const NodeView &node)
+    {
+        if (!options_.lifecycle || !options_.node) { return; }
+        if (auto *track = node_track(*state_, node)) { push(*state_, SpanKind::NodeStop, track->name, track->begin); }
+    }
+
+    void EvaluationTimeline::on_stop_node_failed(const NodeView &node)
+    {
+        if (!options_.lifecycle || !options_.node) { return; }
+        if (auto *track = node_track(*state_, node))
+        {
+            push(*state_, SpanKind::NodeStop, track->name, track->begin, true);
+        }
+    }
+
+    void EvaluationTimeline::on_before_stop_graph(const GraphView &graph)
+    {
+        if (!options_.lifecycle || !options_.graph) { return; }
+        if (auto *track = find_track(*state_, graph)) { track->begin = timeline_now(); }
+    }
+
+    void EvaluationTimeline::on_after_stop_graph(const GraphView &graph)
+    {
+        if (auto *track = find_track(*state_, graph); track != nullptr && options_.lifecycle && options_.graph)
+        {
+            push(*state_, SpanKind::GraphStop, track->name, track->begin);
+        }
+        end_run(*state_, graph);
+    }
+
+    void EvaluationTimeline::on_stop_graph_failed(const GraphView &graph)
+    {
+        if (auto *track = find_track(*state_, graph); track != nullptr && options_.lifecycle && options_.graph)
+        {
+            push(*state_, SpanKind::GraphStop, track->name, track->begin, true);
+        }
+        end_run(*state_, graph);
+    }
+}  // namespace hgraph
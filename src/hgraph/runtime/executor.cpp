@@ -27,6 +27,14 @@
 #include <utility>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace hgraph
 {
     namespace detail
@@ -54,6 +62,23 @@ namespace hgraph
             return std::chrono::time_point_cast<std::chrono::microseconds>(engine_clock::now());
         }
 
+        [[nodiscard]] std::unique_ptr<GraphArena> make_arena(const GraphExecutorBuilder &builder)
+        {
+            if (builder.allocator_policy() != GraphAllocatorPolicy::Arena) { return nullptr; }
+            return std::make_unique<GraphArena>(builder.arena_chunk_bytes());
+        }
+
+        /** Build the root graph with its storage bound to ``arena`` when the run has one. The
+            build is the arena's static phase: graph and node storage is bumped at exact size. */
+        [[nodiscard]] GraphValue make_root_graph(const GraphExecutorBuilder &builder, GraphArena *arena,
+                                                 ExecutorPtr executor)
+        {
+            if (arena == nullptr) { return builder.graph_builder().make_root_graph(executor); }
+            MemoryUtils::AllocatorScope allocator_scope{arena->ops()};
+            GraphArena::StaticScope     static_scope{*arena};
+            return builder.graph_builder().make_root_graph(executor);
+        }
+
         struct SimulationExecutorStorage
         {
             SimulationExecutorStorage(const GraphExecutorBuilder &builder,
@@ -61,7 +86,8 @@ namespace hgraph
                                       void *executor_memory)
                 : logger(builder.logger() != nullptr ? builder.logger()
                                                      : log::shared_logger()),
-                  graph(builder.graph_builder().make_root_graph(type.writable(executor_memory))),
+                  arena(make_arena(builder)),
+                  graph(make_root_graph(builder, arena.get(), type.writable(executor_memory))),
                   start_time(builder.start_time()),
                   end_time(builder.end_time()),
                   evaluation_time(builder.start_time()),
@@ -85,6 +111,7 @@ namespace hgraph
 
             LifecycleObserverList lifecycle_observers{}; // declared first so it is constructed before graph
             std::shared_ptr<spdlog::logger> logger{};
+            std::unique_ptr<GraphArena> arena{};   // declared before graph so it outlives graph storage
             GraphValue       graph{};
             DateTime         start_time{MIN_ST};
             DateTime         end_time{MAX_ET};
@@ -111,12 +138,14 @@ namespace hgraph
                                     void *executor_memory)
                 : logger(builder.logger() != nullptr ? builder.logger()
                                                      : log::shared_logger()),
-                  graph(builder.graph_builder().make_root_graph(type.writable(executor_memory))),
+                  arena(make_arena(builder)),
+                  graph(make_root_graph(builder, arena.get(), type.writable(executor_memory))),
                   start_time(builder.start_time()),
                   end_time(builder.end_time()),
                   evaluation_time(builder.start_time()),
                   error_capture_options(builder.error_capture_options()),
                   cleanup_on_error(builder.cleanup_on_error()),
+                  wait_options(builder.realtime_wait_options()),
                   phase_runner(builder.phase_runner()),
                   run_logging_enabled(builder.logger() != nullptr)
             {
@@ -133,6 +162,7 @@ namespace hgraph
 
             LifecycleObserverList lifecycle_observers{}; // declared first so it is constructed before graph
             std::shared_ptr<spdlog::logger> logger{};
+            std::unique_ptr<GraphArena>  arena{};   // declared before graph so it outlives graph storage
             GraphValue                   graph{};
             DateTime                     start_time{MIN_ST};
             DateTime                     end_time{MAX_ET};
@@ -142,16 +172,20 @@ namespace hgraph
             std::uint32_t                consecutive_immediate_cycles{0};
             ErrorCaptureOptions          error_capture_options{};
             bool                         cleanup_on_error{true};
+            RealTimeWaitOptions          wait_options{};
             // One-shot cycle-boundary notifications (2026-08-01): drained by
             // the run loop at the root cycle boundaries; eval-thread only.
             std::vector<std::function<void()>> before_evaluation_notifications{};
             std::vector<std::function<void()>> after_evaluation_notifications{};
 
+            // The mutex and condition are only touched to park: ``parked`` is
+            // set while the run loop sleeps, so a push mark issued while the
+            // loop is spinning or evaluating costs one atomic exchange.
             mutable std::mutex           mutex{};
             std::condition_variable      condition{};
+            std::atomic_bool             parked{false};
             std::atomic_bool             stop_requested{false};
-            bool                         push_update_pending{false};
-            bool                         ready_to_push{false};
+            std::atomic_bool             push_update_pending{false};
             GraphExecutorPhaseRunner     phase_runner{};
             bool                         run_logging_enabled{false};
         };
@@ -329,28 +363,31 @@ namespace hgraph
         void realtime_mark_push_update_pending_impl(const void *, void *memory)
         {
             auto &state = realtime_storage(memory);
+            if (state.stop_requested.load(std::memory_order_acquire)) { return; }
+            // Only the clear -> set transition can wake the run loop, and only
+            // a parked loop needs the mutex; repeated marks and marks against
+            // a spinning or evaluating loop stay off it entirely. Sequentially
+            // consistent on both sides (see park_realtime): either this load
+            // sees the waiter parked or the waiter's predicate sees the mark.
+            if (state.push_update_pending.exchange(true, std::memory_order_seq_cst)) { return; }
+            if (!state.parked.load(std::memory_order_seq_cst)) { return; }
             {
+                // Pairs with the predicate check in park_realtime so the
+                // notification cannot slip in before the waiter blocks.
                 std::lock_guard lock{state.mutex};
-                if (state.stop_requested.load(std::memory_order_acquire)) { return; }
-                state.push_update_pending = true;
             }
             state.condition.notify_all();
         }
 
         bool realtime_is_push_update_pending_impl(const void *, void *memory) noexcept
         {
-            auto &state = realtime_storage(memory);
-            std::lock_guard lock{state.mutex};
-            return state.push_update_pending;
+            return realtime_storage(memory).push_update_pending.load(std::memory_order_acquire);
         }
 
         bool realtime_reset_push_update_pending_impl(const void *, void *memory) noexcept
         {
-            auto &state = realtime_storage(memory);
-            std::lock_guard lock{state.mutex};
-            const bool pending = state.push_update_pending;
-            state.push_update_pending = false;
-            return pending;
+            return realtime_storage(memory).push_update_pending.exchange(
+                false, std::memory_order_acq_rel);
         }
 
         [[nodiscard]] DateTime advance_simulation(SimulationExecutorStorage &state, DateTime next_scheduled_time)
@@ -370,29 +407,56 @@ namespace hgraph
         // loop exceeds it almost immediately.
         constexpr std::uint32_t max_immediate_drain_cycles = 1024;
 
-        [[nodiscard]] DateTime advance_realtime(RealTimeExecutorStorage &state, DateTime next_scheduled_time)
+        // Longest single park; the loop re-reads the wall clock after each.
+        constexpr TimeDelta max_park_time{10'000'000};
+
+        /** Processor hint for one iteration of a busy-wait loop. */
+        inline void spin_pause() noexcept
         {
-            const DateTime target = std::min(next_scheduled_time, state.end_time);
-            DateTime       wall_now = current_wall_time();
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+            _mm_pause();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+            __asm__ __volatile__("yield");
+#endif
+        }
+
+        [[nodiscard]] bool realtime_wait_over(const RealTimeExecutorStorage &state) noexcept
+        {
+            return state.stop_requested.load(std::memory_order_acquire) ||
+                   state.push_update_pending.load(std::memory_order_seq_cst);
+        }
 
+        /** Sleep until ``deadline`` or a push / stop wake-up, whichever comes first. */
+        void park_realtime(RealTimeExecutorStorage &state, DateTime wall_now, DateTime deadline)
+        {
+            std::unique_lock lock{state.mutex};
+            state.parked.store(true, std::memory_order_seq_cst);
+            if (!realtime_wait_over(state))
             {
-                std::lock_guard lock{state.mutex};
-                state.ready_to_push = false;
+                state.condition.wait_for(lock, std::min(deadline - wall_now, max_park_time));
             }
+            state.parked.store(false, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] DateTime advance_realtime(RealTimeExecutorStorage &state, DateTime next_scheduled_time)
+        {
+            const DateTime target = std::min(next_scheduled_time, state.end_time);
+            DateTime       wall_now = current_wall_time();
 
             const DateTime next_cycle = state.evaluation_time + MIN_TD;
-            if (target > next_cycle || wall_now > state.last_time_allowed_push + TimeDelta{15'000'000})
+            if (target > next_cycle || wall_now > state.last_time_allowed_push + state.wait_options.push_window)
             {
-                std::unique_lock lock{state.mutex};
-                state.ready_to_push = true;
                 state.last_time_allowed_push = wall_now;
 
-                while (!state.stop_requested.load(std::memory_order_acquire) &&
-                       wall_now < target &&
-                       !state.push_update_pending)
+                // Spin first, park once the budget is spent, and come back
+                // ``spin_budget`` early to spin out the last stretch before a
+                // scheduled time. With no budget this is a plain park.
+                const TimeDelta spin_budget = std::max(state.wait_options.spin_budget, TimeDelta{0});
+                const DateTime  spin_until  = wall_now + spin_budget;
+                while (wall_now < target && !realtime_wait_over(state))
                 {
-                    const TimeDelta sleep_time = std::min(target - wall_now, TimeDelta{10'000'000});
-                    state.condition.wait_for(lock, sleep_time);
+                    if (wall_now < spin_until || target - wall_now <= spin_budget) { spin_pause(); }
+                    else { park_realtime(state, wall_now, target - spin_budget); }
                     wall_now = current_wall_time();
                 }
             }
@@ -637,9 +701,56 @@ namespace hgraph
                         });
         }
 
+        /**
+         * Pins the calling thread to one CPU for the scope's lifetime and
+         * restores its previous affinity afterwards. Inert for a negative CPU
+         * and on platforms without a thread-affinity API.
+         */
+        class ThreadAffinityScope
+        {
+          public:
+            explicit ThreadAffinityScope(int cpu)
+            {
+                if (cpu < 0) { return; }
+#if defined(__linux__)
+                if (cpu >= CPU_SETSIZE)
+                {
+                    throw std::invalid_argument(fmt::format("RealTimeWaitOptions pin_cpu {} is out of range", cpu));
+                }
+                if (pthread_getaffinity_np(pthread_self(), sizeof(previous_), &previous_) != 0) { return; }
+                cpu_set_t pinned;
+                CPU_ZERO(&pinned);
+                CPU_SET(cpu, &pinned);
+                if (pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned) != 0)
+                {
+                    throw std::invalid_argument(
+                        fmt::format("RealTimeWaitOptions pin_cpu {} is not available to this process", cpu));
+                }
+                pinned_ = true;
+#endif
+            }
+
+            ThreadAffinityScope(const ThreadAffinityScope &)            = delete;
+            ThreadAffinityScope &operator=(const ThreadAffinityScope &) = delete;
+
+            ~ThreadAffinityScope()
+            {
+#if defined(__linux__)
+                if (pinned_) { static_cast<void>(pthread_setaffinity_np(pthread_self(), sizeof(previous_), &previous_)); }
+#endif
+            }
+
+          private:
+#if defined(__linux__)
+            cpu_set_t previous_{};
+            bool      pinned_{false};
+#endif
+        };
+
         void realtime_run_impl(const void *, const GraphExecutorView &executor)
         {
             auto &state = realtime_storage(executor.data());
+            const ThreadAffinityScope affinity{state.wait_options.pin_cpu};
             run_storage(state,
                         [](RealTimeExecutorStorage &storage, DateTime next) {
                             return advance_realtime(storage, next);
@@ -735,6 +846,16 @@ namespace hgraph
             return realtime_storage(memory).logger.get();
         }
 
+        const GraphArena *simulation_arena_impl(const void *, const void *memory) noexcept
+        {
+            return simulation_storage(memory).arena.get();
+        }
+
+        const GraphArena *realtime_arena_impl(const void *, const void *memory) noexcept
+        {
+            return realtime_storage(memory).arena.get();
+        }
+
         bool simulation_run_logging_enabled_impl(const void *,
                                                  const void *memory) noexcept
         {
@@ -788,6 +909,7 @@ namespace hgraph
                 .reset_push_update_pending_impl = &simulation_reset_push_update_pending_impl,
                 .lifecycle_observers_impl = &simulation_lifecycle_observers_impl,
                 .logger_impl = &simulation_logger_impl,
+                .arena_impl = &simulation_arena_impl,
                 .run_logging_enabled_impl = &simulation_run_logging_enabled_impl,
                 .error_capture_options_impl = &simulation_error_capture_options_impl,
                 .cleanup_on_error_impl = &simulation_cleanup_on_error_impl,
@@ -811,6 +933,7 @@ namespace hgraph
                 .reset_push_update_pending_impl = &realtime_reset_push_update_pending_impl,
                 .lifecycle_observers_impl = &realtime_lifecycle_observers_impl,
                 .logger_impl = &realtime_logger_impl,
+                .arena_impl = &realtime_arena_impl,
                 .run_logging_enabled_impl = &realtime_run_logging_enabled_impl,
                 .error_capture_options_impl = &realtime_error_capture_options_impl,
                 .cleanup_on_error_impl = &realtime_cleanup_on_error_impl,
@@ -1217,6 +1340,13 @@ namespace hgraph
                    : nullptr;
     }
 
+    const GraphArena *GraphExecutorView::arena() const noexcept
+    {
+        return valid() && ops().arena_impl != nullptr
+                   ? ops().arena_impl(ops().context, data())
+                   : nullptr;
+    }
+
     bool GraphExecutorView::run_logging_enabled() const noexcept
     {
         return valid() && ops().run_logging_enabled_impl != nullptr &&
@@ -1373,6 +1503,20 @@ namespace hgraph
         return *this;
     }
 
+    GraphExecutorBuilder &GraphExecutorBuilder::allocator_policy(GraphAllocatorPolicy policy,
+                                                                 std::size_t arena_chunk_bytes) noexcept
+    {
+        allocator_policy_  = policy;
+        arena_chunk_bytes_ = arena_chunk_bytes;
+        return *this;
+    }
+
+    GraphExecutorBuilder &GraphExecutorBuilder::realtime_wait_options(RealTimeWaitOptions options) noexcept
+    {
+        realtime_wait_options_ = options;
+        return *this;
+    }
+
     std::string_view GraphExecutorBuilder::label() const noexcept
     {
         return label_;
@@ -1428,6 +1572,21 @@ namespace hgraph
         return lifecycle_observers_;
     }
 
+    GraphAllocatorPolicy GraphExecutorBuilder::allocator_policy() const noexcept
+    {
+        return allocator_policy_;
+    }
+
+    std::size_t GraphExecutorBuilder::arena_chunk_bytes() const noexcept
+    {
+        return arena_chunk_bytes_;
+    }
+
+    const RealTimeWaitOptions &GraphExecutorBuilder::realtime_wait_options() const noexcept
+    {
+        return realtime_wait_options_;
+    }
+
     GraphTypeRef GraphExecutorBuilder::graph_type() const
     {
         return graph_builder_.type();
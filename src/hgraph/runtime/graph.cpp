@@ -1,5 +1,6 @@
 #include <hgraph/runtime/graph.h>
 
+#include "child_evaluation_pool.h"
 #include "registry_snapshot_detail.h"
 
 #include <hgraph/types/metadata/type_realization.h>
@@ -13,16 +14,21 @@
 #include <hgraph/util/scope.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <exception>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace hgraph {
 namespace {
@@ -151,6 +157,401 @@ output_at_path(TSOutputView view, const std::vector<std::size_t> &path) {
   return view;
 }
 
+/**
+ * Rank-ordered pending-schedule set for ``GraphSchedulingMode::ActiveSet``.
+ *
+ * One bit per node index is set whenever ``schedule_node`` accepts a time,
+ * so every node holding a current or future schedule entry is a member. The
+ * evaluation loop visits members in index (rank) order and drops a member
+ * once its entry is consumed or stale. A second-level summary keeps one bit
+ * per non-empty word, making ``next`` proportional to the number of members
+ * rather than the graph width. Empty when the graph scans instead.
+ */
+struct GraphActiveSet {
+  static constexpr std::size_t word_bits = 64;
+
+  void reset(std::size_t node_count) {
+    const std::size_t word_count = (node_count + word_bits - 1) / word_bits;
+    words.assign(word_count, 0);
+    summary.assign((word_count + word_bits - 1) / word_bits, 0);
+  }
+
+  [[nodiscard]] bool enabled() const noexcept { return !words.empty(); }
+
+  void mark(std::size_t index) noexcept {
+    const std::size_t word = index / word_bits;
+    words[word] |= std::uint64_t{1} << (index % word_bits);
+    summary[word / word_bits] |= std::uint64_t{1} << (word % word_bits);
+  }
+
+  void clear(std::size_t index) noexcept {
+    const std::size_t word = index / word_bits;
+    words[word] &= ~(std::uint64_t{1} << (index % word_bits));
+    if (words[word] == 0) {
+      summary[word / word_bits] &= ~(std::uint64_t{1} << (word % word_bits));
+    }
+  }
+
+  /** First member at or after ``from``; ``invalid_cursor`` when none. */
+  [[nodiscard]] std::size_t next(std::size_t from) const noexcept {
+    std::size_t word = from / word_bits;
+    if (word >= words.size()) {
+      return invalid_cursor;
+    }
+    const std::uint64_t bits =
+        words[word] & (~std::uint64_t{0} << (from % word_bits));
+    if (bits != 0) {
+      return word * word_bits + std::countr_zero(bits);
+    }
+    ++word;
+    const std::size_t first_group = word / word_bits;
+    for (std::size_t group = first_group; group < summary.size(); ++group) {
+      std::uint64_t candidates = summary[group];
+      if (group == first_group) {
+        candidates &= ~std::uint64_t{0} << (word % word_bits);
+      }
+      if (candidates != 0) {
+        const std::size_t found =
+            group * word_bits + std::countr_zero(candidates);
+        return found * word_bits + std::countr_zero(words[found]);
+      }
+    }
+    return invalid_cursor;
+  }
+
+  std::vector<std::uint64_t> words{};
+  std::vector<std::uint64_t> summary{};
+};
+
+/**
+ * Future node schedules of a root graph in ``GraphSchedulingMode::TimingWheel``.
+ *
+ * A hierarchical timing wheel over microsecond ticks: level ``l`` has 64
+ * slots of ``64^l`` ticks each, and an entry sits at the level of the highest
+ * 6-bit digit in which its time differs from the wheel's ``now``. Every entry
+ * on a lower level is therefore earlier than every entry on a higher one, and
+ * within a level the slots are in time order, so the earliest pending time is
+ * the first occupied slot of the lowest occupied level (one ``countr_zero``
+ * per level). ``advance`` moves ``now`` forward, emitting due entries and
+ * cascading a coarse slot into finer levels only when ``now`` reaches it.
+ * Months of simulated time span five levels; levels are allocated on first
+ * use.
+ *
+ * The graph schedule table stays authoritative: an entry is live only while
+ * its node's table entry still equals the entry's time. Entries left behind
+ * when a node is moved to an earlier time are dropped when they are reached.
+ * Times at or before ``now`` never enter the wheel (the current cycle is
+ * tracked by the graph's active set).
+ */
+class GraphTimingWheel {
+public:
+  static constexpr std::size_t slot_bits = 6;
+  static constexpr std::size_t slot_count = std::size_t{1} << slot_bits;
+  static constexpr std::size_t max_levels =
+      (64 + slot_bits - 1) / slot_bits;
+
+  explicit GraphTimingWheel(DateTime now) noexcept : now_(ticks(now)) {}
+
+  /** Add ``node_index`` at ``when``; ``when`` must be after ``now``. */
+  void insert(std::size_t node_index, DateTime when) {
+    insert(Entry{.when = ticks(when), .node_index = node_index});
+  }
+
+  /**
+   * Move ``now`` to ``until``, calling ``on_due(node_index, when)`` for each
+   * entry at or before ``until`` (live or not) and re-levelling the rest.
+   */
+  template <typename OnDue> void advance(DateTime until, OnDue &&on_due) {
+    const std::uint64_t target = ticks(until);
+    if (target <= now_) {
+      return;
+    }
+    for (;;) {
+      const auto found = first_slot();
+      if (!found.has_value() || found->start > target) {
+        break;
+      }
+      Bucket &bucket = levels_[found->level]->slots[found->slot];
+      clear_slot(found->level, found->slot);
+      now_ = std::max(now_, found->start);
+      // Entries past ``until`` land on finer levels relative to the new
+      // ``now``, never back in this slot.
+      std::vector<Entry> entries;
+      entries.swap(bucket.entries);
+      bucket.earliest = no_entry;
+      for (const Entry &entry : entries) {
+        if (entry.when <= target) {
+          on_due(entry.node_index, from_ticks(entry.when));
+        } else {
+          insert(entry);
+        }
+      }
+      entries.clear();
+      if (bucket.entries.empty()) {
+        bucket.entries.swap(entries); // keep the capacity for reuse
+      }
+    }
+    now_ = target;
+  }
+
+  /**
+   * The earliest live entry's time, or ``MAX_DT``. ``live(node_index, when)``
+   * reports whether the schedule table still holds that time; dead entries
+   * met on the way are discarded.
+   */
+  template <typename Live> [[nodiscard]] DateTime next_time(Live &&live) {
+    while (const auto found = first_slot()) {
+      Bucket &bucket = levels_[found->level]->slots[found->slot];
+      if (bucket.earliest == no_entry ||
+          !live(bucket.entries[bucket.earliest].node_index,
+                from_ticks(bucket.entries[bucket.earliest].when))) {
+        prune(bucket, live);
+      }
+      if (!bucket.entries.empty()) {
+        return from_ticks(bucket.entries[bucket.earliest].when);
+      }
+      clear_slot(found->level, found->slot);
+    }
+    return MAX_DT;
+  }
+
+private:
+  static constexpr std::size_t no_entry = invalid_cursor;
+
+  struct Entry {
+    std::uint64_t when{0};
+    std::size_t node_index{0};
+  };
+
+  struct Bucket {
+    std::vector<Entry> entries{};
+    /** Index of the earliest entry; ``no_entry`` when empty. */
+    std::size_t earliest{no_entry};
+  };
+
+  struct Level {
+    std::uint64_t occupied{0};
+    std::array<Bucket, slot_count> slots{};
+  };
+
+  struct SlotRef {
+    std::size_t level{0};
+    std::size_t slot{0};
+    std::uint64_t start{0};
+  };
+
+  /** Order-preserving map of a signed microsecond count onto ``uint64``. */
+  [[nodiscard]] static std::uint64_t ticks(DateTime when) noexcept {
+    return static_cast<std::uint64_t>(when.time_since_epoch().count()) ^
+           (std::uint64_t{1} << 63);
+  }
+
+  [[nodiscard]] static DateTime from_ticks(std::uint64_t value) noexcept {
+    return DateTime{DateTime::duration{
+        static_cast<DateTime::rep>(value ^ (std::uint64_t{1} << 63))}};
+  }
+
+  void insert(const Entry &entry) {
+    const std::uint64_t differing = entry.when ^ now_;
+    const std::size_t level =
+        differing == 0
+            ? 0
+            : static_cast<std::size_t>(std::bit_width(differing) - 1) /
+                  slot_bits;
+    const std::size_t slot =
+        static_cast<std::size_t>(entry.when >> (level * slot_bits)) &
+        (slot_count - 1);
+    if (levels_.size() <= level) {
+      levels_.resize(level + 1);
+    }
+    if (!levels_[level]) {
+      levels_[level] = std::make_unique<Level>();
+    }
+    Level &target = *levels_[level];
+    Bucket &bucket = target.slots[slot];
+    bucket.entries.push_back(entry);
+    if (bucket.earliest == no_entry ||
+        entry.when < bucket.entries[bucket.earliest].when) {
+      bucket.earliest = bucket.entries.size() - 1;
+    }
+    target.occupied |= std::uint64_t{1} << slot;
+  }
+
+  /** The first occupied slot of the lowest occupied level. */
+  [[nodiscard]] std::optional<SlotRef> first_slot() const noexcept {
+    for (std::size_t level = 0; level < levels_.size(); ++level) {
+      if (!levels_[level] || levels_[level]->occupied == 0) {
+        continue;
+      }
+      const auto slot = static_cast<std::size_t>(
+          std::countr_zero(levels_[level]->occupied));
+      const std::size_t shift = level * slot_bits;
+      const std::size_t span_shift = shift + slot_bits;
+      const std::uint64_t base =
+          span_shift >= 64 ? 0 : now_ & ~((std::uint64_t{1} << span_shift) - 1);
+      return SlotRef{.level = level,
+                     .slot = slot,
+                     .start = base | (static_cast<std::uint64_t>(slot) << shift)};
+    }
+    return std::nullopt;
+  }
+
+  void clear_slot(std::size_t level, std::size_t slot) noexcept {
+    levels_[level]->occupied &= ~(std::uint64_t{1} << slot);
+  }
+
+  template <typename Live> void prune(Bucket &bucket, Live &live) {
+    std::erase_if(bucket.entries, [&](const Entry &entry) {
+      return !live(entry.node_index, from_ticks(entry.when));
+    });
+    bucket.earliest = no_entry;
+    for (std::size_t index = 0; index < bucket.entries.size(); ++index) {
+      if (bucket.earliest == no_entry ||
+          bucket.entries[index].when < bucket.entries[bucket.earliest].when) {
+        bucket.earliest = index;
+      }
+    }
+  }
+
+  std::uint64_t now_{0};
+  std::vector<std::unique_ptr<Level>> levels_{};
+};
+
+/**
+ * Dependency levels of a root graph in ``GraphSchedulingMode::LevelParallel``.
+ *
+ * A node's level is one more than the highest level among the nodes feeding
+ * it through graph edges (sources are level 0), so nodes of one level never
+ * read each other's outputs. ``nodes[level_begin[l], level_begin[l + 1])``
+ * lists level ``l`` in rank order.
+ */
+struct GraphLevelSchedule {
+  std::vector<std::size_t> level_begin{};
+  std::vector<std::size_t> nodes{};
+  /** Per node index: must evaluate on the engine thread. */
+  std::vector<std::uint8_t> pinned{};
+  // Per-cycle scratch, retained so a steady-state cycle does not allocate.
+  std::vector<std::size_t> due{};
+  std::vector<std::size_t> engine_due{};
+  std::vector<std::exception_ptr> errors{};
+  std::vector<std::uint8_t> paused{};
+  /** Serialises ``schedule_node`` while a level evaluates concurrently. */
+  std::recursive_mutex schedule_mutex{};
+};
+
+/** Nodes that reach shared state outside their own storage and outputs stay
+    on the engine thread: REF endpoints subscribe to and unsubscribe from
+    other nodes' observer lists as they rebind, nested nodes own child graphs
+    and TSD slot stores, and framework nodes carrying an extended view
+    context (services, shared outputs, reduce, switch) share registries
+    across nodes. */
+[[nodiscard]] bool level_pinned_to_engine(NodeTypeRef type) {
+  const NodeTypeMetaData *schema = type.schema();
+  if (schema == nullptr || schema->uses_python_values ||
+      schema->uses_global_state || schema->requires_phase_runner ||
+      schema->node_kind == NodeKind::PushSource ||
+      schema->node_kind == NodeKind::Nested) {
+    return true;
+  }
+  const NodeOps *ops = type.ops();
+  if (ops == nullptr || ops->extended_view_context != nullptr) {
+    return true;
+  }
+  return (schema->input_schema != nullptr &&
+          TypeRegistry::contains_ref(schema->input_schema)) ||
+         (schema->output_schema != nullptr &&
+          TypeRegistry::contains_ref(schema->output_schema));
+}
+
+[[nodiscard]] std::unique_ptr<GraphLevelSchedule>
+make_level_schedule(const GraphBuilder &builder) {
+  const auto &nodes = builder.nodes();
+  const std::size_t node_count = nodes.size();
+  auto result = std::make_unique<GraphLevelSchedule>();
+  result->pinned.resize(node_count);
+
+  // Edges carry no order guarantee; bucket sources by target so each level
+  // is final before any node that reads it (targets outrank their sources).
+  std::vector<std::pair<std::size_t, std::size_t>> incoming;
+  incoming.reserve(builder.edges().size());
+  for (const GraphEdge &edge : builder.edges()) {
+    const std::size_t source = graph_edge_source_node(edge.source_node);
+    if (source < edge.target_node && edge.target_node < node_count) {
+      incoming.emplace_back(edge.target_node, source);
+    }
+  }
+  std::ranges::sort(incoming);
+
+  std::vector<std::size_t> level(node_count, 0);
+  std::size_t level_count = 0;
+  auto edge = incoming.begin();
+  for (std::size_t index = 0; index < node_count; ++index) {
+    const NodeTypeMetaData *schema = nodes[index].type().schema();
+    result->pinned[index] = level_pinned_to_engine(nodes[index].type()) ? 1U : 0U;
+    for (; edge != incoming.end() && edge->first == index; ++edge) {
+      level[index] = std::max(level[index], level[edge->second] + 1);
+    }
+    // Push sources evaluate in the root's push phase, ahead of the levels.
+    if (schema == nullptr || schema->node_kind != NodeKind::PushSource) {
+      level_count = std::max(level_count, level[index] + 1);
+    }
+  }
+
+  result->level_begin.assign(level_count + 1, 0);
+  for (std::size_t index = 0; index < node_count; ++index) {
+    const NodeTypeMetaData *schema = nodes[index].type().schema();
+    if (schema != nullptr && schema->node_kind == NodeKind::PushSource) {
+      continue;
+    }
+    ++result->level_begin[level[index] + 1];
+  }
+  for (std::size_t l = 1; l <= level_count; ++l) {
+    result->level_begin[l] += result->level_begin[l - 1];
+  }
+  result->nodes.resize(result->level_begin.back());
+  std::vector<std::size_t> cursor(result->level_begin.begin(),
+                                  result->level_begin.end() - 1);
+  for (std::size_t index = 0; index < node_count; ++index) {
+    const NodeTypeMetaData *schema = nodes[index].type().schema();
+    if (schema != nullptr && schema->node_kind == NodeKind::PushSource) {
+      continue;
+    }
+    result->nodes[cursor[level[index]]++] = index;
+  }
+  return result;
+}
+
+/** Set on threads evaluating one level concurrently; routes schedule_node
+    through the level's mutex (nested graphs schedule up into the root). */
+thread_local std::recursive_mutex *concurrent_schedule_mutex = nullptr;
+
+struct ConcurrentScheduleScope {
+  explicit ConcurrentScheduleScope(std::recursive_mutex &mutex) noexcept
+      : previous(std::exchange(concurrent_schedule_mutex, &mutex)) {}
+  ConcurrentScheduleScope(const ConcurrentScheduleScope &) = delete;
+  ConcurrentScheduleScope &operator=(const ConcurrentScheduleScope &) = delete;
+  ~ConcurrentScheduleScope() { concurrent_schedule_mutex = previous; }
+
+  std::recursive_mutex *previous{nullptr};
+};
+
+/** A level-parallel root hands ``Scan`` to its nested graphs: they evaluate
+    inside one node, already on whichever thread runs that node. A timing-wheel
+    root hands them ``ActiveSet``: a nested graph's schedules all fall within
+    its parent's cycles, and a wheel per child instance would cost far more
+    than it saves. */
+[[nodiscard]] GraphSchedulingMode
+nested_scheduling_mode(GraphSchedulingMode parent) noexcept {
+  switch (parent) {
+  case GraphSchedulingMode::LevelParallel:
+    return GraphSchedulingMode::Scan;
+  case GraphSchedulingMode::TimingWheel:
+    return GraphSchedulingMode::ActiveSet;
+  default:
+    return parent;
+  }
+}
+
 struct GraphRuntimeBaseStorage {
   GraphRuntimeBaseStorage() = default;
 
@@ -182,7 +583,23 @@ struct GraphRuntimeBaseStorage {
   /** Borrowed from executor storage; nested graphs copy their parent's pointer.
    */
   spdlog::logger *logger{nullptr};
+  /** The allocator this graph's storage was built under (the run's arena or
+      the process default); nested graphs copy their parent's pointer. */
+  const MemoryUtils::AllocatorOps *allocator{nullptr};
   const TypeRealizationSnapshot *type_realization{nullptr};
+  GraphSchedulingMode scheduling_mode{GraphSchedulingMode::Scan};
+  /** Populated in ``GraphSchedulingMode::ActiveSet`` and ``TimingWheel``
+      (where it holds only the current cycle's due nodes). */
+  GraphActiveSet active_set{};
+
+  void select_scheduling_mode(GraphSchedulingMode mode,
+                              std::size_t node_count) {
+    scheduling_mode = mode;
+    if (mode == GraphSchedulingMode::ActiveSet ||
+        mode == GraphSchedulingMode::TimingWheel) {
+      active_set.reset(node_count);
+    }
+  }
 };
 
 struct RootGraphRuntimeStorage : GraphRuntimeBaseStorage {
@@ -194,6 +611,10 @@ struct RootGraphRuntimeStorage : GraphRuntimeBaseStorage {
 
   GlobalState global_state{};
   ExecutorPtr root_executor_ptr{};
+  /** Populated only in ``GraphSchedulingMode::LevelParallel``. */
+  std::unique_ptr<GraphLevelSchedule> level_schedule{};
+  /** Populated only in ``GraphSchedulingMode::TimingWheel``. */
+  std::unique_ptr<GraphTimingWheel> timing_wheel{};
 };
 
 struct NestedGraphRuntimeStorage : GraphRuntimeBaseStorage {
@@ -213,6 +634,11 @@ inline constexpr std::string_view graph_compound_scalar_storage_field_name{
     "compound_scalar_storage"};
 inline constexpr std::string_view graph_nodes_field_name{"nodes"};
 inline constexpr std::string_view graph_schedule_field_name{"schedule"};
+inline constexpr std::string_view graph_hot_nodes_field_name{"hot_nodes"};
+
+// The hot node array is rebuilt in place on construction and never destroyed
+// element by element.
+static_assert(std::is_trivially_destructible_v<NodePtr>);
 
 struct GraphNodeRuntimeLocation {
   NodeTypeRef type{};
@@ -225,6 +651,9 @@ struct GraphRuntimeStorageLayout {
   std::size_t compound_scalar_storage_offset{invalid_cursor};
   std::size_t schedule_offset{0};
   std::size_t schedule_stride{0};
+  /** ``GraphNodeLayout::HotCold`` only: the dense ``NodePtr`` array. */
+  std::size_t hot_nodes_offset{invalid_cursor};
+  std::size_t hot_nodes_stride{0};
 };
 
 struct GraphRuntimeContext {
@@ -252,29 +681,40 @@ graph_nodes_plan_for(const std::vector<NodeBuilder> &nodes) {
 [[nodiscard]] const MemoryUtils::StoragePlan &
 graph_storage_plan_for(const MemoryUtils::StoragePlan &header_plan,
                        const MemoryUtils::StoragePlan *compound_storage_plan,
-                       const std::vector<NodeBuilder> &nodes) {
+                       const std::vector<NodeBuilder> &nodes,
+                       GraphNodeLayout layout) {
   auto builder = MemoryUtils::named_tuple();
-  builder.reserve(compound_storage_plan != nullptr ? 4 : 3);
+  builder.reserve(compound_storage_plan != nullptr ? 5 : 4);
   builder.add_field(graph_header_field_name, header_plan);
+  if (layout == GraphNodeLayout::HotCold) {
+    // Everything the per-cycle scan reads for every node, ahead of the
+    // node blocks.
+    builder.add_field(graph_schedule_field_name,
+                      MemoryUtils::array_plan<DateTime>(nodes.size()));
+    builder.add_field(graph_hot_nodes_field_name,
+                      MemoryUtils::array_plan<NodePtr>(nodes.size()));
+  }
   if (compound_storage_plan != nullptr) {
     builder.add_field(graph_compound_scalar_storage_field_name,
                       *compound_storage_plan);
   }
   builder.add_field(graph_nodes_field_name, graph_nodes_plan_for(nodes));
-  builder.add_field(graph_schedule_field_name,
-                    MemoryUtils::array_plan<DateTime>(nodes.size()));
+  if (layout == GraphNodeLayout::Interleaved) {
+    builder.add_field(graph_schedule_field_name,
+                      MemoryUtils::array_plan<DateTime>(nodes.size()));
+  }
   return builder.build();
 }
 
 template <typename Header, typename CompoundStorage>
 [[nodiscard]] const MemoryUtils::StoragePlan &
 graph_storage_plan_for(const std::vector<NodeBuilder> &nodes,
-                       bool include_compound_storage) {
+                       bool include_compound_storage, GraphNodeLayout layout) {
   return graph_storage_plan_for(
       MemoryUtils::plan_for<Header>(),
       include_compound_storage ? &MemoryUtils::plan_for<CompoundStorage>()
                                : nullptr,
-      nodes);
+      nodes, layout);
 }
 
 [[nodiscard]] GraphRuntimeContext
@@ -285,6 +725,7 @@ graph_runtime_context_for(const MemoryUtils::StoragePlan &plan,
       plan.find_component(graph_compound_scalar_storage_field_name);
   const auto &node_storage = plan.component(graph_nodes_field_name);
   const auto &schedule = plan.component(graph_schedule_field_name);
+  const auto *hot_nodes = plan.find_component(graph_hot_nodes_field_name);
   if (!node_storage.plan->is_tuple() ||
       node_storage.plan->component_count() != node_builders.size()) {
     throw std::logic_error(
@@ -304,6 +745,10 @@ graph_runtime_context_for(const MemoryUtils::StoragePlan &plan,
                                       : invalid_cursor,
       .schedule_offset = schedule.offset,
       .schedule_stride = schedule.plan->array_stride(),
+      .hot_nodes_offset =
+          hot_nodes != nullptr ? hot_nodes->offset : invalid_cursor,
+      .hot_nodes_stride =
+          hot_nodes != nullptr ? hot_nodes->plan->array_stride() : 0,
   };
   context.node_locations.reserve(node_builders.size());
   for (std::size_t index = 0; index < node_builders.size(); ++index) {
@@ -367,8 +812,18 @@ template <typename Storage>
   return MemoryUtils::advance(memory, context.node_locations[index].offset);
 }
 
+[[nodiscard]] NodePtr &graph_hot_node(const GraphRuntimeContext &context,
+                                      void *memory, std::size_t index) {
+  return *MemoryUtils::cast<NodePtr>(MemoryUtils::advance(
+      memory, context.layout.hot_nodes_offset +
+                  index * context.layout.hot_nodes_stride));
+}
+
 [[nodiscard]] NodeView graph_node_view(const GraphRuntimeContext &context,
                                        void *memory, std::size_t index) {
+  if (context.layout.hot_nodes_offset != invalid_cursor) {
+    return NodeView{graph_hot_node(context, memory, index)};
+  }
   const auto &location = context.node_locations[index];
   return NodeView{location.type, MemoryUtils::advance(memory, location.offset)};
 }
@@ -589,6 +1044,14 @@ void construct_graph_storage(GraphTypeRef type, const GraphBuilder &builder,
       std::construct_at(&graph_schedule(context, memory, index), MIN_DT);
       ++constructed_schedule;
     }
+    if (context.layout.hot_nodes_offset != invalid_cursor) {
+      for (std::size_t index = 0; index < context.layout.node_count; ++index) {
+        const auto &location = context.node_locations[index];
+        std::construct_at(
+            &graph_hot_node(context, memory, index),
+            location.type.writable(MemoryUtils::advance(memory, location.offset)));
+      }
+    }
   };
   if (compound_storage.available()) {
     CompoundScalarStorageScope storage_scope{compound_storage};
@@ -783,12 +1246,63 @@ void schedule_node_impl(const void *context, const GraphView &graph,
   auto &scheduled = graph_schedule(runtime, graph.data(), node_index);
   if (scheduled <= current || when < scheduled) {
     scheduled = when;
+    if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+      // Future schedules go to the wheel; the active set is the current
+      // cycle only.
+      if (state.timing_wheel && when > current) {
+        state.timing_wheel->insert(node_index, when);
+      } else if (state.active_set.enabled()) {
+        state.active_set.mark(node_index);
+      }
+    } else if (state.active_set.enabled()) {
+      state.active_set.mark(node_index);
+    }
     if (when > current && when < state.next_scheduled_time) {
       state.next_scheduled_time = when;
     }
   }
 }
 
+void root_restore_node_schedule_impl(const void *context,
+                                     const GraphView &graph,
+                                     std::size_t node_index, DateTime when) {
+  const auto &runtime = graph_context(context);
+  auto &state = graph_header<RootGraphRuntimeStorage>(runtime, graph.data());
+  if (node_index >= runtime.layout.node_count) {
+    throw std::out_of_range("Graph schedule node index is out of range");
+  }
+  if (state.evaluating) {
+    throw std::logic_error("Graph cannot restore a node schedule while evaluating");
+  }
+
+  const DateTime current = state.evaluation_time;
+  if (when != MIN_DT && when < current) {
+    throw std::runtime_error("Graph cannot schedule a node in the past");
+  }
+
+  // Overwrite unconditionally: a wheel or active-set entry left behind for
+  // the old time is stale and skipped, since both validate against the
+  // per-node entry.
+  graph_schedule(runtime, graph.data(), node_index) = when;
+  if (when != MIN_DT) {
+    if (state.timing_wheel && when > current) {
+      state.timing_wheel->insert(node_index, when);
+    } else if (state.active_set.enabled()) {
+      state.active_set.mark(node_index);
+    }
+  }
+
+  // Moving an entry later may raise the next cycle, so rebuild the cache the
+  // way start does rather than folding in the new time.
+  state.next_scheduled_time = MAX_DT;
+  for (std::size_t index = 0; index < runtime.layout.node_count; ++index) {
+    const DateTime scheduled = graph_schedule(runtime, graph.data(), index);
+    if (scheduled >= current && scheduled < state.next_scheduled_time) {
+      state.next_scheduled_time = scheduled;
+    }
+  }
+}
+
 // The **push** half of nested scheduling delegation (the RFC clock
 // invariant, executor-ops style): any schedule recorded on a child graph
 // immediately wakes the parent node no later than that time. The **pull**
@@ -830,6 +1344,48 @@ void nested_schedule_node_impl(const void *context, const GraphView &graph,
   parent.graph().schedule_node(parent.node_index(), when);
 }
 
+// A keyed parent restores a child's checkpoint right after starting it (see
+// MapNodeView::stage_child_restore). The entry is overwritten as for the
+// root; a kept entry then wakes the parent like an out-of-band schedule.
+void nested_restore_node_schedule_impl(const void *context,
+                                       const GraphView &graph,
+                                       std::size_t node_index, DateTime when) {
+  const auto &runtime = graph_context(context);
+  auto &state = graph_header<NestedGraphRuntimeStorage>(runtime, graph.data());
+  if (node_index >= runtime.layout.node_count) {
+    throw std::out_of_range("Graph schedule node index is out of range");
+  }
+  if (state.evaluating) {
+    throw std::logic_error("Graph cannot restore a node schedule while evaluating");
+  }
+
+  const DateTime current = state.evaluation_time;
+  if (when != MIN_DT && when < current) {
+    throw std::runtime_error("Graph cannot schedule a node in the past");
+  }
+
+  graph_schedule(runtime, graph.data(), node_index) = when;
+  if (when != MIN_DT && state.active_set.enabled()) {
+    state.active_set.mark(node_index);
+  }
+  state.next_scheduled_time = MAX_DT;
+  for (std::size_t index = 0; index < runtime.layout.node_count; ++index) {
+    const DateTime scheduled = graph_schedule(runtime, graph.data(), index);
+    if (scheduled >= current && scheduled < state.next_scheduled_time) {
+      state.next_scheduled_time = scheduled;
+    }
+  }
+
+  if (when == MIN_DT || !state.started) {
+    return;
+  }
+  if (state.child_schedule_observer != nullptr) {
+    state.child_schedule_observer(state.child_schedule_observer_context, when);
+  }
+  auto parent = state.parent_node();
+  parent.graph().schedule_node(parent.node_index(), when);
+}
+
 void nested_set_child_schedule_observer_impl(const void *context, void *memory,
                                              void (*observer)(void *, DateTime),
                                              void *observer_context) {
@@ -1014,12 +1570,24 @@ spdlog::logger *logger_impl(const void *context, const void *memory) noexcept {
   return graph_header<Storage>(runtime, memory).logger;
 }
 
+template <typename Storage>
+const MemoryUtils::AllocatorOps *allocator_impl(const void *context,
+                                                const void *memory) noexcept {
+  return graph_header<Storage>(graph_context(context), memory).allocator;
+}
+
 template <typename Storage>
 const TypeRealizationSnapshot *
 type_realization_impl(const void *context, const void *memory) noexcept {
   return graph_header<Storage>(graph_context(context), memory).type_realization;
 }
 
+template <typename Storage>
+GraphSchedulingMode scheduling_mode_impl(const void *context,
+                                         const void *memory) noexcept {
+  return graph_header<Storage>(graph_context(context), memory).scheduling_mode;
+}
+
 template <typename Storage>
 CompoundScalarStorageView
 compound_scalar_storage_impl(const void *context, const void *memory) noexcept {
@@ -1037,6 +1605,96 @@ compound_scalar_storage_impl(const void *context, const void *memory) noexcept {
   }
 }
 
+// One ``LevelParallel`` cycle of the root. Levels run in order; within a
+// level the due nodes are independent, so pinned nodes run on the engine
+// thread and the rest fan out on the evaluation pool. Failures are rethrown
+// after the join in rank order, annotated exactly like the serial path.
+// Returns false when a node requested a pause, with the cursor on that node.
+template <typename EvaluateCursorNode>
+bool evaluate_levels(const GraphRuntimeContext &runtime, const GraphView &graph,
+                     RootGraphRuntimeStorage &state, DateTime evaluation_time,
+                     EvaluateCursorNode &evaluate_cursor_node) {
+  auto &levels = *state.level_schedule;
+  const bool concurrent = state.lifecycle_observers->empty() &&
+                          !graph.compound_scalar_storage().available();
+  for (std::size_t level = 0; level + 1 < levels.level_begin.size(); ++level) {
+    levels.due.clear();
+    levels.engine_due.clear();
+    for (std::size_t position = levels.level_begin[level];
+         position < levels.level_begin[level + 1]; ++position) {
+      const std::size_t index = levels.nodes[position];
+      const auto &scheduled = graph_schedule(runtime, graph.data(), index);
+      if (scheduled == evaluation_time) {
+        (concurrent && levels.pinned[index] == 0 ? levels.due
+                                                 : levels.engine_due)
+            .push_back(index);
+      } else if (scheduled > evaluation_time &&
+                 scheduled < state.next_scheduled_time) {
+        state.next_scheduled_time = scheduled;
+      }
+    }
+    if (levels.due.size() == 1) {
+      levels.engine_due.push_back(levels.due.front());
+      levels.due.clear();
+    }
+
+    for (const std::size_t index : levels.engine_due) {
+      state.evaluation_cursor = index;
+      if (!evaluate_cursor_node()) {
+        return false;
+      }
+    }
+    if (levels.due.empty()) {
+      continue;
+    }
+
+    levels.errors.assign(levels.due.size(), nullptr);
+    levels.paused.assign(levels.due.size(), 0U);
+    const auto *realization = state.type_realization;
+    // Workers allocate exactly as the engine thread would.
+    const auto &allocator = MemoryUtils::allocator();
+    auto evaluate_node = [&](std::size_t slot) noexcept {
+      TypeRealizationScope realization_scope{realization};
+      MemoryUtils::AllocatorScope allocator_scope{allocator};
+      ConcurrentScheduleScope schedule_scope{levels.schedule_mutex};
+      try {
+        if (!graph_node_view(runtime, graph.data(), levels.due[slot])
+                 .evaluate(evaluation_time)) {
+          levels.paused[slot] = 1U;
+        }
+      } catch (...) {
+        levels.errors[slot] = std::current_exception();
+      }
+    };
+    runtime_detail::ChildEvaluationPool::instance().run(levels.due.size(),
+                                                        evaluate_node);
+
+    for (std::size_t slot = 0; slot < levels.due.size(); ++slot) {
+      if (!levels.errors[slot]) {
+        continue;
+      }
+      const std::size_t index = levels.due[slot];
+      const std::exception_ptr error = levels.errors[slot];
+      levels.errors.clear();
+      state.evaluation_cursor = index;
+      state.evaluation_failed = true;
+      NodeView node_view = graph_node_view(runtime, graph.data(), index);
+      annotate_on_exception([&] { std::rethrow_exception(error); },
+                            [&] {
+                              rethrow_with_node_identity(node_view, index,
+                                                         "evaluate");
+                            });
+    }
+    for (std::size_t slot = 0; slot < levels.due.size(); ++slot) {
+      if (levels.paused[slot] != 0U) {
+        state.evaluation_cursor = levels.due[slot];
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 template <typename Storage>
 bool evaluate_impl(const void *context, const GraphView &graph,
                    DateTime evaluation_time) {
@@ -1077,11 +1735,27 @@ bool evaluate_impl(const void *context, const GraphView &graph,
     first_normal_node = graph.schema()->push_source_nodes_end;
   }
 
+  GraphTimingWheel *timing_wheel = nullptr;
+  if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+    timing_wheel = state.timing_wheel.get();
+  }
+
   if (!resuming) {
     state.lifecycle_observers->notify_before_graph_evaluation(graph);
     state.cycle_wall_start = current_wall_time();
     state.next_scheduled_time = MAX_DT;
 
+    if (timing_wheel != nullptr) {
+      // Move this cycle's live wheel entries into the active set.
+      timing_wheel->advance(evaluation_time, [&](std::size_t index,
+                                                 DateTime when) {
+        if (when == evaluation_time &&
+            graph_schedule(runtime, graph.data(), index) == when) {
+          state.active_set.mark(index);
+        }
+      });
+    }
+
     if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
       if (first_normal_node > 0) {
         PushQueueEngineView push_queue =
@@ -1115,6 +1789,9 @@ bool evaluate_impl(const void *context, const GraphView &graph,
               scheduled < state.next_scheduled_time) {
             state.next_scheduled_time = scheduled;
           }
+          if (state.active_set.enabled() && scheduled <= evaluation_time) {
+            state.active_set.clear(index);
+          }
         }
         if (push_phase_evaluated) {
           state.lifecycle_observers->notify_after_graph_push_nodes_evaluation(
@@ -1125,49 +1802,101 @@ bool evaluate_impl(const void *context, const GraphView &graph,
     state.evaluation_cursor = first_normal_node;
   }
 
-  for (; state.evaluation_cursor < runtime.layout.node_count;
-       ++state.evaluation_cursor) {
-    auto &scheduled =
-        graph_schedule(runtime, graph.data(), state.evaluation_cursor);
-    if (scheduled == evaluation_time) {
-      // post-eval MIN_DT stamp removed (see lazy-cleanup invariant)
-      bool completed = true;
-      NodeView node_view =
-          graph_node_view(runtime, graph.data(), state.evaluation_cursor);
-      state.lifecycle_observers->notify_before_node_evaluation(node_view);
-      // Best-effort: the node did run once, so a matching "after" fires
-      // regardless of a pause or a thrown exception (unlike the graph-level
-      // notification above, which is about the whole CYCLE completing).
-      auto node_after_notify = make_scope_exit<true>([&] {
-        state.lifecycle_observers->notify_after_node_evaluation(node_view);
-      });
-      if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
-        completed = annotate_on_exception(
-            [&] { return node_view.evaluate(state.evaluation_time); },
-            [&] {
-              state.evaluation_failed = true;
-              rethrow_with_node_identity(node_view, state.evaluation_cursor,
-                                         "evaluate");
-            });
-      } else {
-        completed = annotate_on_exception(
-            [&] { return node_view.evaluate(state.evaluation_time); },
-            [&] { state.evaluation_failed = true; });
+  // Evaluates the node under the cursor; false when it requested a pause.
+  const auto evaluate_cursor_node = [&]() -> bool {
+    // post-eval MIN_DT stamp removed (see lazy-cleanup invariant)
+    NodeView node_view =
+        graph_node_view(runtime, graph.data(), state.evaluation_cursor);
+    state.lifecycle_observers->notify_before_node_evaluation(node_view);
+    // Best-effort: the node did run once, so a matching "after" fires
+    // regardless of a pause or a thrown exception (unlike the graph-level
+    // notification above, which is about the whole CYCLE completing).
+    auto node_after_notify = make_scope_exit<true>([&] {
+      state.lifecycle_observers->notify_after_node_evaluation(node_view);
+    });
+    if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+      return annotate_on_exception(
+          [&] { return node_view.evaluate(state.evaluation_time); },
+          [&] {
+            state.evaluation_failed = true;
+            rethrow_with_node_identity(node_view, state.evaluation_cursor,
+                                       "evaluate");
+          });
+    } else {
+      return annotate_on_exception(
+          [&] { return node_view.evaluate(state.evaluation_time); },
+          [&] { state.evaluation_failed = true; });
+    }
+  };
+
+  if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+    if (state.level_schedule) {
+      if (!evaluate_levels(runtime, graph, state, evaluation_time,
+                           evaluate_cursor_node)) {
+        // As on the serial path: the root has no resolver, so the executor
+        // reports the escaped pause.
+        return false;
       }
-      if (!completed) {
+      state.evaluation_cursor = 0;
+      return true;
+    }
+  }
+
+  if (state.active_set.enabled()) {
+    // Visit only nodes holding a schedule entry, still in rank order. The
+    // set is re-probed after every node, so same-cycle schedules of later
+    // nodes are picked up exactly as the full scan would. A paused node
+    // keeps its membership and the cursor, so resume re-visits it.
+    for (std::size_t index = state.active_set.next(state.evaluation_cursor);
+         index != invalid_cursor; index = state.active_set.next(index + 1)) {
+      state.evaluation_cursor = index;
+      const auto &scheduled = graph_schedule(runtime, graph.data(), index);
+      if (scheduled == evaluation_time && !evaluate_cursor_node()) {
         // Pause requested: hold the cursor on this node and propagate upward
         // (the enclosing mesh node resolves the dependency and resumes us).
         return false;
       }
-    } else if (scheduled > evaluation_time) {
-      if (scheduled < state.next_scheduled_time) {
-        state.next_scheduled_time = scheduled;
+      // A future entry (including one the node just set for itself) stays a
+      // member; its time was folded into next_scheduled_time by
+      // schedule_node. Consumed and stale entries leave the set. With a
+      // timing wheel the future entry lives in the wheel instead.
+      if (scheduled > evaluation_time && timing_wheel == nullptr) {
+        if (scheduled < state.next_scheduled_time) {
+          state.next_scheduled_time = scheduled;
+        }
+      } else {
+        state.active_set.clear(index);
+      }
+    }
+  } else {
+    for (; state.evaluation_cursor < runtime.layout.node_count;
+         ++state.evaluation_cursor) {
+      const auto &scheduled =
+          graph_schedule(runtime, graph.data(), state.evaluation_cursor);
+      if (scheduled == evaluation_time) {
+        if (!evaluate_cursor_node()) {
+          // Pause requested: hold the cursor on this node and propagate
+          // upward (the enclosing mesh node resolves the dependency and
+          // resumes us).
+          return false;
+        }
+      } else if (scheduled > evaluation_time) {
+        if (scheduled < state.next_scheduled_time) {
+          state.next_scheduled_time = scheduled;
+        }
       }
     }
   }
 
   state.evaluation_cursor = 0; // completed: reset the cursor
 
+  if (timing_wheel != nullptr) {
+    state.next_scheduled_time =
+        timing_wheel->next_time([&](std::size_t index, DateTime when) {
+          return graph_schedule(runtime, graph.data(), index) == when;
+        });
+  }
+
   if constexpr (std::is_same_v<Storage, NestedGraphRuntimeStorage>) {
     propagate_nested_parent_schedule(
         graph_header<NestedGraphRuntimeStorage>(runtime, graph.data()));
@@ -1222,6 +1951,8 @@ struct GraphRuntimeRegistry {
 
   [[nodiscard]] static std::size_t hash_builder(const GraphBuilder &builder) {
     std::size_t result = std::hash<std::string_view>{}(builder.label());
+    result = combine_hash(result,
+                          static_cast<std::size_t>(builder.node_layout()));
     result = combine_hash(
         result, builder.type_realization()->pooled_compound_storage_enabled());
     for (const NodeBuilder &node : builder.nodes()) {
@@ -1258,7 +1989,9 @@ struct GraphRuntimeRegistry {
         entry.schema.push_source_nodes_end !=
             compute_push_source_nodes_end(builder) ||
         graph_has_compound_scalar_storage(entry.root_context) !=
-            pooled_storage) {
+            pooled_storage ||
+        (entry.root_context.layout.hot_nodes_offset != invalid_cursor) !=
+            (builder.node_layout() == GraphNodeLayout::HotCold)) {
       return false;
     }
     for (std::size_t index = 0; index < builder.nodes().size(); ++index) {
@@ -1319,8 +2052,8 @@ struct GraphRuntimeRegistry {
         builder.type_realization()->pooled_compound_storage_enabled();
     const auto &root_plan =
         graph_storage_plan_for<RootGraphRuntimeStorage,
-                               CompoundScalarStorage>(builder.nodes(),
-                                                      pooled_storage);
+                               CompoundScalarStorage>(
+            builder.nodes(), pooled_storage, builder.node_layout());
     entry.root_context = graph_runtime_context_for(root_plan, builder.nodes());
     entry.root_ops = make_root_ops(&entry.root_context, pooled_storage);
     entry.root_type = intern_graph_type(entry.schema, root_plan, entry.root_ops,
@@ -1329,8 +2062,8 @@ struct GraphRuntimeRegistry {
     if (entry.schema.push_source_nodes_end == 0) {
       const auto &nested_plan =
           graph_storage_plan_for<NestedGraphRuntimeStorage,
-                                 CompoundScalarStorageView>(builder.nodes(),
-                                                            pooled_storage);
+                                 CompoundScalarStorageView>(
+              builder.nodes(), pooled_storage, builder.node_layout());
       entry.nested_context =
           graph_runtime_context_for(nested_plan, builder.nodes());
       entry.nested_ops = make_nested_ops(&entry.nested_context, pooled_storage);
@@ -1357,6 +2090,7 @@ struct GraphRuntimeRegistry {
             pooled_storage ? &pooled_evaluate_impl<RootGraphRuntimeStorage>
                            : &evaluate_impl<RootGraphRuntimeStorage>,
         .schedule_node_impl = &schedule_node_impl<RootGraphRuntimeStorage>,
+        .restore_node_schedule_impl = &root_restore_node_schedule_impl,
         .started_impl = &started_impl<RootGraphRuntimeStorage>,
         .evaluating_impl = &evaluating_impl<RootGraphRuntimeStorage>,
         .evaluation_time_impl = &evaluation_time_impl<RootGraphRuntimeStorage>,
@@ -1381,6 +2115,9 @@ struct GraphRuntimeRegistry {
                 ? &compound_scalar_storage_impl<RootGraphRuntimeStorage>
                 : nullptr,
         .logger_impl = &logger_impl<RootGraphRuntimeStorage>,
+        .scheduling_mode_impl =
+            &scheduling_mode_impl<RootGraphRuntimeStorage>,
+        .allocator_impl = &allocator_impl<RootGraphRuntimeStorage>,
     };
   }
 
@@ -1400,6 +2137,7 @@ struct GraphRuntimeRegistry {
             pooled_storage ? &pooled_evaluate_impl<NestedGraphRuntimeStorage>
                            : &evaluate_impl<NestedGraphRuntimeStorage>,
         .schedule_node_impl = &nested_schedule_node_impl,
+        .restore_node_schedule_impl = &nested_restore_node_schedule_impl,
         .started_impl = &started_impl<NestedGraphRuntimeStorage>,
         .evaluating_impl = &evaluating_impl<NestedGraphRuntimeStorage>,
         .evaluation_time_impl =
@@ -1427,6 +2165,9 @@ struct GraphRuntimeRegistry {
                 ? &compound_scalar_storage_impl<NestedGraphRuntimeStorage>
                 : nullptr,
         .logger_impl = &logger_impl<NestedGraphRuntimeStorage>,
+        .scheduling_mode_impl =
+            &scheduling_mode_impl<NestedGraphRuntimeStorage>,
+        .allocator_impl = &allocator_impl<NestedGraphRuntimeStorage>,
     };
   }
 
@@ -1734,6 +2475,17 @@ spdlog::logger *GraphView::logger() const noexcept {
                                       : nullptr;
 }
 
+const MemoryUtils::AllocatorOps &GraphView::allocator() const noexcept {
+  if (!valid()) {
+    return MemoryUtils::default_allocator();
+  }
+  const auto &table = ops();
+  const auto *allocator = table.allocator_impl != nullptr
+                              ? table.allocator_impl(table.context, data())
+                              : nullptr;
+  return allocator != nullptr ? *allocator : MemoryUtils::default_allocator();
+}
+
 const TypeRealizationSnapshot *GraphView::type_realization() const noexcept {
   if (!valid()) {
     return nullptr;
@@ -1754,6 +2506,11 @@ CompoundScalarStorageView GraphView::compound_scalar_storage() const noexcept {
              : CompoundScalarStorageView{};
 }
 
+GraphSchedulingMode GraphView::scheduling_mode() const noexcept {
+  return valid() ? ops().scheduling_mode_impl(ops().context, data())
+                 : GraphSchedulingMode::Scan;
+}
+
 void GraphView::start(DateTime start_time) const {
   TypeRealizationScope scope{type_realization()};
   ops().start_impl(ops().context, *this, start_time);
@@ -1771,9 +2528,22 @@ bool GraphView::evaluate(DateTime evaluation_time) const {
   return ops().evaluate_impl(ops().context, *this, evaluation_time);
 }
 void GraphView::schedule_node(std::size_t node_index, DateTime when) const {
+  if (concurrent_schedule_mutex != nullptr) {
+    std::lock_guard lock{*concurrent_schedule_mutex};
+    ops().schedule_node_impl(ops().context, *this, node_index, when);
+    return;
+  }
   ops().schedule_node_impl(ops().context, *this, node_index, when);
 }
 
+void GraphView::restore_node_schedule(std::size_t node_index,
+                                      DateTime when) const {
+  if (ops().restore_node_schedule_impl == nullptr) {
+    throw std::logic_error("restore_node_schedule is not supported by this graph");
+  }
+  ops().restore_node_schedule_impl(ops().context, *this, node_index, when);
+}
+
 void GraphView::set_child_schedule_observer(void (*observer)(void *, DateTime),
                                             void *observer_context) const {
   if (ops().set_child_schedule_observer_impl == nullptr) {
@@ -1844,7 +2614,16 @@ GraphValue::GraphValue(const GraphBuilder &builder, ExecutorPtr root_executor) {
           state.lifecycle_observers =
               &GraphExecutorView{root_executor}.lifecycle_observers();
           state.logger = GraphExecutorView{root_executor}.logger();
+          state.allocator = &MemoryUtils::allocator();
           state.type_realization = snapshot.get();
+          state.select_scheduling_mode(builder.scheduling_mode_,
+                                       builder.node_count());
+          if (builder.scheduling_mode_ == GraphSchedulingMode::LevelParallel) {
+            state.level_schedule = make_level_schedule(builder);
+          }
+          if (builder.scheduling_mode_ == GraphSchedulingMode::TimingWheel) {
+            state.timing_wheel = std::make_unique<GraphTimingWheel>(MIN_DT);
+          }
         });
   });
   pointer_ = type.writable(storage_.data());
@@ -1869,6 +2648,9 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node) {
       active_snapshot != nullptr ? active_snapshot : snapshot.get();
   TypeRealizationScope realization_scope{effective_snapshot};
   GraphValueRealizationScope graph_value_scope{};
+  // Children allocate from the run's allocator, wherever they are built.
+  const auto &allocator = NodeView{parent_node}.graph().allocator();
+  MemoryUtils::AllocatorScope allocator_scope{allocator};
   const auto shared_storage =
       NodeView{parent_node}.graph().compound_scalar_storage();
   const auto type = builder.nested_type();
@@ -1884,7 +2666,12 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node) {
           state.lifecycle_observers =
               &NodeView{parent_node}.graph().lifecycle_observers();
           state.logger = NodeView{parent_node}.graph().logger();
+          state.allocator = &allocator;
           state.type_realization = effective_snapshot;
+          state.select_scheduling_mode(
+              nested_scheduling_mode(
+                  NodeView{parent_node}.graph().scheduling_mode()),
+              builder.node_count());
         },
         shared_storage);
   });
@@ -1911,6 +2698,9 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node,
       active_snapshot != nullptr ? active_snapshot : snapshot.get();
   TypeRealizationScope realization_scope{effective_snapshot};
   GraphValueRealizationScope graph_value_scope{};
+  // Children allocate from the run's allocator, wherever they are built.
+  const auto &allocator = NodeView{parent_node}.graph().allocator();
+  MemoryUtils::AllocatorScope allocator_scope{allocator};
   const auto shared_storage =
       NodeView{parent_node}.graph().compound_scalar_storage();
   const auto type = builder.nested_type();
@@ -1936,7 +2726,12 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node,
         state.lifecycle_observers =
             &NodeView{parent_node}.graph().lifecycle_observers();
         state.logger = NodeView{parent_node}.graph().logger();
+        state.allocator = &allocator;
         state.type_realization = effective_snapshot;
+        state.select_scheduling_mode(
+            nested_scheduling_mode(
+                NodeView{parent_node}.graph().scheduling_mode()),
+            builder.node_count());
       },
       shared_storage);
   auto rollback =
@@ -2100,6 +2895,27 @@ GraphBuilder &GraphBuilder::trait(std::string_view name, Value &&value) {
 
 GlobalStateView GraphBuilder::traits() noexcept { return traits_.view(); }
 
+GraphBuilder &GraphBuilder::scheduling_mode(GraphSchedulingMode mode) noexcept {
+  scheduling_mode_ = mode;
+  return *this;
+}
+
+GraphSchedulingMode GraphBuilder::scheduling_mode() const noexcept {
+  return scheduling_mode_;
+}
+
+GraphBuilder &GraphBuilder::node_layout(GraphNodeLayout layout) noexcept {
+  if (node_layout_ != layout) {
+    node_layout_ = layout;
+    invalidate_types();
+  }
+  return *this;
+}
+
+GraphNodeLayout GraphBuilder::node_layout() const noexcept {
+  return node_layout_;
+}
+
 GraphBuilder &GraphBuilder::global_state(GlobalState state) {
   global_state_ = std::move(state);
   invalidate_types();
@@ -2196,6 +3012,91 @@ GraphValue GraphBuilder::make_nested_graph(
   return GraphValue{*this, parent_node, external_memory, available_layout};
 }
 
+void GraphBuilder::reset_nested_graph(GraphValue &graph) const {
+  const auto type = nested_type();
+  if (!graph.has_value() || &graph.type().ops_ref() != &type.ops_ref() ||
+      !graph.uses_external_storage()) {
+    throw std::logic_error(
+        "reset_nested_graph requires an in-place nested graph of this builder");
+  }
+  if (graph.view().started()) {
+    throw std::logic_error("reset_nested_graph requires a stopped graph");
+  }
+
+  const auto &context = graph_context(type.ops_ref().context);
+  void *memory = const_cast<void *>(graph.pointer_.data());
+  auto &state = graph_header<NestedGraphRuntimeStorage>(context, memory);
+  const auto *active_snapshot = active_type_realization();
+  TypeRealizationScope realization_scope{
+      active_snapshot != nullptr ? active_snapshot : state.type_realization};
+  GraphValueRealizationScope graph_value_scope{};
+  MemoryUtils::AllocatorScope allocator_scope{*state.allocator};
+  const auto shared_storage = graph.view().compound_scalar_storage();
+
+  // A node that fails to rebuild leaves no way back to a whole graph:
+  // destroy what remains and release the handle (the slot memory stays
+  // with its owner), so the caller falls back to a fresh build.
+  std::size_t constructed_nodes = context.layout.node_count;
+  auto rollback = make_scope_exit([&]() noexcept {
+    const auto destroy = [&] {
+      destroy_constructed_graph_parts<NestedGraphRuntimeStorage>(
+          context, memory, false, true,
+          graph_has_compound_scalar_storage(context), constructed_nodes,
+          context.layout.node_count, type.checked_plan());
+    };
+    if (shared_storage.available()) {
+      CompoundScalarStorageScope storage_scope{shared_storage};
+      destroy();
+    } else {
+      destroy();
+    }
+    graph.pointer_ = {};
+  });
+
+  const auto rebuild_nodes = [&] {
+    for (std::size_t index = context.layout.node_count; index > 0; --index) {
+      const auto &location = context.node_locations[index - 1];
+      location.type.destroy_at(MemoryUtils::advance(memory, location.offset));
+      --constructed_nodes;
+    }
+    for (std::size_t index = 0; index < context.layout.node_count; ++index) {
+      nodes_[index].construct_node_storage(
+          graph_node_memory(context, memory, index), index);
+      ++constructed_nodes;
+    }
+  };
+  if (shared_storage.available()) {
+    CompoundScalarStorageScope storage_scope{shared_storage};
+    rebuild_nodes();
+  } else {
+    rebuild_nodes();
+  }
+
+  // Node addresses are unchanged, so the hot-node table stays valid; the
+  // header keeps its traits, parent, observers and scheduling structures.
+  for (std::size_t index = 0; index < context.layout.node_count; ++index) {
+    graph_schedule(context, memory, index) = MIN_DT;
+  }
+  state.next_scheduled_time = MAX_DT;
+  state.evaluation_time = MIN_DT;
+  state.evaluation_cursor = invalid_cursor;
+  state.evaluating = false;
+  state.evaluation_failed = false;
+  if (state.active_set.enabled()) {
+    state.active_set.reset(context.layout.node_count);
+  }
+  state.child_schedule_observer = nullptr;
+  state.child_schedule_observer_context = nullptr;
+  bind_edges(context, memory, edges_);
+  if (shared_storage.available()) {
+    CompoundScalarStorageScope storage_scope{shared_storage};
+    graph.attach_nodes();
+  } else {
+    graph.attach_nodes();
+  }
+  rollback.release();
+}
+
 void clear_graph_runtime_types() noexcept {
   clear_debug_descriptors(TypeFamily::Graph);
   graph_runtime_registry().clear();
@@ -0,0 +1,862 @@
+#include <hgraph/runtime/graph_checkpoint.h>
+
+#include <hgraph/runtime/graph.h>
+#include <hgraph/runtime/map_node.h>
+#include <hgraph/runtime/node.h>
+#include <hgraph/runtime/node_scheduler.h>
+#include <hgraph/types/metadata/type_registry.h>
+#include <hgraph/types/metadata/value_plan_factory.h>
+#include <hgraph/types/static_schema.h>
+#include <hgraph/types/time_series/ts_data/base_view.h>
+#include <hgraph/types/time_series/ts_output/base_view.h>
+#include <hgraph/types/value/json_codec.h>
+#include <hgraph/types/value/value_builder.h>
+#include <hgraph/util/scope.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hgraph
+{
+    namespace
+    {
+        constexpr std::uint32_t checkpoint_magic   = 0x4B434748;  // "HGCK"
+        constexpr std::uint32_t checkpoint_version = 2;
+
+        enum NodeRecordFlags : std::uint8_t
+        {
+            node_skipped          = 1U << 0U,
+            node_output           = 1U << 1U,
+            node_recordable_state = 1U << 2U,
+            node_state            = 1U << 3U,
+            node_scheduler        = 1U << 4U,
+            node_children         = 1U << 5U,
+        };
+
+        /**
+         * Interned per-schema value codec, following the ``JsonConverter``
+         * serializer-ops pattern. Fixed-width atomics copy their bytes,
+         * strings are length-prefixed and tuples, bundles, dynamic lists,
+         * sets and maps recurse into their element codecs. Opaque atomics use
+         * their registered ``checkpoint_state``; every other schema stores
+         * its JSON form.
+         */
+        struct CheckpointCodec
+        {
+            using WriteFn = void (*)(const CheckpointCodec &, const ValueView &, CheckpointWriter &);
+            using ReadFn  = Value (*)(const CheckpointCodec &, CheckpointReader &);
+
+            void  write(const ValueView &view, CheckpointWriter &out) const { write_(*this, view, out); }
+            Value read(CheckpointReader &in) const { return read_(*this, in); }
+
+            WriteFn                              write_{nullptr};
+            ReadFn                               read_{nullptr};
+            const ValueTypeMetaData             *meta{nullptr};
+            ValueTypeRef                         binding{nullptr};
+            const JsonConverter                 *json{nullptr};
+            CheckpointStateWriteFn               state_write{nullptr};
+            CheckpointStateReadFn                state_read{nullptr};
+            std::vector<const CheckpointCodec *> children{};
+        };
+
+        template <typename T>
+        void write_raw(const CheckpointCodec &, const ValueView &view, CheckpointWriter &out)
+        {
+            out.pod(view.checked_as<T>());
+        }
+
+        template <typename T>
+        Value read_raw(const CheckpointCodec &, CheckpointReader &in)
+        {
+            return Value{in.pod<T>()};
+        }
+
+        void write_str(const CheckpointCodec &, const ValueView &view, CheckpointWriter &out)
+        {
+            out.text(view.checked_as<Str>());
+        }
+
+        Value read_str(const CheckpointCodec &, CheckpointReader &in) { return Value{Str{in.text()}}; }
+
+        void write_state(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            codec.state_write(view, out);
+        }
+
+        Value read_state(const CheckpointCodec &codec, CheckpointReader &in) { return codec.state_read(in); }
+
+        void write_json(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            std::string text;
+            codec.json->write(view, text);
+            out.text(text);
+        }
+
+        Value read_json(const CheckpointCodec &codec, CheckpointReader &in)
+        {
+            return from_json_string(*codec.json, in.text());
+        }
+
+        // Fields carry a presence byte: bundle fields may be unset.
+        void write_composite(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            const auto concrete = view.concrete();
+            if (concrete.schema() != codec.meta)
+            {
+                throw std::logic_error(fmt::format("graph checkpoint: polymorphic '{}' value holds '{}'",
+                                                   codec.meta->name(), concrete.schema()->name()));
+            }
+            const auto indexed = concrete.as_indexed_view();
+            for (std::size_t index = 0; index < codec.children.size(); ++index)
+            {
+                const auto field = indexed.at(index);
+                out.pod(static_cast<std::uint8_t>(field.has_value()));
+                if (field.has_value()) { codec.children[index]->write(field, out); }
+            }
+        }
+
+        Value read_composite(const CheckpointCodec &codec, CheckpointReader &in)
+        {
+            BundleBuilder builder{codec.binding};
+            for (std::size_t index = 0; index < codec.children.size(); ++index)
+            {
+                if (in.pod<std::uint8_t>() != 0) { builder.set(index, codec.children[index]->read(in)); }
+            }
+            return builder.build();
+        }
+
+        void write_list(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            const auto list = view.as_list();
+            out.pod(static_cast<std::uint64_t>(list.size()));
+            for (std::size_t index = 0; index < list.size(); ++index)
+            {
+                const auto element = list.at(index);
+                out.pod(static_cast<std::uint8_t>(element.has_value()));
+                if (element.has_value()) { codec.children[0]->write(element, out); }
+            }
+        }
+
+        Value read_list(const CheckpointCodec &codec, CheckpointReader &in)
+        {
+            ListBuilder builder{codec.children[0]->binding};
+            for (auto count = in.pod<std::uint64_t>(); count > 0; --count)
+            {
+                if (in.pod<std::uint8_t>() == 0)
+                {
+                    builder.push_back_unset();
+                    continue;
+                }
+                const Value element = codec.children[0]->read(in);
+                builder.push_back_copy(element.view().data());
+            }
+            return builder.build();
+        }
+
+        void write_set(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            const auto set = view.as_set();
+            out.pod(static_cast<std::uint64_t>(set.size()));
+            for (const auto element : set) { codec.children[0]->write(element, out); }
+        }
+
+        Value read_set(const CheckpointCodec &codec, CheckpointReader &in)
+        {
+            SetBuilder builder{codec.children[0]->binding};
+            for (auto count = in.pod<std::uint64_t>(); count > 0; --count)
+            {
+                const Value element = codec.children[0]->read(in);
+                static_cast<void>(builder.insert_copy(element.view().data()));
+            }
+            return builder.build();
+        }
+
+        void write_map(const CheckpointCodec &codec, const ValueView &view, CheckpointWriter &out)
+        {
+            const auto map = view.as_map();
+            out.pod(static_cast<std::uint64_t>(map.size()));
+            for (const auto [key, value] : map)
+            {
+                codec.children[0]->write(key, out);
+                out.pod(static_cast<std::uint8_t>(value.has_value()));
+                if (value.has_value()) { codec.children[1]->write(value, out); }
+            }
+        }
+
+        Value read_map(const CheckpointCodec &codec, CheckpointReader &in)
+        {
+            MapBuilder builder{codec.children[0]->binding, codec.children[1]->binding};
+            for (auto count = in.pod<std::uint64_t>(); count > 0; --count)
+            {
+                const Value key = codec.children[0]->read(in);
+                if (in.pod<std::uint8_t>() == 0)
+                {
+                    builder.set_item_unset(key.view().data());
+                    continue;
+                }
+                const Value value = codec.children[1]->read(in);
+                builder.set_item_copy(key.view().data(), value.view().data());
+            }
+            return builder.build();
+        }
+
+        template <typename T>
+        [[nodiscard]] bool bind_raw(CheckpointCodec &codec)
+        {
+            if (codec.meta != scalar_descriptor<T>::value_meta()) { return false; }
+            codec.write_ = &write_raw<T>;
+            codec.read_  = &read_raw<T>;
+            return true;
+        }
+
+        struct StateCodec
+        {
+            CheckpointStateWriteFn write{nullptr};
+            CheckpointStateReadFn  read{nullptr};
+        };
+
+        std::mutex g_codecs_mutex;
+        std::unordered_map<const ValueTypeMetaData *, std::unique_ptr<CheckpointCodec>> g_codecs;
+        std::unordered_map<std::string, StateCodec>                                     g_state_codecs;
+
+        const CheckpointCodec &build_codec(const ValueTypeMetaData *meta);
+
+        const CheckpointCodec &codec_for_locked(const ValueTypeMetaData *meta)
+        {
+            if (meta == nullptr) { throw std::logic_error("graph checkpoint: null value schema"); }
+            if (const auto it = g_codecs.find(meta); it != g_codecs.end()) { return *it->second; }
+            return build_codec(meta);
+        }
+
+        void bind_json(CheckpointCodec &codec)
+        {
+            codec.json   = &json_converter(codec.meta);
+            codec.write_ = &write_json;
+            codec.read_  = &read_json;
+        }
+
+        void bind_atomic(CheckpointCodec &codec)
+        {
+            if (codec.meta == scalar_descriptor<Str>::value_meta())
+            {
+                codec.write_ = &write_str;
+                codec.read_  = &read_str;
+                return;
+            }
+            if (bind_raw<Bool>(codec) || bind_raw<Int>(codec) || bind_raw<Float>(codec) ||
+                bind_raw<Date>(codec) || bind_raw<DateTime>(codec) || bind_raw<TimeDelta>(codec))
+            {
+                return;
+            }
+            if (const auto it = g_state_codecs.find(std::string{codec.meta->name()}); it != g_state_codecs.end())
+            {
+                codec.state_write = it->second.write;
+                codec.state_read  = it->second.read;
+                codec.write_      = &write_state;
+                codec.read_       = &read_state;
+                return;
+            }
+            bind_json(codec);
+        }
+
+        /** Throws ``std::logic_error`` for a schema with no serialized form. */
+        const CheckpointCodec &build_codec(const ValueTypeMetaData *meta)
+        {
+            auto  codec   = std::make_unique<CheckpointCodec>();
+            auto *raw     = codec.get();
+            codec->meta    = meta;
+            codec->binding = ValuePlanFactory::instance().type_for(meta);
+            // Insert before recursing so self-referential schemas terminate;
+            // the guard removes the half-built entry if synthesis throws.
+            g_codecs.emplace(meta, std::move(codec));
+            auto unwind = UnwindCleanupGuard([&] { g_codecs.erase(meta); });
+
+            switch (meta->is_owned() ? ValueTypeKind::Any : meta->value_kind())
+            {
+                case ValueTypeKind::Atomic: bind_atomic(*raw); break;
+                case ValueTypeKind::Tuple:
+                case ValueTypeKind::Bundle:
+                    for (std::size_t index = 0; index < meta->field_count; ++index)
+                    {
+                        raw->children.push_back(&codec_for_locked(meta->fields[index].type));
+                    }
+                    raw->write_ = &write_composite;
+                    raw->read_  = &read_composite;
+                    break;
+                case ValueTypeKind::List:
+                    if (meta->is_fixed_size())
+                    {
+                        bind_json(*raw);
+                        break;
+                    }
+                    raw->children.push_back(&codec_for_locked(meta->element_type));
+                    raw->write_ = &write_list;
+                    raw->read_  = &read_list;
+                    break;
+                case ValueTypeKind::Set:
+                    raw->children.push_back(&codec_for_locked(meta->element_type));
+                    raw->write_ = &write_set;
+                    raw->read_  = &read_set;
+                    break;
+                case ValueTypeKind::Map:
+                    raw->children.push_back(&codec_for_locked(meta->key_type));
+                    raw->children.push_back(&codec_for_locked(meta->element_type));
+                    raw->write_ = &write_map;
+                    raw->read_  = &read_map;
+                    break;
+                default: bind_json(*raw); break;
+            }
+            unwind.release();
+            return *raw;
+        }
+
+        [[nodiscard]] const CheckpointCodec &checkpoint_codec(const ValueTypeMetaData *meta)
+        {
+            std::scoped_lock lock{g_codecs_mutex};
+            return codec_for_locked(meta);
+        }
+
+        /** REF outputs bind to other outputs and windows keep per-tick times, so neither round-trips by value. */
+        [[nodiscard]] bool restorable_ts(const TSValueTypeMetaData *schema) noexcept
+        {
+            if (schema == nullptr) { return true; }
+            switch (schema->kind)
+            {
+                case TSTypeKind::REF:
+                case TSTypeKind::TSW: return false;
+                case TSTypeKind::TSB:
+                    for (std::size_t index = 0; index < schema->field_count(); ++index)
+                    {
+                        if (!restorable_ts(schema->fields()[index].type)) { return false; }
+                    }
+                    return true;
+                case TSTypeKind::TSL:
+                case TSTypeKind::TSD: return restorable_ts(schema->element_ts());
+                default: return true;
+            }
+        }
+
+        [[nodiscard]] std::size_t static_child_count(const TSValueTypeMetaData *schema) noexcept
+        {
+            if (schema->kind == TSTypeKind::TSB) { return schema->field_count(); }
+            return schema->fixed_size();
+        }
+
+        // Static TSB/TSL children are written leaf by leaf so per-field
+        // validity and modification times survive; dynamic collections are
+        // one value, modified at the collection's time.
+        void write_ts(const TSOutputView &view, CheckpointWriter &out)
+        {
+            const TSValueTypeMetaData *schema = view.schema();
+            if (const std::size_t children = static_child_count(schema); children > 0)
+            {
+                out.pod(static_cast<std::uint32_t>(children));
+                for (std::size_t index = 0; index < children; ++index) { write_ts(view.indexed_child_at(index), out); }
+                return;
+            }
+
+            const bool valid = view.valid();
+            out.pod(static_cast<std::uint8_t>(valid));
+            if (!valid) { return; }
+            out.time(view.last_modified_time());
+            if (schema->kind != TSTypeKind::SIGNAL) { checkpoint_codec(schema->value_type).write(view.value(), out); }
+        }
+
+        void restore_ts(const TSOutputView &view, CheckpointReader &in, DateTime now)
+        {
+            const TSValueTypeMetaData *schema = view.schema();
+            if (const std::size_t children = static_child_count(schema); children > 0)
+            {
+                if (in.pod<std::uint32_t>() != children)
+                {
+                    throw std::runtime_error("graph checkpoint: output shape does not match the graph");
+                }
+                for (std::size_t index = 0; index < children; ++index)
+                {
+                    restore_ts(view.indexed_child_at(index), in, now);
+                }
+                return;
+            }
+
+            if (in.pod<std::uint8_t>() == 0)
+            {
+                if (view.valid())
+                {
+                    auto mutation = view.begin_mutation(now);
+                    static_cast<void>(mutation.invalidate());
+                }
+                return;
+            }
+
+            // Mutating at the recorded time keeps ``modified()`` false in the
+            // first cycle; the notification it raises is overwritten when the
+            // schedules are restored.
+            auto mutation = view.begin_mutation(in.time());
+            if (schema->kind == TSTypeKind::SIGNAL)
+            {
+                mutation.mark_modified();
+                return;
+            }
+            const Value value = checkpoint_codec(schema->value_type).read(in);
+            static_cast<void>(mutation.copy_value_from(value.view()));
+        }
+
+        [[nodiscard]] std::string_view node_name(const NodeView &node) noexcept
+        {
+            const char *name = node.schema()->display_name;
+            return name != nullptr ? std::string_view{name} : std::string_view{};
+        }
+
+        [[nodiscard]] std::string node_identity(const NodeView &node, std::size_t index)
+        {
+            return fmt::format("node {} '{}'", index, node.label());
+        }
+
+        /** Empty when the node can be captured, otherwise why not. */
+        [[nodiscard]] std::string_view unsupported_reason(const NodeView &node)
+        {
+            const NodeTypeMetaData &schema = *node.schema();
+            if (node.node_kind() == NodeKind::Nested && !node.is<MapNodeView>()) { return "owns nested child graphs"; }
+            if (node.has_output() && !restorable_ts(schema.output_schema)) { return "has a REF or window output"; }
+            if (node.has_recordable_state() && !restorable_ts(schema.recordable_state_schema))
+            {
+                return "has a REF or window recordable state";
+            }
+            return {};
+        }
+
+        std::size_t write_graph_records(const GraphView &graph, DateTime now, GraphCheckpointOptions options,
+                                        std::size_t &child_graphs, CheckpointWriter &out);
+        std::size_t restore_graph_records(const GraphView &graph, CheckpointReader &in, DateTime checkpoint_time,
+                                          std::size_t &child_graphs);
+
+        // Each started child is its key followed by its own graph records,
+        // length-prefixed so the restore can hand them to the child later.
+        void write_map_children(const MapNodeView &map, DateTime now, GraphCheckpointOptions options,
+                                std::size_t &child_graphs, CheckpointWriter &out)
+        {
+            const CheckpointCodec &key_codec = checkpoint_codec(map.key_schema());
+            CheckpointWriter       children;
+            CheckpointWriter       records;
+            std::uint32_t          count = 0;
+            map.for_each_child([&](const ValueView &key, const GraphView &child) {
+                key_codec.write(key, children);
+                records.bytes().clear();
+                static_cast<void>(write_graph_records(child, now, options, child_graphs, records));
+                children.text(records.bytes());
+                ++count;
+            });
+            out.pod(count);
+            out.bytes().append(children.bytes());
+            child_graphs += count;
+        }
+
+        // The children exist only once the map reconciles its keys, so each
+        // record is staged on the map and applied as that key's child starts.
+        [[nodiscard]] bool stage_map_children(const MapNodeView &map, DateTime checkpoint_time,
+                                              std::size_t &child_graphs, CheckpointReader &in)
+        {
+            const CheckpointCodec &key_codec = checkpoint_codec(map.key_schema());
+            const auto             count     = in.pod<std::uint32_t>();
+            for (std::uint32_t index = 0; index < count; ++index)
+            {
+                Value key = key_codec.read(in);
+                map.stage_child_restore(
+                    std::move(key), [records = std::string{in.text()}, checkpoint_time](const GraphView &child) {
+                        CheckpointReader reader{records};
+                        std::size_t      nested = 0;
+                        static_cast<void>(restore_graph_records(child, reader, checkpoint_time, nested));
+                        if (!reader.at_end()) { throw std::runtime_error("graph checkpoint: trailing child data"); }
+                    });
+            }
+            child_graphs += count;
+            return count > 0;
+        }
+
+        void write_node(const NodeView &node, DateTime scheduled, DateTime now, GraphCheckpointOptions options,
+                        std::size_t &child_graphs, CheckpointWriter &out)
+        {
+            std::uint8_t flags = 0;
+            if (node.has_output() && !node.output(now).forwarding()) { flags |= node_output; }
+            if (node.has_recordable_state()) { flags |= node_recordable_state; }
+            if (node.has_state()) { flags |= node_state; }
+            if (node.has_scheduler()) { flags |= node_scheduler; }
+            if (node.is<MapNodeView>()) { flags |= node_children; }
+
+            out.pod(flags);
+            out.time(scheduled);
+            if ((flags & node_scheduler) != 0)
+            {
+                const NodeSchedulerState &state  = node.scheduler_state();
+                const auto                events = state.events.entries();
+                out.pod(static_cast<std::uint32_t>(events.size()));
+                for (const auto &event : events)
+                {
+                    out.time(event.when);
+                    out.text(state.tag_name(event.tag));
+                }
+            }
+            if ((flags & node_output) != 0) { write_ts(node.output(now), out); }
+            if ((flags & node_recordable_state) != 0) { write_ts(node.recordable_state(now), out); }
+            if ((flags & node_state) != 0) { checkpoint_codec(node.schema()->state_schema).write(node.state(), out); }
+            if ((flags & node_children) != 0)
+            {
+                write_map_children(node.as<MapNodeView>(), now, options, child_graphs, out);
+            }
+        }
+
+        /** True when the node staged child restores and must run in the first cycle. */
+        [[nodiscard]] bool restore_node(const NodeView &node, std::uint8_t flags, DateTime checkpoint_time,
+                                        std::size_t &child_graphs, CheckpointReader &in)
+        {
+            const DateTime now    = node.graph().evaluation_time();
+            const bool     output = node.has_output() && !node.output(now).forwarding();
+            if (((flags & node_output) != 0) != output ||
+                ((flags & node_recordable_state) != 0) != node.has_recordable_state() ||
+                ((flags & node_state) != 0) != node.has_state() ||
+                ((flags & node_scheduler) != 0) != node.has_scheduler() ||
+                ((flags & node_children) != 0) != node.is<MapNodeView>())
+            {
+                throw std::runtime_error("graph checkpoint: node layout does not match the graph");
+            }
+
+            if ((flags & node_scheduler) != 0)
+            {
+                NodeSchedulerState &state = node.scheduler_state();
+                state.events.clear();
+                for (auto count = in.pod<std::uint32_t>(); count > 0; --count)
+                {
+                    const DateTime when = std::max(in.time(), now);
+                    const SchedulerTag tag = state.tag(in.text());
+                    state.events.push({.when = when, .tag = tag});
+                }
+            }
+            if ((flags & node_output) != 0) { restore_ts(node.output(now), in, now); }
+            if ((flags & node_recordable_state) != 0) { restore_ts(node.recordable_state(now), in, now); }
+            if ((flags & node_state) != 0)
+            {
+                node.replace_state(checkpoint_codec(node.schema()->state_schema).read(in));
+            }
+            if ((flags & node_children) != 0)
+            {
+                return stage_map_children(node.as<MapNodeView>(), checkpoint_time, child_graphs, in);
+            }
+            return false;
+        }
+
+        [[nodiscard]] std::string_view graph_name(const GraphView &graph) noexcept
+        {
+            return graph.schema() != nullptr ? graph.schema()->name() : std::string_view{};
+        }
+
+        /** Write one graph's node records; returns how many nodes were skipped. */
+        std::size_t write_graph_records(const GraphView &graph, DateTime now, GraphCheckpointOptions options,
+                                        std::size_t &child_graphs, CheckpointWriter &out)
+        {
+            const std::size_t node_count = graph.node_count();
+            out.pod(static_cast<std::uint64_t>(node_count));
+
+            // Records are built first: a skipped node restarts fresh, so every
+            // node reading it, directly or through other nodes, is skipped too
+            // rather than restored against an upstream it no longer matches.
+            std::vector<std::string>   records(node_count);
+            std::vector<std::uint8_t>  skipped(node_count, 0U);
+            std::vector<std::size_t>   pending;
+            CheckpointWriter           record;
+            for (std::size_t index = 0; index < node_count; ++index)
+            {
+                const NodeView node = graph.node_at(index);
+                std::string    reason{unsupported_reason(node)};
+                if (reason.empty())
+                {
+                    record.bytes().clear();
+                    try
+                    {
+                        write_node(node, graph.node_scheduled_time(index), now, options, child_graphs, record);
+                    }
+                    catch (const std::logic_error &error)
+                    {
+                        reason = error.what();
+                    }
+                }
+                if (!reason.empty())
+                {
+                    if (!options.skip_unsupported)
+                    {
+                        throw std::logic_error(fmt::format("graph checkpoint: {} cannot be captured: {}",
+                                                           node_identity(node, index), reason));
+                    }
+                    skipped[index] = 1U;
+                    pending.push_back(index);
+                    continue;
+                }
+                records[index] = std::move(record.bytes());
+            }
+
+            if (!pending.empty() && graph.schema() != nullptr)
+            {
+                std::vector<std::pair<std::size_t, std::size_t>> outgoing;
+                outgoing.reserve(graph.schema()->edges.size());
+                for (const GraphEdge &edge : graph.schema()->edges)
+                {
+                    if (edge.target_node < node_count)
+                    {
+                        outgoing.emplace_back(graph_edge_source_node(edge.source_node), edge.target_node);
+                    }
+                }
+                std::ranges::sort(outgoing);
+                while (!pending.empty())
+                {
+                    const std::size_t source = pending.back();
+                    pending.pop_back();
+                    auto edge = std::ranges::lower_bound(outgoing, std::pair{source, std::size_t{0}});
+                    for (; edge != outgoing.end() && edge->first == source; ++edge)
+                    {
+                        if (skipped[edge->second] != 0U) { continue; }
+                        skipped[edge->second] = 1U;
+                        pending.push_back(edge->second);
+                    }
+                }
+            }
+
+            std::size_t skipped_count = 0;
+            for (std::size_t index = 0; index < node_count; ++index)
+            {
+                out.text(node_name(graph.node_at(index)));
+                if (skipped[index] != 0U)
+                {
+                    out.pod(static_cast<std::uint8_t>(node_skipped));
+                    ++skipped_count;
+                    continue;
+                }
+                out.bytes().append(records[index]);
+            }
+            return skipped_count;
+        }
+
+        /** Restore one graph's node records; returns how many were skipped at write time. */
+        std::size_t restore_graph_records(const GraphView &graph, CheckpointReader &in, DateTime checkpoint_time,
+                                          std::size_t &child_graphs)
+        {
+            const std::size_t node_count = graph.node_count();
+            if (in.pod<std::uint64_t>() != node_count)
+            {
+                throw std::runtime_error("graph checkpoint: node count does not match the graph");
+            }
+
+            // Outputs first, schedules last: restoring an output notifies its
+            // consumers, and the saved schedule entries must win over that.
+            const DateTime                                now = graph.evaluation_time();
+            std::vector<std::pair<std::size_t, DateTime>> schedules;
+            schedules.reserve(node_count);
+            std::size_t skipped = 0;
+            for (std::size_t index = 0; index < node_count; ++index)
+            {
+                const NodeView node = graph.node_at(index);
+                if (in.text() != node_name(node))
+                {
+                    throw std::runtime_error(
+                        fmt::format("graph checkpoint: {} does not match the checkpoint", node_identity(node, index)));
+                }
+                const auto flags = in.pod<std::uint8_t>();
+                if ((flags & node_skipped) != 0)
+                {
+                    ++skipped;
+                    continue;
+                }
+
+                // An entry at or before the checkpoint time was consumed by that cycle.
+                const DateTime scheduled = in.time();
+                DateTime       when      = scheduled > checkpoint_time ? std::max(scheduled, now) : MIN_DT;
+                if (restore_node(node, flags, checkpoint_time, child_graphs, in)) { when = now; }
+                schedules.emplace_back(index, when);
+            }
+
+            for (const auto &[index, when] : schedules) { graph.restore_node_schedule(index, when); }
+            return skipped;
+        }
+    }  // namespace
+
+    void CheckpointWriter::text(std::string_view value)
+    {
+        pod(static_cast<std::uint64_t>(value.size()));
+        bytes_.append(value);
+    }
+
+    void CheckpointWriter::time(DateTime value) { pod(static_cast<std::int64_t>(value.time_since_epoch().count())); }
+
+    void CheckpointWriter::value(const ValueView &value) { checkpoint_codec(value.schema()).write(value, *this); }
+
+    void CheckpointWriter::schema(const ValueTypeMetaData *schema)
+    {
+        if (schema == nullptr || TypeRegistry::instance().value_type(schema->name()) != schema)
+        {
+            throw std::logic_error(fmt::format("graph checkpoint: schema '{}' is not registered by name",
+                                               schema != nullptr ? schema->name() : std::string_view{"<null>"}));
+        }
+        text(schema->name());
+    }
+
+    std::string_view CheckpointReader::text()
+    {
+        const auto size = pod<std::uint64_t>();
+        require(size);
+        const std::string_view value = bytes_.substr(offset_, size);
+        offset_ += size;
+        return value;
+    }
+
+    DateTime CheckpointReader::time() { return DateTime{TimeDelta{pod<std::int64_t>()}}; }
+
+    Value CheckpointReader::value(const ValueTypeMetaData *schema) { return checkpoint_codec(schema).read(*this); }
+
+    const ValueTypeMetaData *CheckpointReader::schema()
+    {
+        const std::string_view name = text();
+        const auto            *schema = TypeRegistry::instance().value_type(name);
+        if (schema == nullptr)
+        {
+            throw std::runtime_error(fmt::format("graph checkpoint: unknown schema '{}'", name));
+        }
+        return schema;
+    }
+
+    void CheckpointReader::require(std::size_t size) const
+    {
+        if (bytes_.size() - offset_ < size) { throw std::runtime_error("graph checkpoint: truncated data"); }
+    }
+
+    void register_checkpoint_state_codec(std::string_view scalar_name, CheckpointStateWriteFn write,
+                                         CheckpointStateReadFn read)
+    {
+        if (write == nullptr || read == nullptr)
+        {
+            throw std::invalid_argument("register_checkpoint_state_codec requires write and read functions");
+        }
+        std::scoped_lock lock{g_codecs_mutex};
+        g_state_codecs.insert_or_assign(std::string{scalar_name}, StateCodec{.write = write, .read = read});
+    }
+
+    GraphCheckpointInfo write_graph_checkpoint(const GraphView &graph, std::ostream &out,
+                                               GraphCheckpointOptions options)
+    {
+        if (!graph.started()) { throw std::logic_error("write_graph_checkpoint requires a started graph"); }
+
+        const DateTime      now = graph.evaluation_time();
+        GraphCheckpointInfo info{.evaluation_time = now, .nodes = graph.node_count()};
+        CheckpointWriter    writer;
+        writer.pod(checkpoint_magic);
+        writer.pod(checkpoint_version);
+        writer.text(graph_name(graph));
+        writer.time(now);
+        info.skipped = write_graph_records(graph, now, options, info.child_graphs, writer);
+
+        out.write(writer.bytes().data(), static_cast<std::streamsize>(writer.bytes().size()));
+        if (!out) { throw std::runtime_error("graph checkpoint: write failed"); }
+        return info;
+    }
+
+    GraphCheckpointInfo write_graph_checkpoint(const GraphView &graph, const std::filesystem::path &path,
+                                               GraphCheckpointOptions options)
+    {
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        auto remove_temporary = UnwindCleanupGuard([&] {
+            std::error_code ignored;
+            std::filesystem::remove(temporary, ignored);
+        });
+
+        GraphCheckpointInfo info;
+        {
+            std::ofstream out{temporary, std::ios::binary | std::ios::trunc};
+            if (!out) { throw std::runtime_error("graph checkpoint could not open '" + temporary.string() + "'"); }
+            info = write_graph_checkpoint(graph, out, options);
+            out.flush();
+            if (!out) { throw std::runtime_error("graph checkpoint could not write '" + temporary.string() + "'"); }
+        }
+        std::filesystem::rename(temporary, path);
+        remove_temporary.release();
+        return info;
+    }
+
+    GraphCheckpointInfo restore_graph_checkpoint(const GraphView &graph, std::istream &in)
+    {
+        if (!graph.started() || graph.evaluating())
+        {
+            throw std::logic_error("restore_graph_checkpoint requires a started graph before its first evaluation");
+        }
+
+        const std::string bytes{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        CheckpointReader  reader{bytes};
+        if (reader.pod<std::uint32_t>() != checkpoint_magic) { throw std::runtime_error("graph checkpoint: bad magic"); }
+        if (const auto version = reader.pod<std::uint32_t>(); version != checkpoint_version)
+        {
+            throw std::runtime_error(fmt::format("graph checkpoint: unsupported version {}", version));
+        }
+        if (const auto name = reader.text(); name != graph_name(graph))
+        {
+            throw std::runtime_error(
+                fmt::format("graph checkpoint: taken from graph '{}', not '{}'", name, graph_name(graph)));
+        }
+
+        GraphCheckpointInfo info{.evaluation_time = reader.time(), .nodes = graph.node_count()};
+        info.skipped = restore_graph_records(graph, reader, info.evaluation_time, info.child_graphs);
+        if (!reader.at_end()) { throw std::runtime_error("graph checkpoint: trailing data"); }
+        return info;
+    }
+
+    GraphCheckpointInfo restore_graph_checkpoint(const GraphView &graph, const std::filesystem::path &path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in) { throw std::runtime_error("graph checkpoint could not open '" + path.string() + "'"); }
+        return restore_graph_checkpoint(graph, in);
+    }
+
+    void clear_graph_checkpoint_codecs() noexcept
+    {
+        std::scoped_lock lock{g_codecs_mutex};
+        g_codecs.clear();
+    }
+
+    GraphCheckpointer::GraphCheckpointer(std::filesystem::path path, GraphCheckpointerOptions options)
+        : path_(std::move(path)), options_(options)
+    {
+        if (options_.every_cycles == 0) { throw std::invalid_argument("GraphCheckpointer requires every_cycles > 0"); }
+    }
+
+    void GraphCheckpointer::on_after_start_graph(const GraphView &graph)
+    {
+        if (!graph.is_root()) { return; }
+        cycles_  = 0;
+        written_ = 0;
+        restored_.reset();
+        if (options_.restore && std::filesystem::exists(path_))
+        {
+            restored_ = restore_graph_checkpoint(graph, path_);
+        }
+    }
+
+    void GraphCheckpointer::on_after_graph_evaluation(const GraphView &graph)
+    {
+        // A failed cycle also reports here while it unwinds; its state is not a boundary.
+        if (!graph.is_root() || std::uncaught_exceptions() > 0) { return; }
+        if (++cycles_ % options_.every_cycles != 0) { return; }
+        static_cast<void>(
+            write_graph_checkpoint(graph, path_, GraphCheckpointOptions{.skip_unsupported = options_.skip_unsupported}));
+        ++written_;
+    }
+}  // namespace hgraph
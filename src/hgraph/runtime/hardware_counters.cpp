@@ -0,0 +1,116 @@
+#include "hardware_counters.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace hgraph::runtime_detail
+{
+    HardwareCounterGroup::~HardwareCounterGroup() { close(); }
+
+#if defined(__linux__)
+    namespace
+    {
+        constexpr std::array<std::uint64_t, HardwareCounterGroup::counter_count> hardware_events{
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+
+        constexpr std::array<const char *, HardwareCounterGroup::counter_count> hardware_event_names{
+            "cycles",
+            "instructions",
+            "llc_misses",
+            "branch_misses",
+        };
+
+        int open_counter(std::uint64_t event, int group_fd)
+        {
+            perf_event_attr attr{};
+            attr.size           = sizeof(attr);
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.config         = event;
+            attr.disabled       = group_fd < 0 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+        }
+    }  // namespace
+
+    bool HardwareCounterGroup::open()
+    {
+        if (is_open()) { return true; }
+        error_.clear();
+        const int leader = open_counter(hardware_events[0], -1);
+        if (leader < 0)
+        {
+            error_ = std::string{"perf_event_open failed: "} + std::strerror(errno);
+            return false;
+        }
+        fds_[0]       = leader;
+        members_[0]   = 0;
+        member_count_ = 1;
+        for (std::size_t counter = 1; counter < counter_count; ++counter)
+        {
+            const int fd = open_counter(hardware_events[counter], leader);
+            if (fd < 0)
+            {
+                error_ += std::string{error_.empty() ? "" : "; "} + hardware_event_names[counter] +
+                          " unavailable: " + std::strerror(errno);
+                continue;
+            }
+            fds_[counter]             = fd;
+            members_[member_count_++] = counter;
+        }
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return true;
+    }
+
+    void HardwareCounterGroup::close() noexcept
+    {
+        // Members first; closing the leader also detaches them.
+        for (std::size_t counter = counter_count; counter > 0; --counter)
+        {
+            if (int &fd = fds_[counter - 1]; fd >= 0)
+            {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+        member_count_ = 0;
+    }
+
+    HardwareCounterGroup::Values HardwareCounterGroup::read() const noexcept
+    {
+        Values result{};
+        if (!is_open()) { return result; }
+        // PERF_FORMAT_GROUP layout: member count, then one value per member.
+        std::array<std::uint64_t, counter_count + 1> buffer{};
+        if (::read(fds_[0], buffer.data(), sizeof(buffer)) <= 0) { return result; }
+        const auto members = std::min<std::uint64_t>(buffer[0], member_count_);
+        for (std::size_t member = 0; member < members; ++member) { result[members_[member]] = buffer[member + 1]; }
+        return result;
+    }
+#else
+    bool HardwareCounterGroup::open()
+    {
+        error_ = "hardware counters require Linux perf_event_open";
+        return false;
+    }
+
+    void HardwareCounterGroup::close() noexcept {}
+
+    HardwareCounterGroup::Values HardwareCounterGroup::read() const noexcept { return {}; }
+#endif
+}  // namespace hgraph::runtime_detail
@@ -0,0 +1,55 @@
+#ifndef HGRAPH_RUNTIME_HARDWARE_COUNTERS_H
+#define HGRAPH_RUNTIME_HARDWARE_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hgraph::runtime_detail
+{
+    /**
+     * Grouped hardware counters for the calling thread, read through Linux
+     * ``perf_event_open``: cycles, instructions, last-level cache misses and
+     * branch misses, in that order.
+     *
+     * ``open`` binds the group to the calling thread, and ``read`` returns
+     * every running total in one system call. A member the PMU or hypervisor
+     * does not expose reads as zero, and ``error`` names it while the group
+     * still opens. When even the cycle leader cannot be
+     * opened the group stays closed and ``error`` says why. That happens with
+     * no PMU, a restrictive ``perf_event_paranoid``, seccomp in containers,
+     * or a non-Linux build. User-space only: kernel and hypervisor time is
+     * excluded, which also keeps the default paranoid level usable.
+     */
+    class HardwareCounterGroup
+    {
+      public:
+        static constexpr std::size_t counter_count = 4;
+        using Values                               = std::array<std::uint64_t, counter_count>;
+
+        HardwareCounterGroup() = default;
+        ~HardwareCounterGroup();
+
+        HardwareCounterGroup(const HardwareCounterGroup &)            = delete;
+        HardwareCounterGroup &operator=(const HardwareCounterGroup &) = delete;
+
+        /** Open and enable the group on the calling thread; false on failure. */
+        bool open();
+        void close() noexcept;
+
+        [[nodiscard]] bool               is_open() const noexcept { return fds_[0] >= 0; }
+        [[nodiscard]] const std::string &error() const noexcept { return error_; }
+        /** Running totals; zeros when closed or when the read fails. */
+        [[nodiscard]] Values read() const noexcept;
+
+      private:
+        std::array<int, counter_count>         fds_{-1, -1, -1, -1};
+        // Counter index of each group member, in group read order.
+        std::array<std::size_t, counter_count> members_{};
+        std::size_t                            member_count_{0};
+        std::string                            error_{};
+    };
+}  // namespace hgraph::runtime_detail
+
+#endif  // HGRAPH_RUNTIME_HARDWARE_COUNTERS_H
@@ -1,12 +1,15 @@
 #include <hgraph/runtime/map_node.h>
+#include <hgraph/runtime/lifecycle_observer.h>
 #include <hgraph/runtime/nested_bindings.h>
 #include <hgraph/runtime/nested_graph_storage.h>
 #include <hgraph/runtime/node_error.h>
+#include <hgraph/types/metadata/type_realization.h>
 #include <hgraph/types/metadata/type_registry.h>
 #include <hgraph/types/utils/slot_bitmap.h>
 #include <hgraph/types/value/impl/graph_local_value.h>
 #include <hgraph/util/scope.h>
 
+#include "child_evaluation_pool.h"
 #include "mapped_child_bindings.h"
 #include "mapped_key_source.h"
 
@@ -14,6 +17,8 @@
 #include <array>
 #include <bit>
 #include <cstddef>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -77,6 +82,17 @@ namespace hgraph
             GraphValue                     graph{};
         };
 
+        /** One due child of a parallel cycle and the outcome of its evaluation. */
+        struct MapParallelChild
+        {
+            MapKeyEntry       *entry{nullptr};
+            // Notifications the child's writes to its output element raised
+            // on the worker, replayed serially at the join.
+            TSDataDeferredPublication *publication{nullptr};
+            bool               completed{true};
+            std::exception_ptr error{};
+        };
+
         struct MapNodeStorage final : SlotObserver
         {
             MapNodeStorage() = default;
@@ -101,6 +117,9 @@ namespace hgraph
             // replacement cycle.
             InPlaceGraphSlotStore<MapKeyEntry> previous_entries{};
             DateTime previous_entries_time{MIN_DT};
+            // Set while ``MapNodeSpec::recycle_child_graphs`` is on: erased
+            // entries hand their reset child to ``entries`` for the next key.
+            const GraphBuilder *recycle_builder{nullptr};
             // Cached bound-output handles of the outer inputs (tsd + broadcast
             // sources). Entry input bindings are established at creation and
             // refreshed only when an upstream source re-points.
@@ -117,6 +136,9 @@ namespace hgraph
             bool               selective_repoint_bindings{false};
             std::vector<Value> membership_changed_keys{};
             std::vector<Value> repoint_modified_keys{};
+            // Checkpoint restores staged for the next reconciliation, applied
+            // to each key's child as it is created (see stage_child_restore).
+            std::vector<std::pair<Value, std::function<void(const GraphView &)>>> staged_child_restores{};
 
             // Candidate slots are sparse for ordinary multiplexed value ticks.
             // Full scans remain the conservative path for broadcast/repoint and
@@ -124,6 +146,13 @@ namespace hgraph
             SlotBitmap              evaluation_candidates{};
             std::vector<std::size_t> evaluation_slots{};
             std::size_t              resume_position_plus_one{0};
+            // Due children of a parallel cycle, retained to keep the fan-out
+            // allocation-free once the map reaches its steady-state width.
+            std::vector<MapParallelChild> parallel_children{};
+            // One publication buffer per fan-out position; grown to the
+            // widest cycle and reused, so their queues keep their capacity
+            // (a deque, so buffers already handed out stay put as it grows).
+            std::deque<TSDataDeferredPublication> parallel_publications{};
             // Priority queue of (when, slot) child schedules — a min-heap
             // popped for due slots each evaluation, fed by the nested
             // out-of-band hook and the evaluation loop's future schedules.
@@ -256,6 +285,23 @@ namespace hgraph
                 primed = false;
             }
 
+            // The child was stopped by reconciliation; resetting it here, when
+            // the plain path would destroy it, drops its subscriptions at the
+            // same point in the lifecycle. A failed reset leaves nothing to keep.
+            void retain_child_graph(std::size_t slot) noexcept
+            {
+                auto *entry = entries.entry_at(slot);
+                if (recycle_builder == nullptr || entry == nullptr || !entries.can_retain_graph() ||
+                    !entry->graph.has_value() || entry->graph.view().started())
+                {
+                    return;
+                }
+                static_cast<void>(fallback_on_exception(false, [&] {
+                    recycle_builder->reset_nested_graph(entry->graph);
+                    return entries.retain_graph(slot, std::move(entry->graph));
+                }));
+            }
+
             void on_capacity(std::size_t, std::size_t new_capacity) override
             {
                 entries.reserve_to(new_capacity);
@@ -267,7 +313,11 @@ namespace hgraph
             // A forwarding source can repoint during its mutation, so acting on
             // this slot callback alone could stop an unrelated replacement key.
             void on_remove(std::size_t) override {}
-            void on_erase(std::size_t slot) override { entries.destroy_at(slot); }
+            void on_erase(std::size_t slot) override
+            {
+                retain_child_graph(slot);
+                entries.destroy_at(slot);
+            }
             // Reconciliation must stop children and publish their removals
             // before an erase callback performs destruction.
             void on_clear() override { keys_source_cleared = true; }
@@ -470,6 +520,17 @@ namespace hgraph
             }
         }
 
+        void apply_staged_child_restore(MapNodeStorage &storage, const MapKeyEntry &entry)
+        {
+            auto &staged = storage.staged_child_restores;
+            const auto it = std::find_if(staged.begin(), staged.end(),
+                                         [&](const auto &item) { return item.first.equals(entry.key.view()); });
+            if (it == staged.end()) { return; }
+            const auto restore = std::move(it->second);
+            staged.erase(it);
+            restore(entry.graph.view());
+        }
+
         void create_entry_at_slot(const NodeView &view, const MapNodeContext &context, MapNodeStorage &storage,
                                   TSDDataMutationView *output_mutation, const TSSDataView &keys_set,
                                   std::size_t slot, DateTime evaluation_time)
@@ -492,6 +553,10 @@ namespace hgraph
                 if (existing == nullptr) { storage.entries.destroy_at(slot); }
             });
 
+            if (!entry.graph.has_value())
+            {
+                entry.graph = storage.entries.take_retained_graph(slot);
+            }
             if (!entry.graph.has_value())
             {
                 entry.graph = spec.child.graph_builder.make_nested_graph(
@@ -532,6 +597,7 @@ namespace hgraph
                 &entry.schedule_context);
             schedule_sampled_input_consumers(
                 entry.graph.view(), evaluation_time, spec.child.input_bindings);
+            apply_staged_child_restore(storage, entry);
             rollback.release();
         }
 
@@ -607,6 +673,8 @@ namespace hgraph
             storage.destroy_previous_entries_before(evaluation_time);
             storage.entries.bind_graph_layout(context.graph_layout);
             storage.previous_entries.bind_graph_layout(context.graph_layout);
+            storage.entries.retained_graph_limit(spec.recycle_child_graphs);
+            storage.recycle_builder = spec.recycle_child_graphs != 0 ? &spec.child.graph_builder : nullptr;
 
             auto root_input = view.input(evaluation_time);
             SourceRepointStatus source_status =
@@ -758,6 +826,7 @@ namespace hgraph
                     }
                 }
             }
+            storage.staged_child_restores.clear();
             return bindings_need_refresh;
         }
 
@@ -953,6 +1022,173 @@ namespace hgraph
             (void)mutation.move_value_from(std::move(error_value));
         }
 
+        void refresh_map_entry_bindings(const NodeView &view, const MapNodeSpec &spec,
+                                        MapNodeStorage &storage, MapKeyEntry &entry,
+                                        const GraphView &child, DateTime evaluation_time)
+        {
+            const bool membership_changed =
+                map_entry_membership_changed(storage, entry.key.view());
+            if (!storage.refresh_all_bindings && !membership_changed) { return; }
+
+            const bool silent_repoint = storage.selective_repoint_bindings &&
+                                        !membership_changed &&
+                                        !map_entry_repoint_modified(storage, entry.key.view());
+            const TSOutputView key_source = entry.key_source.bound()
+                                                ? entry.key_source.view(evaluation_time)
+                                                : TSOutputView{};
+            runtime_detail::bind_mapped_child_inputs(view, child, evaluation_time, spec.child,
+                                                     spec.args, entry.key.view(), key_source,
+                                                     std::nullopt, silent_repoint);
+            runtime_detail::bind_mapped_child_output(view, child, evaluation_time,
+                                                     spec.child.output_binding, spec.args,
+                                                     entry.key.view(), key_source,
+                                                     spec.output_binding_mode, silent_repoint);
+        }
+
+        void pull_map_child_schedule(MapNodeStorage &storage, MapKeyEntry &entry,
+                                     const GraphView &child, DateTime evaluation_time)
+        {
+            if (const DateTime next = child.next_scheduled_time(); next != MAX_DT && next > evaluation_time)
+            {
+                // The PULL half: schedules created while the map drove
+                // the child land in the queue here; the out-of-band
+                // observer covers schedules arriving between map
+                // evaluations.
+                storage.push_pulled_child_schedule(
+                    next, entry.schedule_context);
+            }
+            else
+            {
+                // Invalidate a lazy entry when the child consumed or
+                // cancelled its previous deadline.
+                entry.schedule_context.pulled_when = MAX_DT;
+            }
+        }
+
+        // The tracking of ``key``'s output element: the boundary a parallel
+        // child's writes are published across. Null when the map has no
+        // output or the element does not exist.
+        [[nodiscard]] TSDataTracking *map_output_element_tracking(const NodeView &view, const MapNodeSpec &spec,
+                                                                  const ValueView &key, DateTime evaluation_time)
+        {
+            if (!spec.child.output_binding.has_value()) { return nullptr; }
+            auto element = runtime_detail::mapped_output_element(view, evaluation_time, key);
+            if (!element.bound()) { return nullptr; }
+            auto        data = element.data_view().borrowed_ref();
+            const auto &ops  = data.ops();
+            return ops.mutable_tracking_impl(ops.context, data.mutable_data());
+        }
+
+        [[nodiscard]] bool map_children_parallel_safe(const GraphView &child)
+        {
+            // Observers (profiler, tracing) and pooled compound scalar
+            // storage are shared with the enclosing graph and are not
+            // synchronised; their presence keeps the cycle serial.
+            return child.lifecycle_observers().empty() && !child.compound_scalar_storage().available();
+        }
+
+        // Parallel cycle of an opt-in map: everything that touches state
+        // shared between keys (binding refresh, error output, output
+        // finalisation, schedule bookkeeping) runs on the engine thread
+        // before the fan-out or after the join; only the child graph
+        // evaluations run on the pool. Returns false when the cycle is not
+        // eligible and the caller should take the serial path.
+        [[nodiscard]] bool map_evaluate_children_parallel(const NodeView &view, const MapNodeSpec &spec,
+                                                          MapNodeStorage &storage, bool captures_errors,
+                                                          DateTime evaluation_time)
+        {
+            auto &due = storage.parallel_children;
+            due.clear();
+            for (const std::size_t slot : storage.evaluation_slots)
+            {
+                auto *entry = storage.entry_at(slot);
+                if (entry == nullptr || !entry->graph.has_value()) { continue; }
+                auto child = entry->graph.view();
+                if (!child.started()) { continue; }
+                if (due.empty() && !map_children_parallel_safe(child)) { return false; }
+                refresh_map_entry_bindings(view, spec, storage, *entry, child, evaluation_time);
+                if (child.next_scheduled_time() <= evaluation_time)
+                {
+                    if (storage.parallel_publications.size() == due.size())
+                    {
+                        storage.parallel_publications.emplace_back();
+                    }
+                    auto &publication = storage.parallel_publications[due.size()];
+                    publication.reset(map_output_element_tracking(view, spec, entry->key.view(), evaluation_time));
+                    due.push_back(MapParallelChild{.entry = entry, .publication = &publication});
+                }
+            }
+
+            // A child's output element has observers and a parent container
+            // shared with every other key (a chained map_, a TSD consumer), so
+            // its notifications are queued on the worker and replayed here.
+            // Workers allocate and realize types exactly as this thread would.
+            const auto *realization = view.graph().type_realization();
+            const auto &allocator   = MemoryUtils::allocator();
+            auto evaluate_child = [&due, evaluation_time, realization, &allocator](std::size_t index) noexcept {
+                auto &item = due[index];
+                TypeRealizationScope        realization_scope{realization};
+                MemoryUtils::AllocatorScope allocator_scope{allocator};
+                try
+                {
+                    TSDataDeferredPublication::Scope publish{*item.publication};
+                    item.completed = item.entry->graph.view().evaluate(evaluation_time);
+                }
+                catch (...)
+                {
+                    item.error = std::current_exception();
+                }
+            };
+            {
+                TSDataDeferredPublication::InFlight in_flight;
+                runtime_detail::ChildEvaluationPool::instance().run(due.size(), evaluate_child);
+            }
+            for (auto &item : due) { item.publication->replay(); }
+
+            for (auto &item : due)
+            {
+                auto &entry = *item.entry;
+                auto  child = entry.graph.view();
+                if (item.error)
+                {
+                    if (!captures_errors)
+                    {
+                        const std::exception_ptr error = item.error;
+                        due.clear();
+                        std::rethrow_exception(error);
+                    }
+                    static_cast<void>(fallback_on_exception(
+                        true,
+                        [&]() -> bool { std::rethrow_exception(item.error); },
+                        [&](const char *error) {
+                            write_map_error(view, child.failed_node(), entry.key.view(),
+                                            evaluation_time, error);
+                        }));
+                }
+                else if (!item.completed)
+                {
+                    due.clear();
+                    throw std::logic_error(
+                        "map_ parallel children cannot pause on a mesh dependency; "
+                        "evaluate this map serially");
+                }
+                runtime_detail::finalize_mapped_child_output(
+                    view, evaluation_time, spec.child.output_binding,
+                    entry.key.view());
+            }
+            due.clear();
+
+            for (const std::size_t slot : storage.evaluation_slots)
+            {
+                auto *entry = storage.entry_at(slot);
+                if (entry == nullptr || !entry->graph.has_value()) { continue; }
+                auto child = entry->graph.view();
+                if (!child.started()) { continue; }
+                pull_map_child_schedule(storage, *entry, child, evaluation_time);
+            }
+            return true;
+        }
+
         // Evaluates the keyed children, supporting pause/resume: a child that pauses (a
         // mesh nested in the child needs a sibling) propagates the pause — we save the slot
         // cursor and return false so the enclosing mesh resolves the dependency and
@@ -981,7 +1217,13 @@ namespace hgraph
             // Due children write their TSD elements directly via their terminal forwarding
             // outputs (no post-evaluation collection). A child evaluation propagates its own
             // next scheduled time back to this node; unevaluated children pull theirs up.
-            const std::size_t start_position = resuming ? storage.resume_position_plus_one - 1 : 0;
+            const bool evaluated_in_parallel =
+                spec.parallel_children && !resuming &&
+                map_evaluate_children_parallel(view, spec, storage, captures_errors, evaluation_time);
+            const std::size_t start_position =
+                evaluated_in_parallel ? storage.evaluation_slots.size()
+                : resuming            ? storage.resume_position_plus_one - 1
+                                      : 0;
             for (std::size_t position = start_position; position < storage.evaluation_slots.size(); ++position)
             {
                 const std::size_t slot = storage.evaluation_slots[position];
@@ -993,24 +1235,7 @@ namespace hgraph
                 // schedule enqueued before the stop) lingers this cycle —
                 // stopped children never evaluate.
                 if (!child.started()) { continue; }
-                const bool membership_changed =
-                    map_entry_membership_changed(storage, entry->key.view());
-                if (storage.refresh_all_bindings || membership_changed)
-                {
-                    const bool silent_repoint = storage.selective_repoint_bindings &&
-                                                !membership_changed &&
-                                                !map_entry_repoint_modified(storage, entry->key.view());
-                    const TSOutputView key_source = entry->key_source.bound()
-                                                        ? entry->key_source.view(evaluation_time)
-                                                        : TSOutputView{};
-                    runtime_detail::bind_mapped_child_inputs(view, child, evaluation_time, spec.child,
-                                                             spec.args, entry->key.view(), key_source,
-                                                             std::nullopt, silent_repoint);
-                    runtime_detail::bind_mapped_child_output(view, child, evaluation_time,
-                                                             spec.child.output_binding, spec.args,
-                                                             entry->key.view(), key_source,
-                                                             spec.output_binding_mode, silent_repoint);
-                }
+                refresh_map_entry_bindings(view, spec, storage, *entry, child, evaluation_time);
 
                 const bool resume_this = resuming && position == start_position;
                 if (child.next_scheduled_time() <= evaluation_time || resume_this)
@@ -1034,21 +1259,7 @@ namespace hgraph
                         view, evaluation_time, spec.child.output_binding,
                         entry->key.view());
                 }
-                if (const DateTime next = child.next_scheduled_time(); next != MAX_DT && next > evaluation_time)
-                {
-                    // The PULL half: schedules created while the map drove
-                    // the child land in the queue here; the out-of-band
-                    // observer covers schedules arriving between map
-                    // evaluations.
-                    storage.push_pulled_child_schedule(
-                        next, entry->schedule_context);
-                }
-                else
-                {
-                    // Invalidate a lazy entry when the child consumed or
-                    // cancelled its previous deadline.
-                    entry->schedule_context.pulled_when = MAX_DT;
-                }
+                pull_map_child_schedule(storage, *entry, child, evaluation_time);
             }
             storage.resume_position_plus_one = 0;
             storage.evaluation_slots.clear();
@@ -1337,6 +1548,39 @@ namespace hgraph
         return true;
     }
 
+    std::size_t MapNodeView::recycled_child_graph_count() const noexcept
+    {
+        const auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
+        return storage.entries.retained_graph_count() + storage.previous_entries.retained_graph_count();
+    }
+
+    const ValueTypeMetaData *MapNodeView::key_schema() const
+    {
+        const auto &context = *static_cast<const MapNodeContext *>(context_);
+        const auto *keys_schema = TypeRegistry::instance().dereference(
+            view_.schema()->input_schema->fields()[*context.spec.keys_input_index].type);
+        return keys_schema->value_schema->element_type;
+    }
+
+    void MapNodeView::for_each_child(const std::function<void(const ValueView &, const GraphView &)> &visit) const
+    {
+        const auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
+        for (std::size_t slot = 0; slot < storage.entries.slot_capacity(); ++slot)
+        {
+            const auto *entry = storage.entries.entry_at(slot);
+            if (entry != nullptr && entry->graph.has_value() && entry->graph.view().started())
+            {
+                visit(entry->key.view(), entry->graph.view());
+            }
+        }
+    }
+
+    void MapNodeView::stage_child_restore(Value key, std::function<void(const GraphView &)> restore) const
+    {
+        auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
+        storage.staged_child_restores.emplace_back(std::move(key), std::move(restore));
+    }
+
     MapNodeView::MapNodeView(NodeView view, const void *context, void *storage) noexcept
         : view_(std::move(view)),
           context_(context),
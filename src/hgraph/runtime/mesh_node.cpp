@@ -172,6 +172,9 @@ struct MeshNodeStorage final : SlotObserver {
   // mesh_subscribe inside it reads this as its "my_key" (the requester).
   ValuePtr current_eval_key{};
   DateTime retirement_time{MIN_DT};
+  // Set while ``MeshNodeSpec::recycle_child_graphs`` is on: erased entries
+  // hand their reset child to ``entries`` for the next key in that slot.
+  const GraphBuilder *recycle_builder{nullptr};
 
   void push_child_schedule(MeshChildSchedule schedule) {
     child_schedule_queue.push_back(schedule);
@@ -318,6 +321,21 @@ struct MeshNodeStorage final : SlotObserver {
 
   void on_insert(std::size_t) override {}
 
+  // ``on_remove`` already stopped the child; resetting it where the plain
+  // path destroys it drops its subscriptions at the same lifecycle point.
+  void retain_child_graph(std::size_t slot) noexcept {
+    MeshEntry *entry = entries.entry_at(slot);
+    if (recycle_builder == nullptr || entry == nullptr ||
+        !entries.can_retain_graph() || !entry->graph.has_value() ||
+        entry->graph.view().started()) {
+      return;
+    }
+    static_cast<void>(fallback_on_exception(false, [&] {
+      recycle_builder->reset_nested_graph(entry->graph);
+      return entries.retain_graph(slot, std::move(entry->graph));
+    }));
+  }
+
   void on_remove(std::size_t slot) override {
     MeshEntry *entry = entries.entry_at(slot);
     evaluation_candidates.reset(slot);
@@ -333,7 +351,10 @@ struct MeshNodeStorage final : SlotObserver {
     }
   }
 
-  void on_erase(std::size_t slot) override { entries.destroy_at(slot); }
+  void on_erase(std::size_t slot) override {
+    retain_child_graph(slot);
+    entries.destroy_at(slot);
+  }
   void on_clear() override {
     evaluation_candidates.reset();
     entries.destroy_all();
@@ -354,6 +375,10 @@ void initialise_mesh_storage(MeshNodeStorage &storage,
     throw std::logic_error("mesh_ has no resolved key binding");
   }
   storage.initialise(key_binding, context.graph_layout);
+  storage.entries.retained_graph_limit(context.spec.recycle_child_graphs);
+  storage.recycle_builder = context.spec.recycle_child_graphs != 0
+                                ? &context.spec.child.graph_builder
+                                : nullptr;
 }
 
 struct MeshSubscribeStorage {
@@ -801,6 +826,9 @@ MeshEntry &create_instance(const NodeView &view, const MeshNodeContext &context,
   });
   key_rollback.release();
 
+  if (!entry.graph.has_value()) {
+    entry.graph = storage.entries.take_retained_graph(slot);
+  }
   if (!entry.graph.has_value()) {
     entry.graph = spec.child.graph_builder.make_nested_graph(
         view.pointer(), storage.entries.graph_memory(slot),
@@ -1472,6 +1500,11 @@ std::size_t MeshNodeView::child_graph_count() const noexcept {
   return count;
 }
 
+std::size_t MeshNodeView::recycled_child_graph_count() const noexcept {
+  return MemoryUtils::cast<MeshNodeStorage>(storage_)
+      ->entries.retained_graph_count();
+}
+
 bool MeshNodeView::child_graphs_use_in_place_storage() const noexcept {
   const auto &storage = *MemoryUtils::cast<MeshNodeStorage>(storage_);
   for (std::size_t slot = 0; slot < storage.entries.slot_capacity(); ++slot) {
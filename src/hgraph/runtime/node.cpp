@@ -42,11 +42,13 @@ namespace hgraph
                 schedule_node_from_storage(graph, node_index, modified_time);
             }
 
+            // Hot fields first: evaluation reads them every cycle, while the
+            // label is only read for diagnostics.
             GraphValue   *graph{nullptr};
             std::size_t   node_index{0};
-            std::string   label{};
             bool          started{false};
             bool          starting{false};
+            std::string   label{};
         };
 
         [[nodiscard]] std::size_t node_runtime_graph_offset(const NodeTypeMetaData &schema)
@@ -900,7 +902,7 @@ namespace hgraph
             const bool          has_scheduler = runtime.layout.has_scheduler();
             NodeSchedulerState *scheduler     = has_scheduler ? &node_scheduler_state(runtime, view.data()) : nullptr;
             const bool          scheduled_now = scheduler != nullptr && !scheduler->events.empty() &&
-                                       scheduler->events.begin()->first == evaluation_time;
+                                       scheduler->events.top().when == evaluation_time;
 
             bool do_eval = ready_to_evaluate(view, evaluation_time);
 
@@ -0,0 +1,212 @@
+#include <hgraph/runtime/node_scheduler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace hgraph
+{
+    namespace
+    {
+        /**
+         * Process-wide interned tag table. Names live in a deque so the views
+         * handed out by ``SchedulerTag::name`` stay valid as the table grows.
+         * Lookups probe an open-addressed hash index published as an
+         * immutable snapshot, so ``find`` and ``name`` take no lock and
+         * cannot throw. Interning (wiring/start only) copies the index under
+         * the mutex and publishes the copy; superseded snapshots are retired,
+         * not freed, because a reader may still hold one.
+         */
+        class SchedulerTagTable
+        {
+          public:
+            [[nodiscard]] static SchedulerTagTable &instance()
+            {
+                static SchedulerTagTable table;
+                return table;
+            }
+
+            [[nodiscard]] std::uint32_t find(std::string_view name) const noexcept
+            {
+                const Index *index = index_.load(std::memory_order_acquire);
+                return index != nullptr ? index->find(name, hash(name)) : 0;
+            }
+
+            [[nodiscard]] std::uint32_t intern(std::string_view name)
+            {
+                const std::size_t name_hash = hash(name);
+                if (const Index *index = index_.load(std::memory_order_acquire); index != nullptr)
+                {
+                    if (const std::uint32_t id = index->find(name, name_hash); id != 0) { return id; }
+                }
+
+                std::lock_guard lock{mutex_};
+                const Index    *current = index_.load(std::memory_order_relaxed);
+                if (current != nullptr)
+                {
+                    if (const std::uint32_t id = current->find(name, name_hash); id != 0) { return id; }
+                }
+                const std::size_t count = current != nullptr ? current->names.size() : 0;
+                if (count + 1 >= SchedulerTag::local_bit)
+                {
+                    throw std::length_error("SchedulerTag: too many distinct scheduler tags");
+                }
+
+                auto next = std::make_unique<Index>();
+                if (current != nullptr)
+                {
+                    next->names  = current->names;
+                    next->hashes = current->hashes;
+                }
+                next->names.push_back(&names_.emplace_back(name));
+                next->hashes.push_back(name_hash);
+                next->rebuild();
+
+                retired_.push_back(std::move(next));
+                index_.store(retired_.back().get(), std::memory_order_release);
+                return static_cast<std::uint32_t>(count + 1);
+            }
+
+            [[nodiscard]] std::string_view name(std::uint32_t id) const noexcept
+            {
+                const Index *index = index_.load(std::memory_order_acquire);
+                if (id == 0 || index == nullptr || id > index->names.size()) { return {}; }
+                return *index->names[id - 1];
+            }
+
+          private:
+            struct Index
+            {
+                std::vector<const std::string *> names{};   // by id - 1
+                std::vector<std::size_t>         hashes{};  // by id - 1
+                std::vector<std::uint32_t>       slots{};   // ids by hash, 0 = empty; power-of-two size
+
+                [[nodiscard]] std::uint32_t find(std::string_view name, std::size_t name_hash) const noexcept
+                {
+                    const std::size_t mask = slots.size() - 1;
+                    for (std::size_t slot = name_hash & mask;; slot = (slot + 1) & mask)
+                    {
+                        const std::uint32_t id = slots[slot];
+                        if (id == 0) { return 0; }
+                        if (hashes[id - 1] == name_hash && *names[id - 1] == name) { return id; }
+                    }
+                }
+
+                void rebuild()
+                {
+                    // At most half full, so every probe meets an empty slot.
+                    slots.assign(std::bit_ceil(std::max<std::size_t>(names.size() * 2, 8)), 0);
+                    const std::size_t mask = slots.size() - 1;
+                    for (std::size_t id = 1; id <= names.size(); ++id)
+                    {
+                        std::size_t slot = hashes[id - 1] & mask;
+                        while (slots[slot] != 0) { slot = (slot + 1) & mask; }
+                        slots[slot] = static_cast<std::uint32_t>(id);
+                    }
+                }
+            };
+
+            [[nodiscard]] static std::size_t hash(std::string_view name) noexcept
+            {
+                return std::hash<std::string_view>{}(name);
+            }
+
+            std::mutex                          mutex_{};
+            std::deque<std::string>             names_{};
+            std::vector<std::unique_ptr<Index>> retired_{};
+            std::atomic<const Index *>          index_{nullptr};
+        };
+
+        [[nodiscard]] constexpr std::size_t local_slot(SchedulerTag tag) noexcept
+        {
+            return (tag.id() & ~SchedulerTag::local_bit) - 1;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t local_id(std::size_t slot) noexcept
+        {
+            return SchedulerTag::local_bit | static_cast<std::uint32_t>(slot + 1);
+        }
+    }  // namespace
+
+    SchedulerTag SchedulerTag::find(std::string_view name) noexcept
+    {
+        if (name.empty()) { return {}; }
+        return SchedulerTag{SchedulerTagTable::instance().find(name), 0};
+    }
+
+    std::string_view SchedulerTag::name() const noexcept
+    {
+        return local() ? std::string_view{} : SchedulerTagTable::instance().name(id_);
+    }
+
+    std::uint32_t SchedulerTag::intern(std::string_view name) { return SchedulerTagTable::instance().intern(name); }
+
+    // A pending event pins its name's id. Otherwise a name interned since it
+    // was recorded resolves to the interned id, so the name never holds two
+    // ids at once on this node.
+    SchedulerTag NodeSchedulerState::find_tag(std::string_view name) const noexcept
+    {
+        if (name.empty()) { return {}; }
+        const SchedulerTag interned = SchedulerTag::find(name);
+        for (const RuntimeTag &entry : runtime_tags)
+        {
+            if (entry.name != name) { continue; }
+            if (interned.tagged() && events.find(entry.tag) == SchedulerEventHeap::npos) { return interned; }
+            return entry.tag;
+        }
+        return interned;
+    }
+
+    SchedulerTag NodeSchedulerState::tag(std::string_view name)
+    {
+        if (name.empty()) { return {}; }
+        const auto pending = [this](const RuntimeTag &entry) {
+            return events.find(entry.tag) != SchedulerEventHeap::npos;
+        };
+
+        const SchedulerTag interned = SchedulerTag::find(name);
+        std::size_t        free     = runtime_tags.size();
+        for (std::size_t slot = 0; slot < runtime_tags.size(); ++slot)
+        {
+            RuntimeTag &entry = runtime_tags[slot];
+            if (pending(entry))
+            {
+                if (entry.name == name) { return entry.tag; }
+                continue;
+            }
+            if (entry.name == name)
+            {
+                entry.tag = interned.tagged() ? interned : SchedulerTag{local_id(slot), 0};
+                return entry.tag;
+            }
+            free = std::min(free, slot);
+        }
+
+        if (free == runtime_tags.size())
+        {
+            if (free + 1 >= SchedulerTag::local_bit)
+            {
+                throw std::length_error("NodeSchedulerState: too many pending node-local scheduler tags");
+            }
+            runtime_tags.emplace_back();
+        }
+        RuntimeTag &entry = runtime_tags[free];
+        entry.name.assign(name);
+        entry.tag = interned.tagged() ? interned : SchedulerTag{local_id(free), 0};
+        return entry.tag;
+    }
+
+    std::string_view NodeSchedulerState::tag_name(SchedulerTag tag) const noexcept
+    {
+        if (!tag.local()) { return tag.name(); }
+        const std::size_t slot = local_slot(tag);
+        if (slot >= runtime_tags.size() || runtime_tags[slot].tag != tag) { return {}; }
+        return runtime_tags[slot].name;
+    }
+}  // namespace hgraph
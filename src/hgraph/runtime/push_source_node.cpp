@@ -5,13 +5,20 @@
 #include <hgraph/types/time_series/ts_output.h>
 #include <hgraph/util/scope.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -21,6 +28,17 @@ namespace hgraph
     {
         const DateTime push_conflation_time{MIN_ST};
 
+        /** Steady-clock stamp taken when a sender hands a value to the policy. */
+        using PushEnqueueTime = std::chrono::steady_clock::time_point;
+
+        /** What one ``emit_next`` applied to the output. */
+        struct PushSourceEmit
+        {
+            bool                           more_pending{false};
+            /** Enqueue stamp of the oldest value applied; empty when nothing was. */
+            std::optional<PushEnqueueTime> enqueued{};
+        };
+
         struct PushSourcePolicyOps
         {
             const MemoryUtils::StoragePlan *storage_plan{nullptr};
@@ -33,24 +51,41 @@ namespace hgraph
                                const TSValueTypeMetaData &output_schema) = nullptr;
             void (*stop_impl)(const void *context, void *storage) = nullptr;
             bool (*send_impl)(const void *context, void *storage, Value value) = nullptr;
-            bool (*emit_next_impl)(const void *context,
-                                                 void *storage,
-                                                 const TSOutputView &output) = nullptr;
+            PushSourceEmit (*emit_next_impl)(const void *context,
+                                             void *storage,
+                                             const TSOutputView &output) = nullptr;
             std::size_t (*pending_items_impl)(const void *context,
                                              const void *storage) noexcept = nullptr;
         };
 
         struct PushSourceQueuePop
         {
-            Value value{};
-            bool  more_pending{false};
+            Value           value{};
+            PushEnqueueTime enqueued{};
+            bool            more_pending{false};
         };
 
         struct PushSourcePolicyContext
         {
             const ValueTypeMetaData *sender_schema{nullptr};
+            /** Requested slot count; only the bounded queue policy reads it. */
+            std::size_t              capacity{0};
         };
 
+        void validate_sender_value(const PushSourcePolicyContext &context, const Value &value)
+        {
+            if (!value.has_value())
+            {
+                throw std::invalid_argument("PushSourceSender requires a live value payload");
+            }
+            const auto &value_schema = *value.schema();
+            if (&value_schema != context.sender_schema)
+            {
+                throw std::invalid_argument(
+                    "PushSourceSender value schema does not match the push-source sender schema");
+            }
+        }
+
         struct QueuePolicyStorage
         {
             void start()
@@ -69,20 +104,12 @@ namespace hgraph
 
             [[nodiscard]] bool send(const PushSourcePolicyContext &context, Value value)
             {
-                std::lock_guard lock{mutex};
+                const PushEnqueueTime enqueued = std::chrono::steady_clock::now();
+                std::lock_guard       lock{mutex};
                 if (!accepting) { return false; }
-                if (!value.has_value())
-                {
-                    throw std::invalid_argument("PushSourceSender requires a live value payload");
-                }
-                const auto &value_schema = *value.schema();
-                if (&value_schema != context.sender_schema)
-                {
-                    throw std::invalid_argument(
-                        "PushSourceSender value schema does not match the push-source sender schema");
-                }
+                validate_sender_value(context, value);
 
-                values.push_back(std::move(value));
+                values.push_back(QueuedValue{.value = std::move(value), .enqueued = enqueued});
                 return true;
             }
 
@@ -92,7 +119,8 @@ namespace hgraph
                 if (values.empty()) { return std::nullopt; }
 
                 PushSourceQueuePop result{
-                    .value = std::move(values.front()),
+                    .value = std::move(values.front().value),
+                    .enqueued = values.front().enqueued,
                     .more_pending = false,
                 };
                 values.pop_front();
@@ -106,9 +134,167 @@ namespace hgraph
                 return values.size();
             }
 
-            mutable std::mutex mutex{};
-            std::deque<Value>  values{};
-            bool               accepting{false};
+            struct QueuedValue
+            {
+                Value           value{};
+                PushEnqueueTime enqueued{};
+            };
+
+            mutable std::mutex       mutex{};
+            std::deque<QueuedValue>  values{};
+            bool                     accepting{false};
+        };
+
+        /**
+         * Bounded multi-producer / single-consumer ring (sequence-stamped
+         * slots). Each slot's sequence tells producers and the evaluation
+         * thread whose turn it is, so handing a value over is one CAS on
+         * ``tail`` plus a release store; the consumer side is wait-free.
+         *
+         * ``signalled`` is the wake-up latch: the first publish after the
+         * consumer drained the ring flips it and reports a ready update to
+         * the executor; later publishes see it set and skip the executor
+         * entirely. The consumer re-opens the latch only once the ring is
+         * empty and re-checks afterwards, so a racing publish is never lost.
+         */
+        struct BoundedQueuePolicyStorage
+        {
+            struct alignas(std::hardware_destructive_interference_size) Slot
+            {
+                std::atomic<std::size_t> sequence{0};
+                Value                    value{};
+                PushEnqueueTime          enqueued{};
+            };
+
+            void start(const PushSourcePolicyContext &context)
+            {
+                const std::size_t requested = std::bit_ceil(std::max<std::size_t>(context.capacity, 2));
+                if (requested != capacity)
+                {
+                    slots = std::make_unique<Slot[]>(requested);
+                    capacity = requested;
+                }
+                for (std::size_t index = 0; index < capacity; ++index)
+                {
+                    slots[index].sequence.store(index, std::memory_order_relaxed);
+                    slots[index].value = Value{};
+                }
+                head.store(0, std::memory_order_relaxed);
+                tail.store(0, std::memory_order_relaxed);
+                signalled.store(false, std::memory_order_relaxed);
+                consumer.store(std::this_thread::get_id(), std::memory_order_relaxed);
+                accepting.store(true, std::memory_order_release);
+            }
+
+            void stop()
+            {
+                // Sequentially consistent pairing with ``send``: either the
+                // sender sees the flag cleared or stop sees it in flight and
+                // waits before the slots are released.
+                accepting.store(false);
+                while (active_senders.load() != 0) { std::this_thread::yield(); }
+                for (std::size_t index = 0; index < capacity; ++index) { slots[index].value = Value{}; }
+                head.store(tail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] bool send(const PushSourcePolicyContext &context, Value value)
+            {
+                const PushEnqueueTime enqueued = std::chrono::steady_clock::now();
+                active_senders.fetch_add(1);
+                auto release_sender = make_scope_exit(
+                    [&]() noexcept { active_senders.fetch_sub(1, std::memory_order_release); });
+                if (!accepting.load()) { return false; }
+                validate_sender_value(context, value);
+
+                std::size_t position = tail.load(std::memory_order_relaxed);
+                Slot       *slot = nullptr;
+                for (;;)
+                {
+                    slot = &slots[position & (capacity - 1)];
+                    const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                    const auto distance =
+                        static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+                    if (distance == 0)
+                    {
+                        if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+                    }
+                    else if (distance < 0)
+                    {
+                        // Full: back-pressure the sender until the evaluation
+                        // thread frees a slot (or the node stops). The
+                        // evaluation thread itself can never free one while
+                        // it waits here, so it fails instead of hanging.
+                        if (!accepting.load(std::memory_order_acquire)) { return false; }
+                        if (consumer.load(std::memory_order_relaxed) == std::this_thread::get_id())
+                        {
+                            throw std::logic_error(
+                                "PushSourceSender: bounded push-source queue is full and the send came from the "
+                                "evaluation thread that drains it");
+                        }
+                        std::this_thread::yield();
+                        position = tail.load(std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        position = tail.load(std::memory_order_relaxed);
+                    }
+                }
+
+                slot->value    = std::move(value);
+                slot->enqueued = enqueued;
+                slot->sequence.store(position + 1, std::memory_order_release);
+                return !signalled.exchange(true, std::memory_order_acq_rel);
+            }
+
+            [[nodiscard]] std::optional<PushSourceQueuePop> try_pop()
+            {
+                consumer.store(std::this_thread::get_id(), std::memory_order_relaxed);
+                if (capacity == 0 || (!ready() && disarm())) { return std::nullopt; }
+
+                const std::size_t position = head.load(std::memory_order_relaxed);
+                Slot &slot = slots[position & (capacity - 1)];
+                PushSourceQueuePop result{
+                    .value = std::move(slot.value),
+                    .enqueued = slot.enqueued,
+                    .more_pending = false,
+                };
+                slot.value = Value{};
+                slot.sequence.store(position + capacity, std::memory_order_release);
+                head.store(position + 1, std::memory_order_relaxed);
+                result.more_pending = ready() || !disarm();
+                return result;
+            }
+
+            [[nodiscard]] std::size_t pending_items() const noexcept
+            {
+                const std::size_t produced = tail.load(std::memory_order_acquire);
+                const std::size_t consumed = head.load(std::memory_order_acquire);
+                return produced > consumed ? produced - consumed : 0U;
+            }
+
+            /** The slot under ``head`` holds a published value. */
+            [[nodiscard]] bool ready() const noexcept
+            {
+                const std::size_t position = head.load(std::memory_order_relaxed);
+                return slots[position & (capacity - 1)].sequence.load(std::memory_order_acquire) == position + 1;
+            }
+
+            /** Re-open the wake-up latch on an empty ring; false when a value raced in. */
+            [[nodiscard]] bool disarm() noexcept
+            {
+                static_cast<void>(signalled.exchange(false, std::memory_order_acq_rel));
+                return !ready();
+            }
+
+            std::unique_ptr<Slot[]>                              slots{};
+            std::size_t                                          capacity{0};
+            alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> tail{0};
+            alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> head{0};
+            std::atomic<bool>                                    signalled{false};
+            std::atomic<bool>                                    accepting{false};
+            std::atomic<std::size_t>                             active_senders{0};
+            /** Thread that last started or drained the ring: the evaluation thread. */
+            std::atomic<std::thread::id>                         consumer{};
         };
 
         struct ConflatingPolicyStorage
@@ -120,6 +306,7 @@ namespace hgraph
                 accumulator = TSOutput{schema};
                 accepting = true;
                 pending = false;
+                first_enqueued.reset();
                 next_mutation_time = MIN_ST;
             }
 
@@ -128,6 +315,7 @@ namespace hgraph
                 std::lock_guard lock{mutex};
                 accepting = false;
                 pending = false;
+                first_enqueued.reset();
                 accumulator = TSOutput{};
                 output_schema = nullptr;
                 next_mutation_time = MIN_ST;
@@ -135,34 +323,37 @@ namespace hgraph
 
             [[nodiscard]] bool send(const PushSourcePolicyContext &context, Value value)
             {
-                std::lock_guard lock{mutex};
+                const PushEnqueueTime enqueued = std::chrono::steady_clock::now();
+                std::lock_guard       lock{mutex};
                 if (!accepting) { return false; }
-                if (!value.has_value())
-                {
-                    throw std::invalid_argument("PushSourceSender requires a live value payload");
-                }
-                const auto &value_schema = *value.schema();
-                if (&value_schema != context.sender_schema)
-                {
-                    throw std::invalid_argument(
-                        "PushSourceSender value schema does not match the push-source sender schema");
-                }
+                validate_sender_value(context, value);
 
                 const DateTime mutation_time = next_mutation_time;
                 next_mutation_time += MIN_TD;
                 apply_delta(accumulator.view(mutation_time), value.view());
                 pending = pending || accumulator.view(mutation_time).modified();
+                if (pending && !first_enqueued.has_value()) { first_enqueued = enqueued; }
                 return pending;
             }
 
-            [[nodiscard]] std::optional<TSOutput> take_accumulated()
+            struct Accumulated
+            {
+                TSOutput        output{};
+                PushEnqueueTime enqueued{};
+            };
+
+            [[nodiscard]] std::optional<Accumulated> take_accumulated()
             {
                 std::lock_guard lock{mutex};
                 if (!pending) { return std::nullopt; }
 
-                std::optional<TSOutput> result{std::move(accumulator)};
+                std::optional<Accumulated> result{Accumulated{
+                    .output = std::move(accumulator),
+                    .enqueued = first_enqueued.value_or(PushEnqueueTime{}),
+                }};
                 accumulator = TSOutput{*output_schema};
                 pending = false;
+                first_enqueued.reset();
                 next_mutation_time = MIN_ST;
                 return result;
             }
@@ -177,6 +368,8 @@ namespace hgraph
             TSOutput                    accumulator{};
             const TSValueTypeMetaData  *output_schema{nullptr};
             DateTime                    next_mutation_time{MIN_ST};
+            /** Enqueue stamp of the first send folded into the pending batch. */
+            std::optional<PushEnqueueTime> first_enqueued{};
             bool                        accepting{false};
             bool                        pending{false};
         };
@@ -215,7 +408,7 @@ namespace hgraph
             throw_unconfigured_policy();
         }
 
-        [[nodiscard]] bool default_policy_emit_next(const void *, void *, const TSOutputView &)
+        [[nodiscard]] detail::PushSourceEmit default_policy_emit_next(const void *, void *, const TSOutputView &)
         {
             throw_unconfigured_policy();
         }
@@ -253,10 +446,10 @@ namespace hgraph
         }
 
         [[nodiscard]] const detail::PushSourcePolicyContext &register_policy_context(
-            const ValueTypeMetaData &sender_schema)
+            const ValueTypeMetaData &sender_schema, std::size_t capacity = 0)
         {
             auto context = std::make_unique<detail::PushSourcePolicyContext>(
-                detail::PushSourcePolicyContext{.sender_schema = &sender_schema});
+                detail::PushSourcePolicyContext{.sender_schema = &sender_schema, .capacity = capacity});
             const auto *result = context.get();
             policy_contexts().push_back(std::move(context));
             return *result;
@@ -290,15 +483,15 @@ namespace hgraph
                 std::move(value));
         }
 
-        [[nodiscard]] bool queue_policy_emit_next(const void *,
-                                                  void *storage,
-                                                  const TSOutputView &output)
+        [[nodiscard]] detail::PushSourceEmit queue_policy_emit_next(const void *,
+                                                                    void *storage,
+                                                                    const TSOutputView &output)
         {
             auto item = MemoryUtils::cast<detail::QueuePolicyStorage>(storage)->try_pop();
-            if (!item.has_value()) { return false; }
+            if (!item.has_value()) { return {}; }
 
             apply_delta(output, item->value.view());
-            return item->more_pending;
+            return {.more_pending = item->more_pending, .enqueued = item->enqueued};
         }
 
         [[nodiscard]] std::size_t queue_policy_pending_items(
@@ -308,6 +501,41 @@ namespace hgraph
                 ->pending_items();
         }
 
+        void bounded_queue_policy_start(const void *context, void *storage, const TSValueTypeMetaData &)
+        {
+            MemoryUtils::cast<detail::BoundedQueuePolicyStorage>(storage)->start(policy_context(context));
+        }
+
+        void bounded_queue_policy_stop(const void *, void *storage)
+        {
+            MemoryUtils::cast<detail::BoundedQueuePolicyStorage>(storage)->stop();
+        }
+
+        [[nodiscard]] bool bounded_queue_policy_send(const void *context, void *storage, Value value)
+        {
+            return MemoryUtils::cast<detail::BoundedQueuePolicyStorage>(storage)->send(
+                policy_context(context),
+                std::move(value));
+        }
+
+        [[nodiscard]] detail::PushSourceEmit bounded_queue_policy_emit_next(const void *,
+                                                                            void *storage,
+                                                                            const TSOutputView &output)
+        {
+            auto item = MemoryUtils::cast<detail::BoundedQueuePolicyStorage>(storage)->try_pop();
+            if (!item.has_value()) { return {}; }
+
+            apply_delta(output, item->value.view());
+            return {.more_pending = item->more_pending, .enqueued = item->enqueued};
+        }
+
+        [[nodiscard]] std::size_t bounded_queue_policy_pending_items(
+            const void *, const void *storage) noexcept
+        {
+            return MemoryUtils::cast<const detail::BoundedQueuePolicyStorage>(storage)
+                ->pending_items();
+        }
+
         void conflating_policy_start(const void *, void *storage, const TSValueTypeMetaData &output_schema)
         {
             MemoryUtils::cast<detail::ConflatingPolicyStorage>(storage)->start(output_schema);
@@ -325,15 +553,15 @@ namespace hgraph
                 std::move(value));
         }
 
-        [[nodiscard]] bool conflating_policy_emit_next(const void *,
-                                                       void *storage,
-                                                       const TSOutputView &output)
+        [[nodiscard]] detail::PushSourceEmit conflating_policy_emit_next(const void *,
+                                                                         void *storage,
+                                                                         const TSOutputView &output)
         {
             auto accumulated = MemoryUtils::cast<detail::ConflatingPolicyStorage>(storage)->take_accumulated();
-            if (!accumulated.has_value()) { return false; }
+            if (!accumulated.has_value()) { return {}; }
 
-            apply_current_value(output, accumulated->view(detail::push_conflation_time).value());
-            return false;
+            apply_current_value(output, accumulated->output.view(detail::push_conflation_time).value());
+            return {.more_pending = false, .enqueued = accumulated->enqueued};
         }
 
         [[nodiscard]] std::size_t conflating_policy_pending_items(
@@ -358,6 +586,21 @@ namespace hgraph
             return ops;
         }
 
+        [[nodiscard]] const detail::PushSourcePolicyOps &bounded_queue_policy_ops()
+        {
+            static const detail::PushSourcePolicyOps ops{
+                .storage_plan = &MemoryUtils::plan_for<detail::BoundedQueuePolicyStorage>(),
+                .sender_schema_impl = &sender_schema_impl,
+                .output_compatible_impl = &delta_output_compatible,
+                .start_impl = &bounded_queue_policy_start,
+                .stop_impl = &bounded_queue_policy_stop,
+                .send_impl = &bounded_queue_policy_send,
+                .emit_next_impl = &bounded_queue_policy_emit_next,
+                .pending_items_impl = &bounded_queue_policy_pending_items,
+            };
+            return ops;
+        }
+
         [[nodiscard]] const detail::PushSourcePolicyOps &conflating_policy_ops()
         {
             static const detail::PushSourcePolicyOps ops{
@@ -373,11 +616,20 @@ namespace hgraph
             return ops;
         }
 
+        constexpr std::string_view push_source_state_field_name{"push_source_state"};
+
+        /** Per-node bookkeeping outside the policy storage; eval-thread only. */
+        struct PushSourceNodeState
+        {
+            std::optional<detail::PushEnqueueTime> applied_enqueue_time{};
+        };
+
         struct PushSourceNodeContext
         {
             const TSValueTypeMetaData *output_schema{nullptr};
             PushSourcePolicy           policy{};
             std::size_t                policy_storage_offset{0};
+            std::size_t                state_offset{0};
             PushSourceStartCallback    on_start{};
         };
 
@@ -391,12 +643,14 @@ namespace hgraph
             const TSValueTypeMetaData &output_schema,
             PushSourcePolicy policy,
             std::size_t policy_storage_offset,
+            std::size_t state_offset,
             PushSourceStartCallback on_start)
         {
             auto context = std::make_unique<PushSourceNodeContext>(PushSourceNodeContext{
                 .output_schema = &output_schema,
                 .policy = policy,
                 .policy_storage_offset = policy_storage_offset,
+                .state_offset = state_offset,
                 .on_start = std::move(on_start),
             });
             const auto *result = context.get();
@@ -415,6 +669,17 @@ namespace hgraph
             return MemoryUtils::advance(memory, context.policy_storage_offset);
         }
 
+        [[nodiscard]] PushSourceNodeState &node_state(const PushSourceNodeContext &context, void *memory)
+        {
+            return *MemoryUtils::cast<PushSourceNodeState>(MemoryUtils::advance(memory, context.state_offset));
+        }
+
+        [[nodiscard]] const PushSourceNodeState &node_state(const PushSourceNodeContext &context,
+                                                            const void *memory)
+        {
+            return *MemoryUtils::cast<const PushSourceNodeState>(MemoryUtils::advance(memory, context.state_offset));
+        }
+
         [[nodiscard]] NodeInspectionMetrics push_source_inspection_metrics(
             const void *raw_context, const void *memory) noexcept
         {
@@ -422,6 +687,7 @@ namespace hgraph
             return NodeInspectionMetrics{
                 .pending_items = detail::PushSourcePolicyAccess::pending_items(
                     context.policy, policy_storage(context, memory)),
+                .applied_enqueue_time = node_state(context, memory).applied_enqueue_time,
             };
         }
 
@@ -446,11 +712,12 @@ namespace hgraph
         void push_source_eval(const PushSourceNodeContext &context, const NodeView &view, DateTime evaluation_time)
         {
             void *storage = policy_storage(context, view.data());
-            const bool more_pending = detail::PushSourcePolicyAccess::emit_next(
+            const detail::PushSourceEmit emitted = detail::PushSourcePolicyAccess::emit_next(
                 context.policy,
                 storage,
                 view.output(evaluation_time));
-            if (more_pending)
+            node_state(context, view.data()).applied_enqueue_time = emitted.enqueued;
+            if (emitted.more_pending)
             {
                 view.graph().root().executor().push_queue_engine().mark_push_update_pending();
             }
@@ -459,14 +726,16 @@ namespace hgraph
         void push_source_stop(const PushSourceNodeContext &context, const NodeView &view)
         {
             detail::PushSourcePolicyAccess::stop(context.policy, policy_storage(context, view.data()));
+            node_state(context, view.data()).applied_enqueue_time.reset();
         }
 
         [[nodiscard]] PushSourcePolicy make_policy(const detail::PushSourcePolicyOps &ops,
-                                                   const ValueTypeMetaData &sender_schema)
+                                                   const ValueTypeMetaData &sender_schema,
+                                                   std::size_t capacity = 0)
         {
             return detail::PushSourcePolicyAccess::make_policy(
                 &ops,
-                &register_policy_context(sender_schema));
+                &register_policy_context(sender_schema, capacity));
         }
     }  // namespace
 
@@ -551,9 +820,9 @@ namespace hgraph
         policy.ops_->stop_impl(policy.context_, storage);
     }
 
-    bool detail::PushSourcePolicyAccess::emit_next(const PushSourcePolicy &policy,
-                                                   void *storage,
-                                                   const TSOutputView &output)
+    detail::PushSourceEmit detail::PushSourcePolicyAccess::emit_next(const PushSourcePolicy &policy,
+                                                                     void *storage,
+                                                                     const TSOutputView &output)
     {
         return policy.ops_->emit_next_impl(policy.context_, storage, output);
     }
@@ -593,6 +862,8 @@ namespace hgraph
                 return make_policy(queue_policy_ops(), sender_schema);
             case PushSourcePolicyKind::Conflating:
                 return make_policy(conflating_policy_ops(), sender_schema);
+            case PushSourcePolicyKind::BoundedQueue:
+                return make_push_source_bounded_queue_policy(sender_schema);
         }
         throw std::invalid_argument("Unknown push-source policy kind");
     }
@@ -607,6 +878,16 @@ namespace hgraph
         return make_push_source_policy(PushSourcePolicyKind::Conflating, sender_schema);
     }
 
+    PushSourcePolicy make_push_source_bounded_queue_policy(const ValueTypeMetaData &sender_schema,
+                                                           std::size_t capacity)
+    {
+        if (capacity == 0)
+        {
+            throw std::invalid_argument("Bounded push-source queue capacity must be positive");
+        }
+        return make_policy(bounded_queue_policy_ops(), sender_schema, capacity);
+    }
+
     namespace
     {
         NodeBuilder make_push_source_node_with_capability(
@@ -633,12 +914,17 @@ namespace hgraph
                     push_source_policy_field_name,
                     &detail::PushSourcePolicyAccess::storage_plan(policy),
                 },
+                NodeStorageField{
+                    push_source_state_field_name,
+                    &MemoryUtils::plan_for<PushSourceNodeState>(),
+                },
             };
             const auto &plan = node_storage_plan_for(schema, fields);
             const auto *context = &register_push_source_node_context(
                 output_schema,
                 policy,
                 plan.component(push_source_policy_field_name).offset,
+                plan.component(push_source_state_field_name).offset,
                 std::move(on_start));
 
             NodeCallbacks callbacks;
@@ -18,12 +18,29 @@ constexpr std::string_view switch_storage_field_name{"switch"};
 constexpr std::string_view switch_graph_memory_field_name{
     "switch_graph_memory"};
 
+// A stopped branch graph held for re-selection of ``key``.
+struct SwitchCachedBranch {
+  Value key{};
+  const SingleNestedGraphNodeSpec *spec{nullptr};
+  GraphValue graph{};
+  std::size_t memory_slot{0};
+};
+
 struct SwitchNodeStorage {
   std::array<GraphValue, 2> graphs{};
+  // Graph-memory slot backing each entry of ``graphs``. Without a branch
+  // cache these are the two fixed slots; with one, a graph keeps its memory
+  // slot as it moves between the cache and the active/previous entries.
+  std::array<std::size_t, 2> graph_memory_slots{0, 1};
   std::optional<std::size_t> active_slot{};
   std::optional<std::size_t> previous_slot{};
   Value active_key{};
   const SingleNestedGraphNodeSpec *active_spec{nullptr};
+  // Stopped branch graphs, least recently used first.
+  std::vector<SwitchCachedBranch> cached{};
+  std::size_t cache_hits{0};
+  std::size_t cache_misses{0};
+  std::size_t cache_evictions{0};
 
   [[nodiscard]] GraphValue *active_graph() noexcept {
     return active_slot.has_value() ? &graphs[*active_slot] : nullptr;
@@ -35,6 +52,7 @@ struct SwitchNodeContext {
   std::size_t storage_offset{0};
   std::size_t graph_memory_offset{0};
   std::size_t graph_slot_stride{0};
+  std::size_t graph_slot_count{2};
   MemoryUtils::StorageLayout graph_slot_layout{};
 };
 
@@ -69,12 +87,14 @@ switch_node_contexts() noexcept {
 register_switch_node_context(SwitchNodeSpec spec, std::size_t storage_offset,
                              std::size_t graph_memory_offset,
                              std::size_t graph_slot_stride,
+                             std::size_t graph_slot_count,
                              MemoryUtils::StorageLayout graph_slot_layout) {
   auto context = std::make_unique<SwitchNodeContext>(SwitchNodeContext{
       .spec = std::move(spec),
       .storage_offset = storage_offset,
       .graph_memory_offset = graph_memory_offset,
       .graph_slot_stride = graph_slot_stride,
+      .graph_slot_count = graph_slot_count,
       .graph_slot_layout = graph_slot_layout,
   });
   const auto *result = context.get();
@@ -94,8 +114,8 @@ register_switch_node_context(SwitchNodeSpec spec, std::size_t storage_offset,
     }
   }
   return NodeStorageMetrics{
-      .nested_graph_count = count,
-      .nested_graph_capacity = storage.graphs.size(),
+      .nested_graph_count = count + storage.cached.size(),
+      .nested_graph_capacity = context.graph_slot_count,
   };
 }
 
@@ -107,6 +127,83 @@ register_switch_node_context(SwitchNodeSpec spec, std::size_t storage_offset,
                                   slot * context.graph_slot_stride);
 }
 
+[[nodiscard]] std::size_t
+free_graph_memory_slot(const SwitchNodeContext &context,
+                       const SwitchNodeStorage &storage) {
+  for (std::size_t slot = 0; slot < context.graph_slot_count; ++slot) {
+    const bool held = (storage.graphs[0].has_value() &&
+                       storage.graph_memory_slots[0] == slot) ||
+                      (storage.graphs[1].has_value() &&
+                       storage.graph_memory_slots[1] == slot) ||
+                      std::ranges::any_of(storage.cached,
+                                          [slot](const SwitchCachedBranch &entry) {
+                                            return entry.memory_slot == slot;
+                                          });
+    if (!held) {
+      return slot;
+    }
+  }
+  throw std::logic_error("switch_ has no free graph memory slot");
+}
+
+// Move the child stopped by this switch out of the previous entry into the
+// branch cache. Every other cached graph was stopped on an earlier switch, so
+// evicting the least recently used one keeps the same stop-then-destroy
+// spacing as the previous slot.
+void cache_previous_branch(const SwitchNodeContext &context,
+                           SwitchNodeStorage &storage, Value key,
+                           const SingleNestedGraphNodeSpec *spec) {
+  if (context.spec.branch_cache_size == 0 ||
+      !storage.previous_slot.has_value() || spec == nullptr) {
+    return;
+  }
+  const std::size_t slot = *storage.previous_slot;
+  if (!storage.graphs[slot].has_value()) {
+    return;
+  }
+  if (storage.cached.size() == context.spec.branch_cache_size) {
+    storage.cached.erase(storage.cached.begin());
+    ++storage.cache_evictions;
+  }
+  storage.cached.push_back(SwitchCachedBranch{
+      .key = std::move(key),
+      .spec = spec,
+      .graph = std::move(storage.graphs[slot]),
+      .memory_slot = storage.graph_memory_slots[slot],
+  });
+  storage.previous_slot.reset();
+}
+
+// Build the graph for ``spec`` in holder ``next_slot``: a cached graph for
+// ``key`` is reset in place, otherwise a new graph is constructed in a free
+// memory slot.
+void construct_branch_graph(const NodeView &view,
+                            const SwitchNodeContext &context,
+                            SwitchNodeStorage &storage, std::size_t next_slot,
+                            const SingleNestedGraphNodeSpec &spec,
+                            const Value &key) {
+  if (context.spec.branch_cache_size != 0) {
+    const auto cached = std::ranges::find_if(
+        storage.cached, [&](const SwitchCachedBranch &entry) {
+          return entry.spec == &spec && entry.key.equals(key);
+        });
+    if (cached != storage.cached.end()) {
+      storage.graph_memory_slots[next_slot] = cached->memory_slot;
+      storage.graphs[next_slot] = std::move(cached->graph);
+      storage.cached.erase(cached);
+      ++storage.cache_hits;
+      spec.graph_builder.reset_nested_graph(storage.graphs[next_slot]);
+      return;
+    }
+    ++storage.cache_misses;
+  }
+  const std::size_t memory_slot = free_graph_memory_slot(context, storage);
+  storage.graph_memory_slots[next_slot] = memory_slot;
+  storage.graphs[next_slot] = spec.graph_builder.make_nested_graph(
+      view.pointer(), switch_graph_memory(view, context, memory_slot),
+      context.graph_slot_layout);
+}
+
 void bind_branch_inputs(const NodeView &view,
                         const SingleNestedGraphNodeSpec &spec,
                         const GraphView &child, DateTime evaluation_time,
@@ -303,9 +400,7 @@ void activate_branch(const NodeView &view, const SwitchNodeContext &context,
   }
   storage.graphs[next_slot] = GraphValue{};
   storage.previous_slot.reset();
-  storage.graphs[next_slot] = spec.graph_builder.make_nested_graph(
-      view.pointer(), switch_graph_memory(view, context, next_slot),
-      context.graph_slot_layout);
+  construct_branch_graph(view, context, storage, next_slot, spec, key);
 
   auto next = storage.graphs[next_slot].view();
   auto construction_rollback =
@@ -313,6 +408,8 @@ void activate_branch(const NodeView &view, const SwitchNodeContext &context,
   bind_branch_inputs(view, spec, next, evaluation_time, true);
   construction_rollback.release();
 
+  Value retired_key = std::move(storage.active_key);
+  const SingleNestedGraphNodeSpec *retired_spec = storage.active_spec;
   if (context.spec.output_forwards_to_child_terminal) {
     GraphValue *active = storage.active_graph();
     bind_branch_output(view, context, spec, next, evaluation_time, true);
@@ -326,6 +423,8 @@ void activate_branch(const NodeView &view, const SwitchNodeContext &context,
   } else {
     switch_teardown(view, context, storage, evaluation_time);
   }
+  cache_previous_branch(context, storage, std::move(retired_key),
+                        retired_spec);
   storage.active_slot = next_slot;
   storage.active_key = std::move(key);
   storage.active_spec = &spec;
@@ -451,7 +550,25 @@ bool SwitchNodeView::child_graphs_use_in_place_storage() const noexcept {
       return false;
     }
   }
-  return true;
+  return std::ranges::all_of(
+      storage.cached, [](const SwitchCachedBranch &entry) {
+        return entry.graph.uses_external_storage();
+      });
+}
+
+SwitchBranchCacheMetrics SwitchNodeView::branch_cache_metrics() const noexcept {
+  const auto &context = *static_cast<const SwitchNodeContext *>(context_);
+  const auto &storage = *MemoryUtils::cast<SwitchNodeStorage>(storage_);
+  const std::size_t capacity = context.spec.branch_cache_size;
+  return SwitchBranchCacheMetrics{
+      .capacity = capacity,
+      .cached_graph_count = storage.cached.size(),
+      .reserved_bytes = capacity * context.graph_slot_stride,
+      .live_bytes = storage.cached.size() * context.graph_slot_stride,
+      .hits = storage.cache_hits,
+      .misses = storage.cache_misses,
+      .evictions = storage.cache_evictions,
+  };
 }
 
 SwitchNodeView::SwitchNodeView(NodeView view, const void *context,
@@ -505,7 +622,10 @@ NodeBuilder switch_node(NodeTypeMetaData meta, SwitchNodeSpec spec) {
       switch_graph_slot_layout(spec);
   const auto &graph_slot_plan =
       MemoryUtils::raw_storage_plan(graph_slot_layout);
-  const auto &graph_memory_plan = MemoryUtils::array_plan(graph_slot_plan, 2);
+  // Active and previous slots, plus one per cached branch.
+  const std::size_t graph_slot_count = 2 + spec.branch_cache_size;
+  const auto &graph_memory_plan =
+      MemoryUtils::array_plan(graph_slot_plan, graph_slot_count);
   const std::array fields{
       NodeStorageField{
           .name = switch_graph_memory_field_name,
@@ -542,7 +662,7 @@ NodeBuilder switch_node(NodeTypeMetaData meta, SwitchNodeSpec spec) {
       std::move(spec),
       descriptor.storage_plan->component(switch_storage_field_name).offset,
       descriptor.storage_plan->component(switch_graph_memory_field_name).offset,
-      graph_memory_plan.array_stride(), graph_slot_layout);
+      graph_memory_plan.array_stride(), graph_slot_count, graph_slot_layout);
 
   return NodeBuilder::from_descriptor(std::move(descriptor));
 }
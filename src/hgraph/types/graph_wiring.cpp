@@ -10,7 +10,10 @@
 #include <atomic>
 #include <cstdint>
 #include <deque>
+#include <memory>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <typeindex>
 #include <unordered_map>
 #include <unordered_set>
@@ -790,6 +793,349 @@ void select_output_value_storage(
   }
 }
 
+// Lifted-kernel fusion (``Wiring::fuse_lifted_kernels``). A tree of lifted
+// scalar nodes whose intermediate outputs each have exactly one reader, the
+// next node of the tree, collapses into its root: the root's builder is
+// replaced by one node whose inputs are the tree's distinct leaf sources and
+// whose evaluation runs the kernels in post-order through scratch values held
+// in node state. Absorbed instances stay in the deque, since their addresses
+// are wiring identity, and are left out of ranking.
+constexpr std::size_t max_fused_leaves = 32;
+constexpr std::size_t max_fused_arity = 4;
+
+struct FusedLiftedProgram {
+  struct Operand {
+    std::size_t index{0};
+    bool leaf{true}; // a leaf input ordinal, else an earlier step's slot
+  };
+  struct Step {
+    const LiftedKernel *kernel{nullptr};
+    std::size_t first_operand{0};
+  };
+
+  std::vector<Step> steps{};
+  std::vector<Operand> operands{};
+  std::size_t leaf_count{0};
+};
+
+void evaluate_fused_lifted_node(const FusedLiftedProgram &program,
+                                const NodeView &view,
+                                DateTime evaluation_time) {
+  if (!view.started()) {
+    return;
+  }
+
+  // Each leaf is projected once; the kernels then read the leaf payloads and
+  // the scratch slots of earlier steps directly. Any invalid leaf means an
+  // unfused node of the tree would not have produced, so neither do we.
+  auto root = view.input(evaluation_time);
+  auto input = root.as_bundle();
+  std::array<ValueTypeRef, max_fused_leaves> leaf_types{};
+  std::array<const void *, max_fused_leaves> leaf_data{};
+  for (std::size_t index = 0; index < program.leaf_count; ++index) {
+    auto leaf = input.at(index);
+    if (!leaf.valid()) {
+      return;
+    }
+    const ValueView value = leaf.value();
+    leaf_types[index] = value.binding();
+    leaf_data[index] = value.data();
+  }
+
+  const MutableTupleView scratch = view.state().as_tuple().begin_mutation();
+  std::array<ValueView, max_fused_arity> args{};
+  for (std::size_t index = 0; index < program.steps.size(); ++index) {
+    const auto &step = program.steps[index];
+    for (std::size_t arg = 0; arg < step.kernel->arity; ++arg) {
+      const auto &operand = program.operands[step.first_operand + arg];
+      args[arg] = operand.leaf ? ValueView{leaf_types[operand.index],
+                                           leaf_data[operand.index]}
+                               : scratch.at(operand.index);
+    }
+    step.kernel->eval_assign(
+        scratch.at(index),
+        std::span<const ValueView>{args.data(), step.kernel->arity});
+  }
+
+  const ValueView result = scratch.at(program.steps.size() - 1);
+  auto output = view.output(evaluation_time);
+  auto mutation = output.begin_mutation(evaluation_time);
+  static_cast<void>(mutation.copy_value_from(result));
+}
+
+[[nodiscard]] NodeBuilder fused_lifted_node_builder(
+    std::shared_ptr<const FusedLiftedProgram> program,
+    const TSValueTypeMetaData *output_schema,
+    std::span<const WiringPortRef> leaves,
+    std::span<const TSValueTypeMetaData *const> leaf_schemas,
+    std::string label) {
+  auto &registry = TypeRegistry::instance();
+  std::vector<std::pair<std::string, const TSValueTypeMetaData *>> fields;
+  fields.reserve(leaf_schemas.size());
+  for (std::size_t index = 0; index < leaf_schemas.size(); ++index) {
+    fields.emplace_back(std::to_string(index), leaf_schemas[index]);
+  }
+  std::vector<const ValueTypeMetaData *> slots;
+  slots.reserve(program->steps.size());
+  for (const auto &step : program->steps) {
+    slots.push_back(step.kernel->output_schema()->value_schema);
+  }
+
+  const auto *input_schema = registry.un_named_tsb(fields);
+  NodeTypeMetaData schema;
+  schema.display_name = "fused_lifted_kernels";
+  schema.input_schema = input_schema;
+  schema.output_schema = output_schema;
+  schema.state_schema = registry.tuple(slots);
+  schema.node_kind = NodeKind::Compute;
+
+  NodeCallbacks callbacks;
+  callbacks.evaluate = [program = std::move(program)](
+                           const NodeView &view, DateTime evaluation_time) {
+    evaluate_fused_lifted_node(*program, view, evaluation_time);
+  };
+
+  NodeBuilder builder =
+      NodeBuilder::native(std::move(schema), std::move(callbacks));
+  builder.input_endpoint(
+      graph_wiring_detail::input_endpoint_for_sources(input_schema, leaves));
+  builder.label(std::move(label));
+  return builder;
+}
+
+/** Whether ``instance`` is a plain lifted node the fusion pass may rewrite. */
+[[nodiscard]] bool fusible_lifted_instance(const WiringInstance &instance) {
+  const LiftedKernel *kernel = instance.lifted_kernel;
+  if (kernel == nullptr || !kernel->can_eval_assign() ||
+      kernel->arity == 0 || kernel->arity > max_fused_arity ||
+      instance.inputs.size() != kernel->arity ||
+      !instance.rank_dependencies.empty() ||
+      !instance.builder.output_endpoint().empty()) {
+    return false;
+  }
+  // Error capture, passive inputs and other rebinds change what the node
+  // does beyond its kernel; such nodes are left as they are.
+  const auto *meta = instance.builder.type().schema();
+  if (meta == nullptr || meta->output_schema == nullptr ||
+      meta->has_error_output() || meta->has_recordable_state() ||
+      meta->has_state() || meta->active_inputs.has_value() ||
+      meta->valid_inputs.has_value()) {
+    return false;
+  }
+  for (std::size_t index = 0; index < instance.inputs.size(); ++index) {
+    const WiringInputRef &input = instance.inputs[index];
+    if (!input.rank_dependency ||
+        input.source.arg_tag == WiringPortRef::ArgTag::Passive ||
+        !(input.target_path.empty() ||
+          input.target_path == std::vector<std::size_t>{index})) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void count_output_readers(
+    const WiringPortRef &source, const WiringInstance *reader,
+    std::unordered_map<const WiringInstance *, std::size_t> &read_count,
+    std::unordered_map<const WiringInstance *, const WiringInstance *>
+        &reader_of,
+    std::unordered_set<const WiringInstance *> &pinned) {
+  if (source.is_delayed_source()) {
+    // Counted through the resolution, but never absorbed through it.
+    const WiringPortRef resolved = resolve_delayed_source(source);
+    if (resolved.is_peered_source()) {
+      pinned.insert(resolved.peered_node());
+    }
+    count_output_readers(resolved, reader, read_count, reader_of, pinned);
+    return;
+  }
+  if (source.is_peered_source()) {
+    const WiringInstance *producer = source.peered_node();
+    if (source.peered_output_kind() != GraphEdgeSourceKind::Output ||
+        !source.peered_path().empty()) {
+      pinned.insert(producer);
+    }
+    ++read_count[producer];
+    reader_of[producer] = reader;
+    return;
+  }
+  if (!source.is_structural_source()) {
+    return;
+  }
+  for (const WiringPortRef &child : source.structural_children()) {
+    count_output_readers(child, reader, read_count, reader_of, pinned);
+  }
+}
+
+/**
+ * Collapse every fusible lifted tree into its root and return the absorbed
+ * instances. ``pinned`` names instances whose output is observed outside the
+ * wired inputs (sub-graph outputs, rank and service anchors); they may root a
+ * tree but are never absorbed.
+ */
+[[nodiscard]] std::unordered_set<const WiringInstance *>
+fuse_lifted_kernel_trees(std::deque<WiringInstance> &instances,
+                         std::unordered_set<const WiringInstance *> pinned) {
+  std::unordered_map<const WiringInstance *, std::size_t> read_count;
+  std::unordered_map<const WiringInstance *, const WiringInstance *> reader_of;
+  for (const WiringInstance &instance : instances) {
+    for (const WiringInputRef &input : instance.inputs) {
+      count_output_readers(input.source, &instance, read_count, reader_of,
+                           pinned);
+    }
+    for (const WiringInstance *producer : instance.rank_dependencies) {
+      pinned.insert(producer);
+    }
+  }
+
+  std::unordered_set<const WiringInstance *> fusible;
+  for (const WiringInstance &instance : instances) {
+    if (fusible_lifted_instance(instance)) {
+      fusible.insert(&instance);
+    }
+  }
+
+  // The producer behind ``input`` when its tree may absorb it.
+  const auto absorbable = [&](const WiringInputRef &input,
+                              const WiringInstance *reader)
+      -> const WiringInstance * {
+    if (!input.source.is_peered_source()) {
+      return nullptr;
+    }
+    const WiringInstance *producer = input.source.peered_node();
+    const auto reads = read_count.find(producer);
+    if (!fusible.contains(producer) || pinned.contains(producer) ||
+        reads == read_count.end() || reads->second != 1 ||
+        reader_of[producer] != reader ||
+        !producer->builder.label().empty()) {
+      return nullptr;
+    }
+    return producer;
+  };
+
+  // Upper bound on the leaf slots of the tree rooted at ``instance``.
+  std::unordered_map<const WiringInstance *, std::size_t> leaf_slots;
+  const auto slots_of = [&](const auto &self,
+                            const WiringInstance *instance) -> std::size_t {
+    if (const auto found = leaf_slots.find(instance);
+        found != leaf_slots.end()) {
+      return found->second;
+    }
+    std::size_t slots = 0;
+    for (const WiringInputRef &input : instance->inputs) {
+      const WiringInstance *child = absorbable(input, instance);
+      slots += child != nullptr ? self(self, child) : 1;
+    }
+    leaf_slots.emplace(instance, slots);
+    return slots;
+  };
+
+  std::deque<WiringInstance *> roots;
+  for (WiringInstance &instance : instances) {
+    if (!fusible.contains(&instance)) {
+      continue;
+    }
+    const auto reader = reader_of.find(&instance);
+    const bool absorbed_by_reader =
+        reader != reader_of.end() && fusible.contains(reader->second) &&
+        std::ranges::any_of(reader->second->inputs, [&](const auto &input) {
+          return absorbable(input, reader->second) == &instance;
+        });
+    if (!absorbed_by_reader) {
+      roots.push_back(&instance);
+    }
+  }
+
+  std::unordered_set<const WiringInstance *> absorbed;
+  while (!roots.empty()) {
+    WiringInstance &root = *roots.front();
+    roots.pop_front();
+
+    auto program = std::make_shared<FusedLiftedProgram>();
+    std::vector<WiringPortRef> leaves;
+    std::vector<const TSValueTypeMetaData *> leaf_schemas;
+    std::vector<const WiringInstance *> members;
+
+    const auto leaf_index = [&](const WiringPortRef &source,
+                                const TSValueTypeMetaData *schema) {
+      for (std::size_t index = 0; index < leaves.size(); ++index) {
+        if (leaf_schemas[index] == schema &&
+            leaves[index].arg_tag == source.arg_tag &&
+            leaves[index].same_source_as(source)) {
+          return index;
+        }
+      }
+      leaves.push_back(source);
+      leaf_schemas.push_back(schema);
+      return leaves.size() - 1;
+    };
+
+    // Post-order emission; returns the step index and its expression label.
+    const auto emit = [&](const auto &self, const WiringInstance *instance)
+        -> std::pair<std::size_t, std::string> {
+      const LiftedKernel *kernel = instance->lifted_kernel;
+      std::array<FusedLiftedProgram::Operand, max_fused_arity> operands{};
+      std::string label = kernel->name != nullptr ? kernel->name : "lift";
+      label += "(";
+      for (std::size_t index = 0; index < kernel->arity; ++index) {
+        const WiringInputRef &input = instance->inputs[index];
+        if (index != 0) {
+          label += ", ";
+        }
+        const WiringInstance *child = absorbable(input, instance);
+        if (child != nullptr &&
+            leaves.size() + slots_of(slots_of, child) > max_fused_leaves) {
+          // Too wide to join this tree: the child roots its own.
+          roots.push_back(const_cast<WiringInstance *>(child));
+          child = nullptr;
+        }
+        if (child != nullptr) {
+          auto [step, child_label] = self(self, child);
+          operands[index] = {.index = step, .leaf = false};
+          members.push_back(child);
+          label += child_label;
+        } else {
+          const std::size_t leaf =
+              leaf_index(input.source, kernel->input_schema(index));
+          operands[index] = {.index = leaf, .leaf = true};
+          label += "$" + std::to_string(leaf);
+        }
+      }
+      label += ")";
+      program->steps.push_back(FusedLiftedProgram::Step{
+          .kernel = kernel,
+          .first_operand = program->operands.size(),
+      });
+      program->operands.insert(program->operands.end(), operands.begin(),
+                               operands.begin() + kernel->arity);
+      return {program->steps.size() - 1, std::move(label)};
+    };
+
+    auto [step, label] = emit(emit, &root);
+    static_cast<void>(step);
+    if (members.empty()) {
+      continue;
+    }
+
+    program->leaf_count = leaves.size();
+    const std::string root_label{root.builder.label()};
+    root.builder = fused_lifted_node_builder(
+        std::move(program), output_schema_of(root),
+        std::span<const WiringPortRef>{leaves.data(), leaves.size()},
+        std::span<const TSValueTypeMetaData *const>{leaf_schemas.data(),
+                                                    leaf_schemas.size()},
+        root_label.empty() ? std::move(label) : root_label);
+    root.inputs.clear();
+    root.inputs.reserve(leaves.size());
+    for (WiringPortRef &leaf : leaves) {
+      root.inputs.push_back(WiringInputRef{.source = std::move(leaf)});
+    }
+    root.lifted_kernel = nullptr;
+    absorbed.insert(members.begin(), members.end());
+  }
+  return absorbed;
+}
+
 // The one rank-and-build pass behind both ``finish`` flavours: Kahn
 // topological sort (an input edge is producer -> consumer; insertion
 // order breaks ties), then nodes + edges into a GraphBuilder.
@@ -800,11 +1146,14 @@ build_ranked_graph(std::deque<WiringInstance> &instances,
                    const std::unordered_map<const WiringInstance *, std::size_t>
                        *external_sources = nullptr,
                    const std::unordered_set<const WiringInstance *>
-                       *escaped_outputs = nullptr) {
+                       *escaped_outputs = nullptr,
+                   const std::unordered_set<const WiringInstance *>
+                       *fused_away = nullptr) {
   std::vector<const WiringInstance *> all;
   all.reserve(instances.size());
   for (const auto &instance : instances) {
-    if (external_sources == nullptr || !external_sources->contains(&instance)) {
+    if ((external_sources == nullptr || !external_sources->contains(&instance)) &&
+        (fused_away == nullptr || !fused_away->contains(&instance))) {
       all.push_back(&instance);
     }
   }
@@ -1180,6 +1529,25 @@ struct Wiring::Impl {
   std::vector<std::string> wiring_path{};
   std::string graph_label{};
   WiringKind kind{WiringKind::TopLevel};
+  bool fuse_lifted_kernels{false};
+
+  /** Instances another wiring record refers to by identity; fusion may
+      root a tree at one but never absorb it. */
+  [[nodiscard]] std::unordered_set<const WiringInstance *>
+  fusion_anchors() const {
+    std::unordered_set<const WiringInstance *> anchors;
+    for (const auto &[path, node] : service_rank_anchors) {
+      anchors.insert(node);
+    }
+    for (const auto &client : service_client_ranks) {
+      anchors.insert(client.node);
+    }
+    for (const auto &pair : same_cycle_pairs) {
+      anchors.insert(pair.capture);
+      anchors.insert(pair.source);
+    }
+    return anchors;
+  }
 };
 
 Wiring::Wiring(WiringKind kind) : impl_(std::make_unique<Impl>(kind)) {}
@@ -1261,7 +1629,9 @@ bool Wiring::has_wiring_observers() const noexcept {
 }
 
 Wiring Wiring::child_wiring() const {
-  return Wiring{WiringKind::SubGraph, impl_->observers, impl_->wiring_path};
+  Wiring child{WiringKind::SubGraph, impl_->observers, impl_->wiring_path};
+  child.impl_->fuse_lifted_kernels = impl_->fuse_lifted_kernels;
+  return child;
 }
 
 std::vector<std::string> Wiring::current_wiring_path() const {
@@ -1388,6 +1758,25 @@ Wiring &Wiring::label(std::string label) {
 
 std::string_view Wiring::label() const noexcept { return impl_->graph_label; }
 
+Wiring &Wiring::fuse_lifted_kernels(bool enabled) noexcept {
+  impl_->fuse_lifted_kernels = enabled;
+  return *this;
+}
+
+bool Wiring::fuse_lifted_kernels() const noexcept {
+  return impl_->fuse_lifted_kernels;
+}
+
+void Wiring::mark_lifted_kernel(const WiringInstance *node,
+                                const LiftedKernel &kernel) {
+  if (node == nullptr) {
+    throw std::invalid_argument("mark_lifted_kernel: null node");
+  }
+  // The deque owns the instances (stable addresses); the const port ref
+  // names one we own and may amend before finish.
+  const_cast<WiringInstance &>(*node).lifted_kernel = &kernel;
+}
+
 ErasedDelayedBindingWiringPort::ErasedDelayedBindingWiringPort(
     Wiring &wiring, const TSValueTypeMetaData *schema) {
   if (schema == nullptr) {
@@ -2512,7 +2901,15 @@ GraphBuilder Wiring::finish_top_level(bool consume_state) {
   const auto realization = TypeRealizationSnapshot::capture(
       TypeRegistry::instance(), type_realization_options(selected_state));
   TypeRealizationScope realization_scope{realization.get()};
-  RankedGraphBuild build = build_ranked_graph(impl_->instances, nullptr);
+  // snapshot() leaves the wiring open to new readers of any node, so only
+  // the consuming finish() fuses.
+  std::unordered_set<const WiringInstance *> fused_away;
+  if (consume_state && impl_->fuse_lifted_kernels) {
+    fused_away =
+        fuse_lifted_kernel_trees(impl_->instances, impl_->fusion_anchors());
+  }
+  RankedGraphBuild build = build_ranked_graph(
+      impl_->instances, nullptr, nullptr, nullptr, nullptr, &fused_away);
   validate_same_cycle_pairs(build.index_of);
   // The wiring end FIXES the seed (ruling 2026-07-27): a live-seeded wiring
   // copies the selected GlobalState as it stands NOW — wiring-time
@@ -2722,9 +3119,18 @@ CompiledSubGraph Wiring::finish_subgraph(
                                      escaped_outputs);
   }
 
+  std::unordered_set<const WiringInstance *> fused_away;
+  if (impl_->fuse_lifted_kernels) {
+    auto anchors = impl_->fusion_anchors();
+    anchors.insert(escaped_outputs.begin(), escaped_outputs.end());
+    for (const auto &[instance, ordinal] : external_sources) {
+      anchors.insert(instance);
+    }
+    fused_away = fuse_lifted_kernel_trees(impl_->instances, std::move(anchors));
+  }
   RankedGraphBuild build = build_ranked_graph(
       impl_->instances, &compiled.input_bindings, &captures, &external_sources,
-      &escaped_outputs);
+      &escaped_outputs, &fused_away);
   validate_same_cycle_pairs(build.index_of);
   // GraphBuilder's default construction honours an active top-level
   // GlobalContext. A compiled child must instead share its root graph's
@@ -65,6 +65,10 @@ namespace hgraph::record_replay
         {
             throw std::invalid_argument("record/replay table keys must not be empty");
         }
+        if (config.model == MEMORY_MAPPED && config.directory.empty())
+        {
+            throw std::invalid_argument("memory-mapped record/replay requires a directory");
+        }
         ensure_config_type();
         state.set(CONFIG_KEY, Value{std::move(config)});
     }
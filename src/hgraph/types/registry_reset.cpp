@@ -5,6 +5,7 @@
 #include <hgraph/types/time_series/ts_data/empty_delta_fields.h>
 
 #include <hgraph/runtime/executor.h>
+#include <hgraph/runtime/graph_checkpoint.h>
 #include <hgraph/types/metadata/ts_data_plan_factory.h>
 #include <hgraph/types/metadata/type_record_registry.h>
 #include <hgraph/types/metadata/type_realization.h>
@@ -40,6 +41,7 @@ namespace hgraph
 
         OperatorRegistry::instance().reset();
         ValueConversionRegistry::instance().reset();
+        clear_graph_checkpoint_codecs();  // borrows JSON converters — must precede their clear
         clear_json_converters();   // interns by meta/binding pointer — must precede the lenders below
         ts_data_detail::clear_interned_empty_sets();   // OWNS Values — must precede the record clears
         clear_table_converters();  // same rule (also captures record_replay config keys)
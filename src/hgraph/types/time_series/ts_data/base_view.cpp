@@ -491,7 +491,7 @@ bool TSDataMutationView::invalidate() {
 
   auto &state =
       *table.mutable_tracking_impl(table.context, current.mutable_data());
-  state.observers.notify(mutation_time_);
+  state.notify_observers(mutation_time_);
   state.parent.notify_child_modified(mutation_time_);
   state.last_modified_time = MIN_DT;
   return true;
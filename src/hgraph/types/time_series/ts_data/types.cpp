@@ -302,10 +302,74 @@ namespace hgraph
         if (modified_time <= last_modified_time) { return false; }
 
         last_modified_time = modified_time;
-        observers.notify(modified_time);
+        notify_observers(modified_time);
         return true;
     }
 
+    void TSDataTracking::notify_observers(DateTime modified_time)
+    {
+        if (TSDataDeferredPublication::any_in_flight())
+        {
+            if (auto *deferred = TSDataDeferredPublication::current(); deferred != nullptr && deferred->covers(*this))
+            {
+                deferred->defer_notify(*this, modified_time);
+                return;
+            }
+        }
+        observers.notify(modified_time);
+    }
+
+    namespace
+    {
+        thread_local TSDataDeferredPublication *t_deferred_publication{nullptr};
+    }  // namespace
+
+    TSDataDeferredPublication::Scope::Scope(TSDataDeferredPublication &publication) noexcept
+        : previous_(std::exchange(t_deferred_publication, &publication))
+    {
+    }
+
+    TSDataDeferredPublication::Scope::~Scope() { t_deferred_publication = previous_; }
+
+    TSDataDeferredPublication *TSDataDeferredPublication::current() noexcept { return t_deferred_publication; }
+
+    void TSDataDeferredPublication::reset(TSDataTracking *boundary) noexcept
+    {
+        boundary_ = boundary;
+        pending_.clear();
+    }
+
+    bool TSDataDeferredPublication::covers(const TSDataTracking &tracking) const noexcept
+    {
+        if (boundary_ == nullptr) { return false; }
+        for (const TSDataTracking *current = &tracking;;)
+        {
+            if (current == boundary_) { return true; }
+            if (!current->parent.has_ts_data_parent()) { return false; }
+            current = &current->parent.parent_tracking();
+        }
+    }
+
+    void TSDataDeferredPublication::defer_notify(TSDataTracking &tracking, DateTime modified_time)
+    {
+        pending_.push_back(Pending{.tracking = &tracking, .time = modified_time});
+    }
+
+    void TSDataDeferredPublication::defer_bubble(const TSParentLink &link, DateTime modified_time)
+    {
+        pending_.push_back(Pending{.link = &link, .time = modified_time});
+    }
+
+    void TSDataDeferredPublication::replay()
+    {
+        for (const Pending &pending : pending_)
+        {
+            if (pending.tracking != nullptr) { pending.tracking->observers.notify(pending.time); }
+            else { pending.link->notify_child_modified(pending.time); }
+        }
+        pending_.clear();
+    }
+
     TSParentLinkKind TSParentLink::kind() const noexcept
     {
         return parent_.enum_value();
@@ -421,6 +485,15 @@ namespace hgraph
 
     void TSParentLink::notify_child_modified(DateTime mutation_time) const
     {
+        if (TSDataDeferredPublication::any_in_flight())
+        {
+            if (auto *deferred = TSDataDeferredPublication::current();
+                deferred != nullptr && deferred->is_boundary_link(*this))
+            {
+                deferred->defer_bubble(*this, mutation_time);
+                return;
+            }
+        }
         if (!has_ts_data_parent())
         {
             if (has_node_endpoint_parent())
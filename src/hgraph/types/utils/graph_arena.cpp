@@ -0,0 +1,263 @@
+#include <hgraph/types/utils/graph_arena.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+namespace hgraph
+{
+    /**
+     * One thread's dynamic allocation state. Only the owning thread touches
+     * the free lists and cursor; the counters are atomics so ``stats`` can
+     * sum them while the owner keeps writing (plain load/store, no RMW).
+     * Counters may wrap on one cache when blocks are released on another
+     * thread; the sum across caches is still exact.
+     */
+    struct GraphArena::ThreadCache
+    {
+        explicit ThreadCache(std::thread::id owner_) noexcept : owner(owner_) {}
+
+        static void add(std::atomic<std::size_t> &counter, std::size_t delta) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+
+        std::thread::id                       owner;
+        std::array<FreeBlock *, class_count>  free_lists{};
+        std::byte                            *cursor{nullptr};
+        std::byte                            *limit{nullptr};
+        std::atomic<std::size_t>              live_bytes{0};
+        std::atomic<std::size_t>              allocation_count{0};
+        std::atomic<std::size_t>              reuse_count{0};
+    };
+
+    namespace
+    {
+        /** The calling thread's cache for the arena it used last, keyed by a
+            never-reused arena id so a later arena at the same address cannot
+            pick up a dead cache. */
+        struct ThreadCacheSlot
+        {
+            std::uint64_t arena_id{0};
+            void         *cache{nullptr};
+        };
+
+        thread_local ThreadCacheSlot t_cache_slot{};
+
+        [[nodiscard]] std::uint64_t next_arena_id() noexcept
+        {
+            static std::atomic<std::uint64_t> next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::byte *align_up(std::byte *at, std::size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(at);
+            return at + (((address + alignment - 1) & ~(alignment - 1)) - address);
+        }
+    }  // namespace
+
+    GraphArena::StaticScope::StaticScope(GraphArena &arena) noexcept
+        : arena_(arena), previous_(arena.static_phase_.exchange(true, std::memory_order_relaxed))
+    {
+    }
+
+    GraphArena::StaticScope::~StaticScope() { arena_.static_phase_.store(previous_, std::memory_order_relaxed); }
+
+    GraphArena::GraphArena(std::size_t chunk_bytes)
+        : id_(next_arena_id()),
+          chunk_bytes_(std::max(chunk_bytes, max_alignment)),
+          ops_{.allocate = &GraphArena::allocate_hook,
+               .deallocate = &GraphArena::deallocate_hook,
+               .context = this,
+               .propagate_on_copy = false}
+    {
+    }
+
+    GraphArena::~GraphArena()
+    {
+        for (const Chunk &chunk : chunks_) { ::operator delete(chunk.memory, std::align_val_t{max_alignment}); }
+    }
+
+    void *GraphArena::allocate(MemoryUtils::StorageLayout layout)
+    {
+        if (!layout.valid()) { throw std::logic_error("GraphArena requires a valid layout"); }
+        if (layout.alignment > max_alignment) { return MemoryUtils::default_allocator().allocate_storage(layout); }
+        if (static_phase_.load(std::memory_order_relaxed)) { return allocate_static(layout); }
+
+        const std::size_t shift = size_class(layout);
+        const std::size_t bytes = std::size_t{1} << shift;
+        ThreadCache      &cache = thread_cache();
+        void             *memory = nullptr;
+        if (FreeBlock *block = cache.free_lists[shift]; block != nullptr)
+        {
+            cache.free_lists[shift] = block->next;
+            memory                  = block;
+            ThreadCache::add(cache.reuse_count, 1);
+        }
+        else
+        {
+            memory = bump(cache, bytes, std::min(bytes, max_alignment));
+        }
+        ThreadCache::add(cache.allocation_count, 1);
+        ThreadCache::add(cache.live_bytes, bytes);
+        return memory;
+    }
+
+    void GraphArena::deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept
+    {
+        if (memory == nullptr || !layout.valid()) { return; }
+        if (layout.alignment > max_alignment)
+        {
+            MemoryUtils::default_allocator().deallocate_storage(memory, layout);
+            return;
+        }
+        if (release_static(memory, layout)) { return; }
+
+        const std::size_t shift = size_class(layout);
+        ThreadCache      *cache = nullptr;
+        try
+        {
+            cache = &thread_cache();
+        }
+        catch (...)
+        {
+            return;   // no cache could be registered: the block stays with its chunk
+        }
+        cache->free_lists[shift] = ::new (memory) FreeBlock{cache->free_lists[shift]};
+        ThreadCache::add(cache->live_bytes, std::size_t{0} - (std::size_t{1} << shift));
+    }
+
+    GraphArena::Stats GraphArena::stats() const
+    {
+        std::lock_guard lock{mutex_};
+        Stats           result{.reserved_bytes = reserved_bytes_,
+                               .static_bytes   = static_bytes_,
+                               .chunk_count    = chunks_.size()};
+        for (const auto &cache : caches_)
+        {
+            result.live_bytes += cache->live_bytes.load(std::memory_order_relaxed);
+            result.allocation_count += cache->allocation_count.load(std::memory_order_relaxed);
+            result.reuse_count += cache->reuse_count.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::size_t GraphArena::size_class(MemoryUtils::StorageLayout layout) noexcept
+    {
+        const std::size_t bytes = std::max({layout.size, layout.alignment, std::size_t{1} << min_class_shift});
+        return static_cast<std::size_t>(std::bit_width(bytes - 1));
+    }
+
+    GraphArena::ThreadCache &GraphArena::thread_cache()
+    {
+        ThreadCacheSlot &slot = t_cache_slot;
+        if (slot.arena_id == id_) { return *static_cast<ThreadCache *>(slot.cache); }
+
+        std::lock_guard lock{mutex_};
+        const auto      self  = std::this_thread::get_id();
+        const auto      found = std::ranges::find_if(caches_, [self](const auto &cache) { return cache->owner == self; });
+        ThreadCache    *cache = found != caches_.end() ? found->get()
+                                                       : caches_.emplace_back(std::make_unique<ThreadCache>(self)).get();
+        slot = ThreadCacheSlot{.arena_id = id_, .cache = cache};
+        return *cache;
+    }
+
+    std::byte *GraphArena::new_chunk(std::size_t size)
+    {
+        // Called with mutex_ held; a new chunk is always recorded before it can leak.
+        chunks_.reserve(chunks_.size() + 1);
+        auto *memory = static_cast<std::byte *>(::operator new(size, std::align_val_t{max_alignment}));
+        chunks_.push_back(Chunk{memory, size});
+        reserved_bytes_ += size;
+        return memory;
+    }
+
+    std::byte *GraphArena::bump(ThreadCache &cache, std::size_t size, std::size_t alignment)
+    {
+        // A block too large to share a chunk gets one of its own and leaves
+        // the cursor where it is, so the current chunk's tail is not lost.
+        if (size > chunk_bytes_ / 2)
+        {
+            std::lock_guard lock{mutex_};
+            return new_chunk(size);
+        }
+
+        if (cache.cursor == nullptr || align_up(cache.cursor, alignment) + size > cache.limit)
+        {
+            std::byte *memory = nullptr;
+            {
+                std::lock_guard lock{mutex_};
+                memory = new_chunk(chunk_bytes_);
+            }
+            cache.cursor = memory;
+            cache.limit  = memory + chunk_bytes_;
+        }
+        std::byte *block = align_up(cache.cursor, alignment);
+        cache.cursor     = block + size;
+        return block;
+    }
+
+    void *GraphArena::allocate_static(MemoryUtils::StorageLayout layout)
+    {
+        const std::size_t size = std::max(layout.size, std::size_t{1});
+        std::lock_guard   lock{mutex_};
+        const auto        add_static_chunk = [this](std::size_t chunk) {
+            static_chunks_.reserve(static_chunks_.size() + 1);
+            std::byte *memory = new_chunk(chunk);
+            static_chunks_.insert(std::ranges::upper_bound(static_chunks_, memory, std::less{}, &Chunk::memory),
+                                  Chunk{memory, chunk});
+            return memory;
+        };
+        static_bytes_ += size;
+        if (size > chunk_bytes_ / 2) { return add_static_chunk(size); }
+
+        if (static_cursor_ == nullptr || align_up(static_cursor_, layout.alignment) + size > static_limit_)
+        {
+            static_cursor_ = add_static_chunk(chunk_bytes_);
+            static_limit_  = static_cursor_ + chunk_bytes_;
+        }
+        std::byte *block = align_up(static_cursor_, layout.alignment);
+        static_cursor_   = block + size;
+        return block;
+    }
+
+    bool GraphArena::release_static(void *memory, MemoryUtils::StorageLayout layout) noexcept
+    {
+        if (static_chunks_.empty()) { return false; }
+        auto *block = static_cast<std::byte *>(memory);
+        auto  chunk = std::ranges::upper_bound(static_chunks_, block, std::less{}, &Chunk::memory);
+        if (chunk == static_chunks_.begin()) { return false; }
+        --chunk;
+        if (block >= chunk->memory + chunk->size) { return false; }
+
+        // Static bytes stay put until the arena goes, except the most recent
+        // block of a build still in progress, which the cursor takes back.
+        if (static_phase_.load(std::memory_order_relaxed))
+        {
+            std::lock_guard lock{mutex_};
+            const std::size_t size = std::max(layout.size, std::size_t{1});
+            if (block + size == static_cursor_)
+            {
+                static_cursor_ = block;
+                static_bytes_ -= size;
+            }
+        }
+        return true;
+    }
+
+    void *GraphArena::allocate_hook(void *context, MemoryUtils::StorageLayout layout)
+    {
+        return static_cast<GraphArena *>(context)->allocate(layout);
+    }
+
+    void GraphArena::deallocate_hook(void *context, void *memory, MemoryUtils::StorageLayout layout) noexcept
+    {
+        static_cast<GraphArena *>(context)->deallocate(memory, layout);
+    }
+}  // namespace hgraph
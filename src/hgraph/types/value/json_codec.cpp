@@ -9,6 +9,7 @@
 #include <hgraph/util/date_time.h>
 
 #include <fmt/format.h>
+#include <simdjson.h>
 
 #if defined(HGRAPH_TIME_ZONE_BACKEND_DATE)
 #include <date/date.h>
@@ -331,6 +332,38 @@ namespace hgraph
             }
         };
 
+        // ---------------------------------------------------------------
+        // DocumentValue — a simdjson on-demand value. Whole-text reads walk
+        // the converter tree directly against the document: fields no
+        // converter names are never visited (the parser skips them), strings
+        // are unescaped into the parser's buffer, and the structured leaf
+        // forms (periods, ranges, zoned datetimes) hand their raw text back to
+        // the Reader.
+        // ---------------------------------------------------------------
+
+        struct DocumentValue
+        {
+            simdjson::ondemand::value value;
+        };
+
+        [[noreturn]] void document_fail(simdjson::error_code error)
+        {
+            throw std::invalid_argument(fmt::format("from_json: {}", simdjson::error_message(error)));
+        }
+
+        [[noreturn]] void document_fail(std::string_view message)
+        {
+            throw std::invalid_argument(fmt::format("from_json: {}", message));
+        }
+
+        template <typename T, typename Result>
+        [[nodiscard]] T document_get(Result &&result)
+        {
+            T value{};
+            if (const auto error = std::forward<Result>(result).get(value)) { document_fail(error); }
+            return value;
+        }
+
         // ---------------------------------------------------------------
         // Atomic parse helpers (Python strptime-format compatible)
         // ---------------------------------------------------------------
@@ -1182,10 +1215,9 @@ namespace hgraph
             json_detail::append_escaped(view.to_string(), out);
         }
 
-        Value read_enum(const JsonConverter &self, json_detail::Reader &reader)
+        [[nodiscard]] std::optional<Value> enum_member(const JsonConverter &self, std::string_view name)
         {
-            const std::string name = reader.parse_string();
-            const auto       *meta = self.meta;
+            const auto *meta = self.meta;
             for (std::size_t index = 0; index < meta->field_count; ++index)
             {
                 if (meta->fields[index].name != nullptr && name == meta->fields[index].name)
@@ -1196,8 +1228,15 @@ namespace hgraph
                     return out;
                 }
             }
+            return std::nullopt;
+        }
+
+        Value read_enum(const JsonConverter &self, json_detail::Reader &reader)
+        {
+            const std::string name = reader.parse_string();
+            if (auto member = enum_member(self, name)) { return std::move(*member); }
             reader.fail(fmt::format("unknown member '{}' for enum '{}'", name,
-                                    meta->name()));
+                                    self.meta->name()));
         }
 
         void write_atomic(const JsonConverter &self, const ValueView &view, std::string &out)
@@ -1786,6 +1825,24 @@ namespace hgraph
             return builder.build();
         }
 
+        // The key arrives as a JSON string; string-tagged keys use its
+        // content, other keys parse the content as their token.
+        [[nodiscard]] Value read_map_key(const JsonConverter &key_converter, std::string_view key_text)
+        {
+            if (key_converter.atomic_tag == AtomicTag::Str) { return Value{Str{key_text}}; }
+            // Quoted forms (dates etc.) arrive without their quotes; re-wrap
+            // so the atomic reader sees its expected shape.
+            if (!structured_map_key(key_converter.atomic_tag) && key_converter.atomic_tag != AtomicTag::Int &&
+                key_converter.atomic_tag != AtomicTag::Float && key_converter.atomic_tag != AtomicTag::Bool)
+            {
+                const std::string requoted = fmt::format("\"{}\"", key_text);
+                Reader            key_reader{std::string_view{requoted}};
+                return key_converter.read(key_reader);
+            }
+            Reader key_reader{key_text};
+            return key_converter.read(key_reader);
+        }
+
         Value read_map(const JsonConverter &self, Reader &reader)
         {
             MapBuilder builder{
@@ -1796,29 +1853,7 @@ namespace hgraph
             {
                 while (true)
                 {
-                    // The key arrives as a JSON string; string-tagged keys use
-                    // its content, other keys parse the content as their token.
-                    const std::string key_text = reader.parse_string();
-                    Value             key;
-                    if (self.children[0]->atomic_tag == AtomicTag::Str) { key = Value{Str{key_text}}; }
-                    else
-                    {
-                        Reader key_reader{std::string_view{key_text}};
-                        // Quoted forms (dates etc.) arrive without their quotes;
-                        // re-wrap so the atomic reader sees its expected shape.
-                        std::string requoted;
-                        if (!structured_map_key(
-                                self.children[0]->atomic_tag) &&
-                            self.children[0]->atomic_tag != AtomicTag::Int &&
-                            self.children[0]->atomic_tag != AtomicTag::Float &&
-                            self.children[0]->atomic_tag != AtomicTag::Bool)
-                        {
-                            requoted   = fmt::format("\"{}\"", key_text);
-                            key_reader = Reader{std::string_view{requoted}};
-                            key        = self.children[0]->read(key_reader);
-                        }
-                        else { key = self.children[0]->read(key_reader); }
-                    }
+                    const Value key = read_map_key(*self.children[0], reader.parse_string());
                     reader.expect(':');
                     if (reader.consume_keyword("null"))
                     {
@@ -1838,6 +1873,196 @@ namespace hgraph
             return builder.build();
         }
 
+        // ---------------------------------------------------------------
+        // Document read thunks (simdjson on-demand)
+        // ---------------------------------------------------------------
+
+        using json_detail::document_get;
+        using json_detail::DocumentValue;
+        namespace ondemand = simdjson::ondemand;
+
+        // The value's own text, read by the Reader thunks (structured leaf
+        // forms and polymorphic bundles, which must probe for the tag).
+        Value read_document_text(const JsonConverter &converter, DocumentValue &in)
+        {
+            Reader reader{document_get<std::string_view>(in.value.raw_json())};
+            return read_realized(converter, reader);
+        }
+
+        Value read_document_realized(const JsonConverter &converter, DocumentValue &in)
+        {
+            const auto *snapshot = active_type_realization();
+            if (snapshot != nullptr && snapshot->is_polymorphic(converter.meta))
+            {
+                return read_document_text(converter, in);
+            }
+            return converter.read_document_(converter, in);
+        }
+
+        [[nodiscard]] bool document_null(DocumentValue &in) { return document_get<bool>(in.value.is_null()); }
+
+        Value read_document_atomic(const JsonConverter &self, DocumentValue &in)
+        {
+            // The string forms parse the unescaped text; a Reader over that
+            // text only carries their failure messages.
+            const auto string_text = [&] { return document_get<std::string_view>(in.value.get_string()); };
+            switch (self.atomic_tag)
+            {
+                case AtomicTag::Bool: return Value{Bool{document_get<bool>(in.value.get_bool())}};
+                case AtomicTag::Int: return Value{Int{document_get<std::int64_t>(in.value.get_int64())}};
+                case AtomicTag::Float: return Value{Float{document_get<double>(in.value.get_double())}};
+                case AtomicTag::Str: return Value{Str{string_text()}};
+                case AtomicTag::ZoneId: return Value{ZoneId{string_text()}};
+                case AtomicTag::Date: {
+                    const std::string_view text = string_text();
+                    Reader                 reader{text};
+                    return Value{json_detail::json_date(text, reader)};
+                }
+                case AtomicTag::DateTime: {
+                    const std::string_view text = string_text();
+                    Reader                 reader{text};
+                    return Value{json_detail::json_instant(text, reader)};
+                }
+                case AtomicTag::TimeDelta: {
+                    const std::string_view text = string_text();
+                    Reader                 reader{text};
+                    return Value{json_detail::parse_json_duration(text, reader)};
+                }
+                case AtomicTag::Time: {
+                    const std::string_view text = string_text();
+                    Reader                 reader{text};
+                    return Value{json_detail::json_time(text, reader)};
+                }
+                case AtomicTag::CivilDateTime: {
+                    const std::string_view text = string_text();
+                    Reader                 reader{text};
+                    return Value{json_detail::parse_civil_datetime(text, reader, false)};
+                }
+                default: return read_document_text(self, in);
+            }
+        }
+
+        Value read_document_enum(const JsonConverter &self, DocumentValue &in)
+        {
+            const auto name = document_get<std::string_view>(in.value.get_string());
+            if (auto member = enum_member(self, name)) { return std::move(*member); }
+            json_detail::document_fail(fmt::format("unknown member '{}' for enum '{}'", name, self.meta->name()));
+        }
+
+        Value read_document_composite(const JsonConverter &self, DocumentValue &in)
+        {
+            auto binding = self.binding;
+            if (const auto *snapshot = active_type_realization();
+                snapshot != nullptr && !snapshot->is_polymorphic(self.meta))
+            {
+                binding = snapshot->type_for(self.meta);
+            }
+            BundleBuilder builder{binding};
+            if (self.names.empty())
+            {
+                std::size_t i = 0;
+                for (auto element : document_get<ondemand::array>(in.value.get_array()))
+                {
+                    if (i == self.children.size()) { json_detail::document_fail("composite array is too long"); }
+                    DocumentValue child{document_get<ondemand::value>(std::move(element))};
+                    if (document_null(child))
+                    {
+                        if (self.meta->value_kind() != ValueTypeKind::Bundle)
+                        {
+                            json_detail::document_fail("null composite field is only supported for Bundle values");
+                        }
+                    }
+                    else { builder.set(i, read_document_realized(*self.children[i], child)); }
+                    ++i;
+                }
+                if (i != self.children.size()) { json_detail::document_fail("composite array is too short"); }
+            }
+            else
+            {
+                for (auto field_result : document_get<ondemand::object>(in.value.get_object()))
+                {
+                    auto                   field = document_get<ondemand::field>(std::move(field_result));
+                    const std::string_view key   = document_get<std::string_view>(field.unescaped_key());
+                    std::size_t            index = self.names.size();
+                    for (std::size_t i = 0; i < self.names.size(); ++i)
+                    {
+                        if (self.names[i] == key)
+                        {
+                            index = i;
+                            break;
+                        }
+                    }
+                    // An unknown field's value is left unvisited; the parser
+                    // steps over it on the next iteration.
+                    if (index == self.names.size()) { continue; }
+                    DocumentValue child{field.value()};
+                    if (!document_null(child))
+                    {
+                        builder.set(index, read_document_realized(*self.children[index], child));
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        Value read_document_owned(const JsonConverter &self, DocumentValue &in)
+        {
+            Value result{self.binding};
+            if (document_null(in)) { return result; }
+
+            Value pointee     = read_document_realized(*self.children[0], in);
+            auto  destination = result.begin_mutation();
+            self.binding.ops_ref().copy_assign_from(
+                self.binding, destination.mutable_data(), pointee.binding(), pointee.view().data());
+            return result;
+        }
+
+        Value read_document_list(const JsonConverter &self, DocumentValue &in)
+        {
+            ListBuilder builder{realized_read_binding(*self.children[0])};
+            for (auto element : document_get<ondemand::array>(in.value.get_array()))
+            {
+                DocumentValue child{document_get<ondemand::value>(std::move(element))};
+                Value         value = self.children[0]->read(child);
+                builder.push_back_copy(value.view().data());
+            }
+            return builder.build();
+        }
+
+        Value read_document_set(const JsonConverter &self, DocumentValue &in)
+        {
+            SetBuilder builder{realized_read_binding(*self.children[0])};
+            for (auto element : document_get<ondemand::array>(in.value.get_array()))
+            {
+                DocumentValue child{document_get<ondemand::value>(std::move(element))};
+                Value         value = self.children[0]->read(child);
+                (void)builder.insert_copy(value.view().data());
+            }
+            return builder.build();
+        }
+
+        Value read_document_map(const JsonConverter &self, DocumentValue &in)
+        {
+            MapBuilder builder{
+                realized_read_binding(*self.children[0]),
+                realized_read_binding(*self.children[1])};
+            for (auto field_result : document_get<ondemand::object>(in.value.get_object()))
+            {
+                auto        field = document_get<ondemand::field>(std::move(field_result));
+                const Value key =
+                    read_map_key(*self.children[0], document_get<std::string_view>(field.unescaped_key()));
+                DocumentValue child{field.value()};
+                // JSON null = an unset entry, as on the Reader path.
+                if (document_null(child)) { builder.set_item_unset(key.view().data()); }
+                else
+                {
+                    Value value = self.children[1]->read(child);
+                    builder.set_item_copy(key.view().data(), value.view().data());
+                }
+            }
+            return builder.build();
+        }
+
         // ---------------------------------------------------------------
         // Synthesis + interning (cleared on registry reset)
         // ---------------------------------------------------------------
@@ -1920,6 +2145,7 @@ namespace hgraph
                 raw->children.push_back(converter_for_locked(meta->element_type));
                 raw->write_ = &write_owned;
                 raw->read_ = &read_owned;
+                raw->read_document_ = &read_document_owned;
                 unwind.release();
                 return raw;
             }
@@ -1931,6 +2157,7 @@ namespace hgraph
                     {
                         raw->write_ = &write_enum;
                         raw->read_  = &read_enum;
+                        raw->read_document_ = &read_document_enum;
                         break;
                     }
                     raw->atomic_tag = atomic_tag_for(meta);
@@ -1941,6 +2168,7 @@ namespace hgraph
                     }
                     raw->write_ = &write_atomic;
                     raw->read_  = &read_atomic;
+                    raw->read_document_ = &read_document_atomic;
                     break;
                 }
                 case ValueTypeKind::Tuple:
@@ -1956,18 +2184,21 @@ namespace hgraph
                     }
                     raw->write_ = &write_composite;
                     raw->read_  = &read_composite;
+                    raw->read_document_ = &read_document_composite;
                     break;
                 }
                 case ValueTypeKind::List: {
                     raw->children.push_back(converter_for_locked(meta->element_type));
                     raw->write_ = &write_sequence;
                     raw->read_  = &read_list;
+                    raw->read_document_ = &read_document_list;
                     break;
                 }
                 case ValueTypeKind::Set: {
                     raw->children.push_back(converter_for_locked(meta->element_type));
                     raw->write_ = &write_sequence;
                     raw->read_  = &read_set;
+                    raw->read_document_ = &read_document_set;
                     break;
                 }
                 case ValueTypeKind::Map: {
@@ -1975,6 +2206,7 @@ namespace hgraph
                     raw->children.push_back(converter_for_locked(meta->element_type));
                     raw->write_ = &write_map;
                     raw->read_  = &read_map;
+                    raw->read_document_ = &read_document_map;
                     break;
                 }
                 default:
@@ -1984,10 +2216,82 @@ namespace hgraph
             unwind.release();
             return raw;
         }
+
+        // NDJSON is indexed in fixed batches; one document must fit a batch.
+        constexpr std::size_t json_lines_batch_size = ondemand::DEFAULT_BATCH_SIZE;
+
+        // Larger buffers are released after the read that grew them, so one
+        // outsized document does not pin its memory to the thread.
+        constexpr std::size_t retained_parser_capacity = std::size_t{1} << 20U;
+
+        // One on-demand parser per thread, its buffers grown to the largest
+        // retained input, plus the padded copy of the input simdjson requires
+        // (it reads up to SIMDJSON_PADDING bytes past the text). A nested
+        // whole-text read on the same thread takes a private parser.
+        struct DocumentParser
+        {
+            ondemand::parser parser;
+            std::string      padded;
+            bool             active{false};
+
+            [[nodiscard]] const char *pad(std::string_view text)
+            {
+                padded.reserve(text.size() + simdjson::SIMDJSON_PADDING);
+                padded.assign(text);
+                return padded.data();
+            }
+
+            void trim() noexcept
+            {
+                if (padded.capacity() > retained_parser_capacity + simdjson::SIMDJSON_PADDING)
+                {
+                    std::string{}.swap(padded);
+                }
+                if (parser.capacity() > retained_parser_capacity) { parser = ondemand::parser{}; }
+            }
+        };
+
+        template <typename Fn>
+        decltype(auto) with_document_parser(Fn &&fn)
+        {
+            thread_local DocumentParser shared;
+            if (shared.active)
+            {
+                DocumentParser nested;
+                return std::forward<Fn>(fn)(nested);
+            }
+            shared.active = true;
+            auto release  = make_scope_exit([&]() noexcept {
+                shared.trim();
+                shared.active = false;
+            });
+            return std::forward<Fn>(fn)(shared);
+        }
+
+        // Read one parsed document. Scalar documents have no on-demand value
+        // form; their raw text goes through the Reader.
+        template <typename Document>
+        Value read_document(const JsonConverter &converter, Document &document)
+        {
+            const auto type = document_get<ondemand::json_type>(document.type());
+            if (type != ondemand::json_type::object && type != ondemand::json_type::array)
+            {
+                const auto text = document_get<std::string_view>(document.raw_json());
+                Reader     reader{text};
+                Value      result = converter.read(reader);
+                reader.skip_ws();
+                if (reader.pos != text.size()) { reader.fail("trailing content"); }
+                return result;
+            }
+            DocumentValue root{document_get<ondemand::value>(document.get_value())};
+            return converter.read(root);
+        }
     }  // namespace
 
     Value JsonConverter::read(json_detail::Reader &reader) const { return read_realized(*this, reader); }
 
+    Value JsonConverter::read(json_detail::DocumentValue &value) const { return read_document_realized(*this, value); }
+
     const JsonConverter &json_converter(const ValueTypeMetaData *meta)
     {
         // Composed + interned once per schema. Per-tick operator paths do NOT
@@ -2014,11 +2318,29 @@ namespace hgraph
 
     Value from_json_string(const JsonConverter &converter, std::string_view text)
     {
-        json_detail::Reader reader{text};
-        Value               result = converter.read(reader);
-        reader.skip_ws();
-        if (reader.pos != text.size()) { reader.fail("trailing content"); }
-        return result;
+        return with_document_parser([&](DocumentParser &state) {
+            const char *padded   = state.pad(text);
+            auto        document = document_get<ondemand::document>(
+                state.parser.iterate(padded, text.size(), state.padded.capacity()));
+            Value result = read_document(converter, document);
+            if (!document.at_end()) { json_detail::document_fail("trailing content"); }
+            return result;
+        });
+    }
+
+    void from_json_lines(const JsonConverter &converter, std::string_view text, std::vector<Value> &out)
+    {
+        with_document_parser([&](DocumentParser &state) {
+            const char *padded = state.pad(text);
+            auto        stream = document_get<ondemand::document_stream>(
+                state.parser.iterate_many(padded, text.size(), json_lines_batch_size));
+            for (auto document_result : stream)
+            {
+                auto document = document_get<ondemand::document_reference>(std::move(document_result));
+                out.push_back(read_document(converter, document));
+            }
+            if (stream.truncated_bytes() != 0) { json_detail::document_fail("truncated document at end of stream"); }
+        });
     }
 
     Value from_json_string(const ValueTypeMetaData *meta, std::string_view text)
@@ -2078,6 +2400,11 @@ namespace hgraph
             return result;
         }
 
+        Value parse_key(const JsonConverter &converter, std::string_view key_text)
+        {
+            return read_map_key(converter, key_text);
+        }
+
         void fail(Cursor &cursor, std::string_view message)
         {
             json_detail::Reader reader{cursor.text, cursor.offset};
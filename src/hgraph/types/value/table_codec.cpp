@@ -7,11 +7,14 @@
 #include <hgraph/types/value/value_builder.h>
 
 #include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
 
 #include <fmt/format.h>
 
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -1060,6 +1063,8 @@ namespace hgraph
         ++impl_->rows;
     }
 
+    std::int64_t FrameRecorder::rows() const noexcept { return impl_->rows; }
+
     Frame FrameRecorder::finish()
     {
         arrow::ArrayVector arrays;
@@ -1067,7 +1072,74 @@ namespace hgraph
         arrays.push_back(hgraph::finish(*impl_->date_builder));
         arrays.push_back(hgraph::finish(*impl_->as_of_builder));
         for (auto &builder : impl_->column_builders) { arrays.push_back(hgraph::finish(*builder)); }
-        return Frame{arrow::Table::Make(impl_->converter->arrow_schema, std::move(arrays), impl_->rows)};
+        return Frame{arrow::Table::Make(impl_->converter->arrow_schema, std::move(arrays),
+                                        std::exchange(impl_->rows, 0))};
+    }
+
+    struct FrameStreamWriter::Impl
+    {
+        FrameRecorder                                  recorder;
+        std::shared_ptr<arrow::io::FileOutputStream>   sink{};
+        std::shared_ptr<arrow::ipc::RecordBatchWriter> writer{};
+        std::int64_t                                   batch_rows{1};
+        TimeDelta                                      flush_interval{};
+        DateTime                                       first_buffered{};
+        bool                                           closed{false};
+    };
+
+    FrameStreamWriter::FrameStreamWriter(const TableConverter &converter, const std::string &path,
+                                         std::int64_t batch_rows, TimeDelta flush_interval)
+        : impl_(std::make_unique<Impl>(Impl{FrameRecorder{converter}, {}, {}, std::max<std::int64_t>(1, batch_rows),
+                                            flush_interval, {}, false}))
+    {
+        const std::filesystem::path file{path};
+        if (file.has_parent_path()) { std::filesystem::create_directories(file.parent_path()); }
+        auto sink = arrow::io::FileOutputStream::Open(path, /*append=*/false);
+        if (!sink.ok()) { fail_status(sink.status(), "open stream file"); }
+        impl_->sink = *sink;
+        auto writer = arrow::ipc::MakeStreamWriter(impl_->sink, converter.arrow_schema);
+        if (!writer.ok()) { fail_status(writer.status(), "open IPC stream"); }
+        impl_->writer = *writer;
+    }
+
+    FrameStreamWriter::~FrameStreamWriter()
+    {
+        if (impl_ == nullptr || impl_->closed) { return; }
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+            // Destruction on an error path: the stream is left without its end marker.
+        }
+    }
+
+    void FrameStreamWriter::append(DateTime value_time, DateTime as_of, const ValueView &value)
+    {
+        if (impl_->recorder.rows() == 0) { impl_->first_buffered = value_time; }
+        impl_->recorder.append(value_time, as_of, value);
+        if (impl_->recorder.rows() >= impl_->batch_rows ||
+            (impl_->flush_interval > TimeDelta{0} && value_time - impl_->first_buffered >= impl_->flush_interval))
+        {
+            flush();
+        }
+    }
+
+    void FrameStreamWriter::flush()
+    {
+        if (impl_->recorder.rows() == 0) { return; }
+        const Frame batch = impl_->recorder.finish();
+        check(impl_->writer->WriteTable(*batch.table), "write record batch");
+    }
+
+    void FrameStreamWriter::close()
+    {
+        if (impl_->closed) { return; }
+        impl_->closed = true;
+        flush();
+        check(impl_->writer->Close(), "close IPC stream");
+        check(impl_->sink->Close(), "close stream file");
     }
 
     DateTime frame_value_time(const TableConverter &converter, const Frame &frame, std::int64_t row)
@@ -2,7 +2,9 @@
 #include <hgraph/lib/testing/record_replay.h>
 #include <hgraph/runtime/runtime.h>
 #include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/metadata/type_registry.h>
 #include <hgraph/types/static_node.h>
+#include <hgraph/types/value/json_codec.h>
 
 #include <atomic>
 #include <chrono>
@@ -48,6 +50,7 @@ namespace
         double       milliseconds{0.0};
         std::size_t  allocations{0};
         std::size_t  allocated_bytes{0};
+        std::size_t  input_bytes{0};
     };
 
     std::string make_payload(int field_count)
@@ -213,6 +216,37 @@ namespace
         };
     }
 
+    // Schema-directed reads of the ``target`` member only: every ``fieldN``
+    // is an unknown field the converter must step over.
+    const hgraph::ValueTypeMetaData *target_schema()
+    {
+        auto       &registry = hgraph::TypeRegistry::instance();
+        const auto *int_meta = registry.register_scalar<hgraph::Int>("int");
+        const auto *str_meta = registry.register_scalar<hgraph::Str>("str");
+        const auto *target   = registry.un_named_bundle(
+            {{"answer", int_meta}, {"label", str_meta}, {"values", registry.list(int_meta)}});
+        return registry.un_named_bundle({{"target", target}});
+    }
+
+    template <typename Decode>
+    Metrics run_converter(std::string name, std::size_t ticks, std::size_t input_bytes, Decode &&decode)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        {
+            AllocationScope allocations;
+            decode();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return Metrics{
+            std::move(name),
+            ticks,
+            std::chrono::duration<double, std::milli>(end - start).count(),
+            g_allocations.load(std::memory_order_relaxed),
+            g_allocated_bytes.load(std::memory_order_relaxed),
+            input_bytes,
+        };
+    }
+
     void print_metrics(const Metrics &metrics)
     {
         const double ticks = static_cast<double>(metrics.ticks);
@@ -223,8 +257,13 @@ namespace
                   << " allocs=" << metrics.allocations
                   << " allocs_per_tick=" << (static_cast<double>(metrics.allocations) / ticks)
                   << " bytes=" << metrics.allocated_bytes
-                  << " bytes_per_tick=" << (static_cast<double>(metrics.allocated_bytes) / ticks)
-                  << '\n';
+                  << " bytes_per_tick=" << (static_cast<double>(metrics.allocated_bytes) / ticks);
+        if (metrics.input_bytes != 0)
+        {
+            std::cout << " mb_per_s="
+                      << (static_cast<double>(metrics.input_bytes) / (metrics.milliseconds * 1000.0));
+        }
+        std::cout << '\n';
     }
 
     int env_int(const char *name, int fallback)
@@ -274,4 +313,37 @@ int main()
     print_metrics(run_one_input<JsonExtractGraph>("decode+extract_leaf", input));
     print_metrics(run_one_input<JsonEncodeGraph>("decode+encode", input));
     print_metrics(run_equality(input, input_equivalent));
+
+    const auto       &converter   = hgraph::json_converter(target_schema());
+    const std::size_t count       = static_cast<std::size_t>(ticks);
+    const std::size_t input_bytes = payload.size() * count;
+    std::size_t       decoded     = 0;
+    print_metrics(run_converter("converter_reader", count, input_bytes, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            hgraph::json_fragment::Cursor cursor{std::string_view{payload}, 0};
+            decoded += hgraph::json_fragment::parse_value(converter, cursor).has_value() ? 1U : 0U;
+        }
+    }));
+    print_metrics(run_converter("converter_document", count, input_bytes, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            decoded += hgraph::from_json_string(converter, payload).has_value() ? 1U : 0U;
+        }
+    }));
+
+    std::string lines;
+    lines.reserve(input_bytes + count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        lines += payload;
+        lines += '\n';
+    }
+    std::vector<hgraph::Value> batch;
+    batch.reserve(count);
+    print_metrics(run_converter("converter_ndjson", count, lines.size(), [&] {
+        hgraph::from_json_lines(converter, lines, batch);
+    }));
+    decoded += batch.size();
+    if (decoded != count * 3U) { std::cerr << "converter decode count mismatch: " << decoded << '\n'; }
 }
@@ -91,6 +91,35 @@ namespace
 
         [[nodiscard]] static Int apply(Int lhs, Int rhs) { return lhs + rhs; }
     };
+
+    struct FusedSignalGraph
+    {
+        static constexpr auto name = "fused_signal_graph";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Float>> a, Port<TS<Float>> b, Port<TS<Float>> c,
+                                       Port<TS<Float>> d)
+        {
+            using namespace hgraph::stdlib::syntax;
+            w.fuse_lifted_kernels(true);
+            return ((a + b) * c - d).as<TS<Float>>();
+        }
+    };
+
+    [[nodiscard]] GraphBuilder wire_signal(bool fuse, bool share_sum)
+    {
+        using namespace hgraph::stdlib::syntax;
+
+        Wiring w;
+        w.fuse_lifted_kernels(fuse);
+        auto a   = wire<stdlib::const_, TS<Float>>(w, Float{1.0});
+        auto b   = wire<stdlib::const_, TS<Float>>(w, Float{2.0});
+        auto c   = wire<stdlib::const_, TS<Float>>(w, Float{3.0});
+        auto d   = wire<stdlib::const_, TS<Float>>(w, Float{4.0});
+        auto sum = (a + b).as<TS<Float>>();
+        if (share_sum) { static_cast<void>((sum * c + (sum - d)).as<TS<Float>>()); }
+        else { static_cast<void>((sum * c - d).as<TS<Float>>()); }
+        return std::move(w).finish();
+    }
 }  // namespace
 
 TEST_CASE("lift: a scalar function wires as a time-series compute node")
@@ -266,3 +295,37 @@ TEST_CASE("lift: standard operator overloads expose their lifted kernel metadata
     REQUIRE(resolved.impl->lifted_kernel != nullptr);
     CHECK(resolved.impl->lifted_kernel == lift<stdlib::scalar_add<Int>>().lifted);
 }
+
+TEST_CASE("lift: single-reader lifted chains fuse into one node with unchanged ticks")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // (a + b) * c - d only emits once d is valid, and re-evaluates on any leaf tick.
+    CHECK_OUTPUT(eval_node<FusedSignalGraph>(values<Float>(1.0, 2.0, none, 4.0), values<Float>(1.0, none, none, 1.0),
+                                             values<Float>(2.0, none, 3.0, none), values<Float>(none, 1.0, none, none)),
+                 values<Float>(none, 5.0, 8.0, 14.0));
+
+    CHECK_FALSE(Wiring{}.fuse_lifted_kernels());
+    const GraphBuilder unfused = wire_signal(false, false);
+    CHECK(unfused.node_count() == 7);   // four sources + add, mul, sub
+
+    const GraphBuilder fused = wire_signal(true, false);
+    REQUIRE(fused.node_count() == 5);   // four sources + one fused expression
+    const std::string label{fused.nodes()[4].label()};
+    CHECK(label == "scalar_sub(scalar_mul(scalar_add($0, $1), $2), $3)");
+}
+
+TEST_CASE("lift: a lifted output with several readers stays a leaf of the fused trees")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    CHECK(wire_signal(false, true).node_count() == 8);   // four sources + add, mul, sub, add
+
+    // The shared sum keeps its node; mul and sub fold into the final add.
+    const GraphBuilder fused = wire_signal(true, true);
+    REQUIRE(fused.node_count() == 6);
+    const std::string label{fused.nodes()[5].label()};
+    CHECK(label == "scalar_add(scalar_mul($0, $1), scalar_sub($0, $2))");
+}
@@ -0,0 +1,162 @@
+#include <hgraph/lib/std/std_operators.h>
+#include <hgraph/runtime/executor.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+#include <hgraph/types/subgraph_wiring.h>
+#include <hgraph/types/wired_fn.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+// Keyed child churn: a map_ holds HGRAPH_MAP_CHURN_PERF_WIDTH live keys and,
+// each of HGRAPH_MAP_CHURN_PERF_CYCLES cycles, retires the oldest
+// HGRAPH_MAP_CHURN_PERF_CHURN keys and admits as many new ones. Every new key
+// needs a child graph (a short stateful chain); the benchmark reports child
+// builds per second with recycling off and with a __recycle__ high-water
+// mark of the churn width, each the best of HGRAPH_MAP_CHURN_PERF_REPEATS
+// runs, and the recycled/fresh ratio.
+
+namespace
+{
+    using namespace hgraph;
+
+    Int g_width{0};
+    Int g_churn{0};
+    Int g_recycle{0};
+
+    struct ChurnKeys
+    {
+        static constexpr auto name              = "map_churn_keys";
+        static constexpr bool schedule_on_start = true;
+        static void           eval(NodeScheduler sched, Scalar<"width", Int> width, Scalar<"churn", Int> churn,
+                                   State<Int> next, Out<TSS<Int>> out)
+        {
+            const Int first = next.get();
+            if (first == 0)
+            {
+                for (Int key = 0; key < width.value(); ++key) { out.add(key); }
+                next.set(width.value());
+            }
+            else
+            {
+                for (Int offset = 0; offset < churn.value(); ++offset)
+                {
+                    out.remove(first - width.value() + offset);
+                    out.add(first + offset);
+                }
+                next.set(first + churn.value());
+            }
+            sched.schedule(TimeDelta{1});
+        }
+    };
+
+    struct ChurnStep
+    {
+        static constexpr auto name = "map_churn_step";
+        static void           eval(In<"ts", TS<Int>> ts, State<Int> total, Out<TS<Int>> out)
+        {
+            total.set(total.get() + ts.value());
+            out.set(total.get());
+        }
+    };
+
+    struct ChurnChild
+    {
+        static constexpr auto name = "map_churn_child";
+
+        static Port<TS<Int>> compose(Wiring &w, NamedPort<"key", TS<Int>> key)
+        {
+            auto value = wire<ChurnStep>(w, key);
+            value      = wire<ChurnStep>(w, value);
+            value      = wire<ChurnStep>(w, value);
+            return wire<ChurnStep>(w, value);
+        }
+    };
+
+    struct ChurnGraph
+    {
+        static constexpr auto name = "map_churn_graph";
+        static void           compose(Wiring &w)
+        {
+            auto keys = wire<ChurnKeys>(w, g_width, g_churn);
+            static_cast<void>(
+                wire<stdlib::map_>(w, fn<ChurnChild>(), arg<"__keys__">(keys), arg<"__recycle__">(g_recycle)));
+        }
+    };
+
+    struct Result
+    {
+        double builds_per_second{0.0};
+        double ns_per_key{0.0};
+    };
+
+    Result run(Int recycle, std::size_t cycles)
+    {
+        g_recycle = recycle;
+        GraphExecutorBuilder builder;
+        builder.graph_builder(build_graph<ChurnGraph>())
+            .start_time(MIN_ST)
+            .end_time(MIN_ST + TimeDelta{static_cast<std::int64_t>(cycles)});
+        GraphExecutorValue executor = builder.make_executor();
+
+        const auto start = std::chrono::steady_clock::now();
+        executor.view().run();
+        const auto end = std::chrono::steady_clock::now();
+
+        const double keys    = static_cast<double>(g_width) + static_cast<double>(g_churn) * static_cast<double>(cycles);
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return Result{
+            .builds_per_second = keys / seconds,
+            .ns_per_key        = seconds * 1e9 / keys,
+        };
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr || *value == '\0') { return fallback; }
+        return std::max<std::size_t>(1, static_cast<std::size_t>(std::strtoull(value, nullptr, 10)));
+    }
+}  // namespace
+
+int main()
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    g_width                  = static_cast<Int>(env_size("HGRAPH_MAP_CHURN_PERF_WIDTH", 1024));
+    g_churn                  = static_cast<Int>(std::min<std::size_t>(
+        env_size("HGRAPH_MAP_CHURN_PERF_CHURN", 64), static_cast<std::size_t>(g_width)));
+    const std::size_t cycles  = env_size("HGRAPH_MAP_CHURN_PERF_CYCLES", 2000);
+    const std::size_t repeats = env_size("HGRAPH_MAP_CHURN_PERF_REPEATS", 3);
+
+    const std::pair<Int, std::string_view> configurations[]{
+        {Int{0}, "fresh"},
+        {g_churn, "recycled"},
+    };
+
+    std::cout << "width=" << g_width << " churn=" << g_churn << " cycles=" << cycles << " repeats=" << repeats
+              << '\n';
+    double builds_per_second[std::size(configurations)]{};
+    for (std::size_t index = 0; index < std::size(configurations); ++index)
+    {
+        const auto &[recycle, name] = configurations[index];
+        Result best{};
+        for (std::size_t repeat = 0; repeat < repeats; ++repeat)
+        {
+            const Result result = run(recycle, cycles);
+            if (result.builds_per_second > best.builds_per_second) { best = result; }
+        }
+        builds_per_second[index] = best.builds_per_second;
+        std::cout << name << " builds_per_second=" << best.builds_per_second << " ns_per_key=" << best.ns_per_key
+                  << '\n';
+    }
+    std::cout << "recycled/fresh=" << builds_per_second[1] / builds_per_second[0] << '\n';
+}
@@ -0,0 +1,201 @@
+#include <hgraph/lib/testing/mock_runtime.h>
+#include <hgraph/runtime/runtime.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Evaluation-loop cache behaviour per graph storage layout. A graph of
+// ``width`` stateful nodes is evaluated for HGRAPH_NODE_LAYOUT_PERF_CYCLES
+// cycles with every ``stride``-th node scheduled, so each cycle scans the
+// whole schedule and resolves a sparse set of nodes spread across the block.
+// Reports nanoseconds and L1D / last-level cache read misses per cycle from
+// perf_event_open; the miss columns read ``n/a`` where the counters are not
+// available (non-Linux, or perf_event_paranoid forbids them).
+
+namespace
+{
+    using namespace hgraph;
+
+    std::uint64_t g_observation{0};
+
+    struct LayoutProbeNode
+    {
+        static constexpr auto name = "node_layout_perf_probe";
+
+        static void eval(Scalar<"slot", Int> slot, State<Int> ticks)
+        {
+            ticks.set(ticks.get() + 1);
+            g_observation += static_cast<std::uint64_t>(slot.value()) + 1;
+        }
+    };
+
+    /** One hardware cache counter, or an inert placeholder where unsupported. */
+    class CacheCounter
+    {
+      public:
+        explicit CacheCounter(std::uint64_t cache)
+        {
+#if defined(__linux__)
+            perf_event_attr attr{};
+            attr.type           = PERF_TYPE_HW_CACHE;
+            attr.size           = sizeof(attr);
+            attr.config         = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+            static_cast<void>(cache);
+#endif
+        }
+
+        CacheCounter(const CacheCounter &)            = delete;
+        CacheCounter &operator=(const CacheCounter &) = delete;
+
+        ~CacheCounter()
+        {
+#if defined(__linux__)
+            if (fd_ >= 0) { close(fd_); }
+#endif
+        }
+
+        [[nodiscard]] bool available() const noexcept { return fd_ >= 0; }
+
+        void start() const
+        {
+#if defined(__linux__)
+            if (!available()) { return; }
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+
+        [[nodiscard]] std::uint64_t stop() const
+        {
+            std::uint64_t count = 0;
+#if defined(__linux__)
+            if (!available()) { return count; }
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) { count = 0; }
+#endif
+            return count;
+        }
+
+      private:
+        int fd_{-1};
+    };
+
+#if defined(__linux__)
+    constexpr std::uint64_t l1d_cache = PERF_COUNT_HW_CACHE_L1D;
+    constexpr std::uint64_t ll_cache  = PERF_COUNT_HW_CACHE_LL;
+#else
+    constexpr std::uint64_t l1d_cache = 0;
+    constexpr std::uint64_t ll_cache  = 0;
+#endif
+
+    struct Result
+    {
+        double ns_per_cycle{0.0};
+        double l1d_misses_per_cycle{-1.0};
+        double ll_misses_per_cycle{-1.0};
+    };
+
+    Result run(GraphNodeLayout layout, std::size_t width, std::size_t stride, std::size_t cycles)
+    {
+        Wiring w;
+        for (std::size_t slot = 0; slot < width; ++slot)
+        {
+            static_cast<void>(wire<LayoutProbeNode>(w, static_cast<Int>(slot)));
+        }
+        GraphBuilder builder = std::move(w).finish();
+        builder.node_layout(layout);
+
+        testing::MockGraphExecutor executor{builder, MIN_ST, MAX_ET};
+        auto                       graph = executor.view().graph();
+        graph.start(MIN_ST);
+
+        std::uint64_t cycle = 0;
+        const auto    evaluate_cycle = [&] {
+            const DateTime evaluation_time = MIN_ST + TimeDelta{static_cast<TimeDelta::rep>(++cycle)};
+            executor.set_evaluation_time(evaluation_time);
+            for (std::size_t index = 0; index < width; index += stride) { graph.schedule_node(index, evaluation_time); }
+            if (!graph.evaluate(evaluation_time)) { throw std::runtime_error("node_layout_perf: graph paused"); }
+        };
+        for (std::size_t warmup = 0; warmup < cycles / 10 + 1; ++warmup) { evaluate_cycle(); }
+
+        const CacheCounter l1d{l1d_cache};
+        const CacheCounter ll{ll_cache};
+        l1d.start();
+        ll.start();
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t index = 0; index < cycles; ++index) { evaluate_cycle(); }
+        const auto end = std::chrono::steady_clock::now();
+        const auto ll_misses  = ll.stop();
+        const auto l1d_misses = l1d.stop();
+        graph.stop();
+
+        const auto per_cycle = [cycles](std::uint64_t count) {
+            return static_cast<double>(count) / static_cast<double>(cycles);
+        };
+        return Result{
+            .ns_per_cycle = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(cycles),
+            .l1d_misses_per_cycle = l1d.available() ? per_cycle(l1d_misses) : -1.0,
+            .ll_misses_per_cycle  = ll.available() ? per_cycle(ll_misses) : -1.0,
+        };
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr || *value == '\0') { return fallback; }
+        return std::max<std::size_t>(1, static_cast<std::size_t>(std::strtoull(value, nullptr, 10)));
+    }
+
+    std::string format_count(double value)
+    {
+        return value < 0.0 ? std::string{"n/a"} : std::to_string(value);
+    }
+}  // namespace
+
+int main()
+{
+    using namespace hgraph;
+
+    const std::size_t cycles = env_size("HGRAPH_NODE_LAYOUT_PERF_CYCLES", 2000);
+    const std::size_t stride = env_size("HGRAPH_NODE_LAYOUT_PERF_STRIDE", 16);
+
+    constexpr std::array layouts{
+        std::pair{GraphNodeLayout::Interleaved, std::string_view{"interleaved"}},
+        std::pair{GraphNodeLayout::HotCold, std::string_view{"hot_cold"}},
+    };
+
+    std::cout << "cycles=" << cycles << " stride=" << stride << '\n';
+    for (const std::size_t width : {std::size_t{1000}, std::size_t{10000}, std::size_t{50000}})
+    {
+        for (const auto &[layout, name] : layouts)
+        {
+            const Result result = run(layout, width, stride, cycles);
+            std::cout << name << " width=" << width << " ns_per_cycle=" << result.ns_per_cycle
+                      << " l1d_misses_per_cycle=" << format_count(result.l1d_misses_per_cycle)
+                      << " ll_misses_per_cycle=" << format_count(result.ll_misses_per_cycle) << '\n';
+        }
+    }
+}
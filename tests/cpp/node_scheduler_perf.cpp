@@ -0,0 +1,141 @@
+#include <hgraph/runtime/node_scheduler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Scheduler churn: ``states`` node scheduler states are driven through
+// HGRAPH_NODE_SCHEDULER_PERF_CYCLES evaluation cycles. Each cycle every state
+// fires (advance) and re-arms itself the way throttle / resample / alarm
+// nodes do. Reports nanoseconds and heap allocations per reschedule.
+
+namespace
+{
+    using namespace hgraph;
+
+    std::atomic<bool>        g_count_allocations{false};
+    std::atomic<std::size_t> g_allocations{0};
+
+    struct AllocationScope
+    {
+        AllocationScope()
+        {
+            g_allocations.store(0, std::memory_order_relaxed);
+            g_count_allocations.store(true, std::memory_order_relaxed);
+        }
+
+        ~AllocationScope() { g_count_allocations.store(false, std::memory_order_relaxed); }
+    };
+
+    enum class Pattern
+    {
+        Untagged,   // one untagged event per cycle (the common source / throttle shape)
+        Tagged,     // one tagged event replaced each cycle (alarm / window boundary)
+        Mixed,      // a tagged deadline plus several untagged wake-ups
+    };
+
+    struct Result
+    {
+        double ns_per_op{0.0};
+        double allocations_per_op{0.0};
+    };
+
+    const SchedulerTag deadline_tag{"deadline"};
+
+    void reschedule(Pattern pattern, const NodeScheduler &scheduler, DateTime now)
+    {
+        switch (pattern)
+        {
+            case Pattern::Untagged: scheduler.schedule(now + TimeDelta{1}); break;
+            case Pattern::Tagged: scheduler.schedule(now + TimeDelta{1}, deadline_tag); break;
+            case Pattern::Mixed:
+                scheduler.schedule(now + TimeDelta{8}, deadline_tag);
+                for (int offset = 1; offset <= 4; ++offset) { scheduler.schedule(now + TimeDelta{offset}); }
+                break;
+        }
+    }
+
+    Result run(Pattern pattern, std::size_t states, std::size_t cycles)
+    {
+        std::vector<NodeSchedulerState> scheduler_states(states);
+        DateTime                        now = MIN_ST;
+        const auto                      cycle = [&] {
+            for (NodeSchedulerState &state : scheduler_states)
+            {
+                const NodeScheduler scheduler{state, nullptr, 0, now};
+                scheduler.advance();
+                reschedule(pattern, scheduler, now);
+            }
+            now += TimeDelta{1};
+        };
+        for (std::size_t warmup = 0; warmup < cycles / 10 + 1; ++warmup) { cycle(); }
+
+        std::size_t allocations = 0;
+        const auto  start = std::chrono::steady_clock::now();
+        {
+            AllocationScope scope;
+            for (std::size_t index = 0; index < cycles; ++index) { cycle(); }
+            allocations = g_allocations.load(std::memory_order_relaxed);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ops = static_cast<double>(states) * static_cast<double>(cycles);
+        return Result{
+            .ns_per_op          = std::chrono::duration<double, std::nano>(end - start).count() / ops,
+            .allocations_per_op = static_cast<double>(allocations) / ops,
+        };
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr || *value == '\0') { return fallback; }
+        return std::max<std::size_t>(1, static_cast<std::size_t>(std::strtoull(value, nullptr, 10)));
+    }
+}  // namespace
+
+void *operator new(std::size_t size)
+{
+    if (g_count_allocations.load(std::memory_order_relaxed)) { g_allocations.fetch_add(1, std::memory_order_relaxed); }
+    if (void *memory = std::malloc(size)) { return memory; }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size)
+{
+    if (g_count_allocations.load(std::memory_order_relaxed)) { g_allocations.fetch_add(1, std::memory_order_relaxed); }
+    if (void *memory = std::malloc(size)) { return memory; }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    const std::size_t states = env_size("HGRAPH_NODE_SCHEDULER_PERF_STATES", 4096);
+    const std::size_t cycles = env_size("HGRAPH_NODE_SCHEDULER_PERF_CYCLES", 1000);
+
+    constexpr std::pair<Pattern, std::string_view> patterns[]{
+        {Pattern::Untagged, "untagged"},
+        {Pattern::Tagged, "tagged"},
+        {Pattern::Mixed, "mixed"},
+    };
+
+    std::cout << "states=" << states << " cycles=" << cycles << '\n';
+    for (const auto &[pattern, name] : patterns)
+    {
+        const Result result = run(pattern, states, cycles);
+        std::cout << name << " ns_per_op=" << result.ns_per_op << " allocations_per_op=" << result.allocations_per_op
+                  << '\n';
+    }
+}
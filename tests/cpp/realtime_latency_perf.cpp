@@ -0,0 +1,172 @@
+#include <hgraph/lib/testing/runtime_support.h>
+#include <hgraph/runtime/runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Push wake-up latency of the real-time executor. A producer thread sends
+// HGRAPH_REALTIME_LATENCY_PERF_SAMPLES timestamped values through a push
+// source, waiting for each to be consumed and then idling for
+// HGRAPH_REALTIME_LATENCY_PERF_GAP_US so the run loop is back at its wait
+// point before the next send. The sink records send-to-evaluate latency and
+// the benchmark reports percentiles per RealTimeWaitOptions configuration.
+// HGRAPH_REALTIME_LATENCY_PERF_CPU adds a spinning run pinned to that CPU;
+// spin configurations want a spare core each for the producer and the run.
+
+namespace
+{
+    using namespace hgraph;
+
+    [[nodiscard]] std::int64_t steady_ns() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    struct LatencyRecorder
+    {
+        std::vector<std::int64_t> latencies_ns{};
+        std::atomic<std::size_t>  consumed{0};
+    };
+
+    NodeBuilder latency_sink(const TSValueTypeMetaData &input_schema,
+                             const TSValueTypeMetaData &input_ts,
+                             LatencyRecorder          &recorder)
+    {
+        NodeTypeMetaData schema;
+        schema.display_name = "realtime_latency_perf_sink";
+        schema.input_schema = &input_schema;
+        schema.node_kind    = NodeKind::Sink;
+
+        NodeCallbacks callbacks;
+        callbacks.evaluate = [&recorder](const NodeView &view, DateTime evaluation_time) {
+            const std::int64_t received = steady_ns();
+            auto               root     = view.input(evaluation_time);
+            auto               bundle   = root.as_bundle();
+            auto               input    = bundle[0];
+            const Int          sent     = input.value().checked_as<Int>();
+            recorder.latencies_ns.push_back(received - static_cast<std::int64_t>(sent));
+            recorder.consumed.fetch_add(1, std::memory_order_release);
+        };
+
+        return NodeBuilder::native(std::move(schema),
+                                   std::move(callbacks),
+                                   testing::single_input_endpoint(input_schema, input_ts));
+    }
+
+    struct Result
+    {
+        double p50_us{0.0};
+        double p90_us{0.0};
+        double p99_us{0.0};
+        double p999_us{0.0};
+        double max_us{0.0};
+    };
+
+    [[nodiscard]] Result run(const RealTimeWaitOptions &options, std::size_t samples, std::chrono::microseconds gap)
+    {
+        auto       &registry     = TypeRegistry::instance();
+        const auto *ts_int       = registry.ts(registry.register_scalar<Int>("int"));
+        const auto *input_schema = testing::single_input_schema(*ts_int);
+
+        LatencyRecorder recorder;
+        recorder.latencies_ns.reserve(samples);
+        PushSourceSender  sender;
+        std::atomic<bool> sender_ready{false};
+
+        GraphBuilder graph_builder;
+        graph_builder.add_node(make_push_source_node(*ts_int, [&](PushSourceSender started) {
+            sender = std::move(started);
+            sender_ready.store(true, std::memory_order_release);
+        }));
+        graph_builder.add_node(latency_sink(*input_schema, *ts_int, recorder));
+        graph_builder.add_edge(GraphEdge{
+            .source_node = make_graph_edge_source(0),
+            .source_path = {},
+            .target_node = 1,
+            .target_path = {0},
+        });
+
+        const DateTime       start_time = testing::wall_now();
+        GraphExecutorBuilder executor_builder;
+        executor_builder.graph_builder(std::move(graph_builder))
+            .mode(GraphExecutorMode::RealTime)
+            .start_time(start_time)
+            .end_time(start_time + TimeDelta{std::chrono::hours{1}})
+            .realtime_wait_options(options);
+
+        GraphExecutorValue executor = executor_builder.make_executor();
+        auto               view     = executor.view();
+        {
+            testing::AsyncGraphExecutorRun runner{view};
+            while (!sender_ready.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+            for (std::size_t index = 0; index < samples; ++index)
+            {
+                std::this_thread::sleep_for(gap);
+                sender.send(Int{steady_ns()});
+                while (recorder.consumed.load(std::memory_order_acquire) <= index) { std::this_thread::yield(); }
+            }
+            view.request_stop();
+            runner.join();
+        }
+
+        std::vector<std::int64_t> &latencies = recorder.latencies_ns;
+        std::sort(latencies.begin(), latencies.end());
+        const auto percentile = [&latencies](double fraction) {
+            const auto index = static_cast<std::size_t>(fraction * static_cast<double>(latencies.size() - 1));
+            return static_cast<double>(latencies[index]) / 1000.0;
+        };
+        return Result{
+            .p50_us  = percentile(0.50),
+            .p90_us  = percentile(0.90),
+            .p99_us  = percentile(0.99),
+            .p999_us = percentile(0.999),
+            .max_us  = static_cast<double>(latencies.back()) / 1000.0,
+        };
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr || *value == '\0') { return fallback; }
+        return std::max<std::size_t>(1, static_cast<std::size_t>(std::strtoull(value, nullptr, 10)));
+    }
+}  // namespace
+
+int main()
+{
+    using namespace hgraph;
+
+    const std::size_t samples = env_size("HGRAPH_REALTIME_LATENCY_PERF_SAMPLES", 2000);
+    const std::chrono::microseconds gap{env_size("HGRAPH_REALTIME_LATENCY_PERF_GAP_US", 200)};
+    const char *cpu = std::getenv("HGRAPH_REALTIME_LATENCY_PERF_CPU");
+
+    std::vector<std::pair<std::string, RealTimeWaitOptions>> configurations{
+        {"park", RealTimeWaitOptions{}},
+        {"spin_1ms", RealTimeWaitOptions{.spin_budget = TimeDelta{1'000}}},
+    };
+    if (cpu != nullptr && *cpu != '\0')
+    {
+        configurations.emplace_back("spin_1ms_pinned",
+                                    RealTimeWaitOptions{.spin_budget = TimeDelta{1'000}, .pin_cpu = std::atoi(cpu)});
+    }
+
+    std::cout << "samples=" << samples << " gap_us=" << gap.count() << '\n';
+    for (const auto &[name, options] : configurations)
+    {
+        const Result result = run(options, samples, gap);
+        std::cout << name << " p50_us=" << result.p50_us << " p90_us=" << result.p90_us << " p99_us=" << result.p99_us
+                  << " p999_us=" << result.p999_us << " max_us=" << result.max_us << '\n';
+    }
+}
@@ -12,6 +12,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <limits>
 
 #include <optional>
 #include <string>
@@ -285,6 +286,52 @@ namespace
             if (pulse.ticked()) { out.tick(); }
         }
     };
+
+    using IntKeyedDict = TSD<Int, TS<Int>>;
+
+    struct DictRefSelector
+    {
+        static constexpr auto name = "collection_dict_ref_selector";
+
+        static void eval(In<"pick_rhs", TS<Bool>> pick_rhs,
+                         In<"lhs", IntKeyedDict, InputValidity::Unchecked> lhs,
+                         In<"rhs", IntKeyedDict, InputValidity::Unchecked> rhs,
+                         Out<REF<IntKeyedDict>> out)
+        {
+            if (!pick_rhs.modified()) { return; }
+            out.set(pick_rhs.value() ? rhs.base().reference() : lhs.base().reference());
+        }
+    };
+
+    // sum_ reads a dict through a reference that retargets mid-run, so its
+    // incremental state must notice the rebind and rescan.
+    struct RebindingDictSumGraph
+    {
+        static constexpr auto name = "rebinding_dict_sum_graph";
+
+        static Port<TS<Int>> compose(Wiring &w, Port<TS<Bool>> pick_rhs, Port<IntKeyedDict> lhs,
+                                     Port<IntKeyedDict> rhs)
+        {
+            auto selected = wire<DictRefSelector>(w, pick_rhs, lhs, rhs).as<IntKeyedDict>();
+            return wire<stdlib::sum_>(w, selected).as<TS<Int>>();
+        }
+    };
+
+    /** Compare float aggregate ticks, treating NaN as equal to NaN. */
+    template <typename Output>
+    void check_float_ticks(const Output &actual, const std::vector<Float> &expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+        for (std::size_t tick = 0; tick < expected.size(); ++tick)
+        {
+            INFO("tick " << tick);
+            REQUIRE(actual[tick].has_value());
+            const Float value = actual[tick]->view().template checked_as<Float>();
+            if (std::isnan(expected[tick])) { CHECK(std::isnan(value)); }
+            else if (std::isinf(expected[tick])) { CHECK(value == expected[tick]); }
+            else { CHECK(std::abs(value - expected[tick]) < 1e-12); }
+        }
+    }
 }  // namespace
 
 TEST_CASE("collections: TSD typed output creates keys and typed input iterates child values")
@@ -1073,6 +1120,108 @@ TEST_CASE("collections: TSD unary mean std and variance reduce valid child value
                  values<Float>(0.0, 0.0, 0.5, 35.0 / 12.0));
 }
 
+TEST_CASE("collections: TSD unary aggregates track removals, updates and an emptied dict")
+{
+    using namespace hgraph;
+    using namespace hgraph::testing;
+    stdlib::register_standard_operators();
+
+    const auto ticks = [] {
+        return values<Value>(dict_delta<Int, TS<Float>>({{1, 1.5}, {2, 2.5}, {3, 4.0}}),
+                             dict_delta<Int, TS<Float>>({{2, -1.0}}),
+                             dict_delta<Int, TS<Float>>({}, {1}),
+                             dict_delta<Int, TS<Float>>({{4, 10.0}}),
+                             dict_delta<Int, TS<Float>>({}, {2, 3, 4}),
+                             dict_delta<Int, TS<Float>>({{5, 3.0}, {6, 5.0}}));
+    };
+    // The live values after each tick, for the reference two-pass moments.
+    const std::vector<std::vector<Float>> live{
+        {1.5, 2.5, 4.0}, {1.5, -1.0, 4.0}, {-1.0, 4.0}, {-1.0, 4.0, 10.0}, {}, {3.0, 5.0}};
+
+    CHECK_OUTPUT((eval_node<stdlib::sum_, TSD<Int, TS<Float>>>(ticks())),
+                 values<Float>(8.0, 4.5, 3.0, 13.0, 0.0, 8.0));
+
+    const auto var_out = eval_node<stdlib::var_, TSD<Int, TS<Float>>>(ticks());
+    REQUIRE(var_out.size() == live.size());
+    for (std::size_t tick = 0; tick < live.size(); ++tick)
+    {
+        const auto &xs       = live[tick];
+        Float       expected = 0.0;
+        if (xs.size() > 1)
+        {
+            Float mean = 0.0;
+            for (const Float x : xs) { mean += x; }
+            mean /= static_cast<Float>(xs.size());
+            for (const Float x : xs) { expected += (x - mean) * (x - mean); }
+            expected /= static_cast<Float>(xs.size() - 1);
+        }
+        REQUIRE(var_out[tick].has_value());
+        CHECK(std::abs(var_out[tick]->view().checked_as<Float>() - expected) < 1e-12);
+    }
+}
+
+TEST_CASE("collections: TSD unary aggregates recover once a non-finite value is removed or replaced")
+{
+    using namespace hgraph;
+    using namespace hgraph::testing;
+    stdlib::register_standard_operators();
+
+    constexpr Float nan   = std::numeric_limits<Float>::quiet_NaN();
+    constexpr Float inf   = std::numeric_limits<Float>::infinity();
+    const auto      ticks = [=] {
+        return values<Value>(dict_delta<Int, TS<Float>>({{1, 1.0}, {2, nan}}),
+                             dict_delta<Int, TS<Float>>({}, {2}),
+                             dict_delta<Int, TS<Float>>({{3, -inf}}),
+                             dict_delta<Int, TS<Float>>({{3, 2.0}}));
+    };
+
+    check_float_ticks(eval_node<stdlib::sum_, TSD<Int, TS<Float>>>(ticks()), {nan, 1.0, -inf, 3.0});
+    check_float_ticks(eval_node<stdlib::mean, TSD<Int, TS<Float>>>(ticks()), {nan, 1.0, -inf, 1.5});
+    check_float_ticks(eval_node<stdlib::var_, TSD<Int, TS<Float>>>(ticks()), {nan, 0.0, nan, 0.5});
+}
+
+TEST_CASE("collections: TSD unary aggregates rescan when the bound dict is rebound")
+{
+    using namespace hgraph;
+    using namespace hgraph::testing;
+    stdlib::register_standard_operators();
+
+    // cycle 0 reads rhs; cycle 2 retargets to lhs, whose whole current
+    // content is summed, and rhs's tick that cycle is not observed.
+    CHECK_OUTPUT(eval_node<RebindingDictSumGraph>(
+                     values<Bool>(true, none, false, none),
+                     values<Value>(dict_delta<Int, TS<Int>>({{1, 1}, {2, 2}}),
+                                   dict_delta<Int, TS<Int>>({{3, 3}}),
+                                   none,
+                                   dict_delta<Int, TS<Int>>({}, {1})),
+                     values<Value>(dict_delta<Int, TS<Int>>({{1, 100}}),
+                                   dict_delta<Int, TS<Int>>({{2, 200}}),
+                                   dict_delta<Int, TS<Int>>({{3, 300}}),
+                                   none)),
+                 values<Int>(100, 300, 6, 5));
+}
+
+TEST_CASE("collections: TSS unary aggregates track added and removed elements")
+{
+    using namespace hgraph;
+    using namespace hgraph::testing;
+    stdlib::register_standard_operators();
+
+    const auto ticks = [] {
+        return values<Value>(set_delta<Int>({1, 2, 3}, {}),
+                             set_delta<Int>({4}, {2}),
+                             set_delta<Int>({}, {1, 3, 4}),
+                             set_delta<Int>({5}, {}));
+    };
+    CHECK_OUTPUT((eval_node<stdlib::sum_, TSS<Int>>(ticks())), values<Int>(6, 8, 0, 5));
+    check_float_ticks(eval_node<stdlib::var_, TSS<Int>>(ticks()), {1.0, 7.0 / 3.0, 0.0, 0.0});
+
+    constexpr Float inf = std::numeric_limits<Float>::infinity();
+    check_float_ticks(eval_node<stdlib::sum_, TSS<Float>>(values<Value>(set_delta<Float>({1.0, inf}, {}),
+                                                                        set_delta<Float>({2.0}, {inf}))),
+                      {inf, 3.0});
+}
+
 TEST_CASE("collections: TSL unary min max and sum reduce valid child values")
 {
     using namespace hgraph;
@@ -1098,6 +1247,26 @@ TEST_CASE("collections: TSL unary min max and sum reduce valid child values")
                  values<Int>(3, 15, 24));
 }
 
+TEST_CASE("collections: TSL unary aggregates recover once a non-finite element is replaced")
+{
+    using namespace hgraph;
+    using namespace hgraph::testing;
+    stdlib::register_standard_operators();
+
+    constexpr Float nan   = std::numeric_limits<Float>::quiet_NaN();
+    constexpr Float inf   = std::numeric_limits<Float>::infinity();
+    const auto      ticks = [=] {
+        return values<Value>(list_delta<TS<Float>>({1.0, nan, 3.0}),
+                             list_delta<TS<Float>>({{1, 2.0}}),
+                             list_delta<TS<Float>>({{0, inf}}),
+                             list_delta<TS<Float>>({{0, 4.0}}));
+    };
+
+    check_float_ticks(eval_node<stdlib::sum_, TSL<TS<Float>, 3>>(ticks()), {nan, 6.0, inf, 9.0});
+    check_float_ticks(eval_node<stdlib::mean, TSL<TS<Float>, 3>>(ticks()), {nan, 2.0, inf, 3.0});
+    check_float_ticks(eval_node<stdlib::var_, TSL<TS<Float>, 3>>(ticks()), {nan, 1.0, nan, 1.0});
+}
+
 TEST_CASE("collections: TSL unary mean std and variance match Python analytics")
 {
     using namespace hgraph;
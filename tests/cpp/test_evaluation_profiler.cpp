@@ -1,4 +1,5 @@
 #include <hgraph/lib/std/std_operators.h>
+#include <hgraph/lib/testing/runtime_support.h>
 #include <hgraph/runtime/evaluation_profiler.h>
 #include <hgraph/runtime/executor.h>
 #include <hgraph/types/graph_wiring.h>
@@ -7,8 +8,10 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 
 namespace {
 using namespace hgraph;
@@ -43,6 +46,21 @@ struct ProfileStopThrow {
   static void stop() { throw std::runtime_error("profile stop failure"); }
 };
 
+struct ProfileTickingSource {
+  static constexpr auto name = "profile_ticking_source";
+  static constexpr bool schedule_on_start = true;
+
+  static void eval(NodeScheduler sched, Scalar<"count", Int> count,
+                   State<Int> emitted, Out<TS<Int>> out) {
+    const Int n = emitted.get();
+    out.set(n);
+    emitted.set(n + 1);
+    if (n + 1 < count.value()) {
+      sched.schedule(MIN_TD);
+    }
+  }
+};
+
 template <typename Node>
 EvaluationProfileSnapshot run_profile(bool expect_failure = false) {
   stdlib::register_standard_operators();
@@ -179,3 +197,165 @@ TEST_CASE(
   CHECK(snapshot.entries.front().evaluation.count == 1);
   CHECK(snapshot.entries.front().stop.count == 0);
 }
+
+TEST_CASE("evaluation profiler: latency histograms keep log-linear precision") {
+  using std::chrono::microseconds;
+  using std::chrono::nanoseconds;
+
+  EvaluationLatencyHistogram histogram;
+  CHECK(histogram.count() == 0);
+  CHECK(histogram.p99() == nanoseconds{0});
+
+  for (int value = 1; value <= 1000; ++value) {
+    histogram.record(microseconds{value});
+  }
+  CHECK(histogram.count() == 1000);
+  CHECK(histogram.max() == microseconds{1000});
+
+  // Each reported percentile is the bound of the bucket holding that rank,
+  // at most one sub-bucket (1/16) above the exact sample.
+  const auto within_bucket = [](nanoseconds reported, microseconds exact) {
+    return reported >= exact && reported <= exact + exact / 16;
+  };
+  CHECK(within_bucket(histogram.p50(), microseconds{500}));
+  CHECK(within_bucket(histogram.p99(), microseconds{990}));
+  CHECK(histogram.p999() <= histogram.max());
+  CHECK(histogram.percentile(1.0) == histogram.max());
+
+  EvaluationLatencyHistogram small;
+  small.record(nanoseconds{3});
+  small.record(nanoseconds{7});
+  CHECK(small.p50() == nanoseconds{3});
+  histogram.merge(small);
+  CHECK(histogram.count() == 1002);
+  CHECK(histogram.percentile(0.0) == nanoseconds{3});
+  histogram.clear();
+  CHECK(histogram.count() == 0);
+}
+
+TEST_CASE("evaluation profiler: pushed values are timed from send to sink") {
+  auto &registry = TypeRegistry::instance();
+  const auto *ts_int = registry.ts(registry.register_scalar<Int>("int"));
+  const auto *input_schema = testing::single_input_schema(*ts_int);
+
+  EvaluationProfiler profiler;
+  Int observed_value{0};
+  std::int32_t sink_eval_count{0};
+  PushSourceSender sender;
+
+  GraphBuilder graph;
+  graph.add_node(testing::capturing_push_source(*ts_int, sender));
+  graph.add_node(testing::recording_scalar_sink<Int>(
+      *input_schema, *ts_int, observed_value, sink_eval_count));
+  graph.add_edge(GraphEdge{
+      .source_node = make_graph_edge_source(0),
+      .source_path = {},
+      .target_node = 1,
+      .target_path = {0},
+  });
+
+  const DateTime start_time = testing::wall_now();
+  GraphExecutorBuilder builder;
+  builder.graph_builder(std::move(graph))
+      .mode(GraphExecutorMode::RealTime)
+      .start_time(start_time)
+      .end_time(start_time + TimeDelta{1'000'000})
+      .add_lifecycle_observer(&profiler);
+  GraphExecutorValue executor = builder.make_executor();
+  auto view = executor.view();
+
+  {
+    testing::AsyncGraphExecutorRun runner{view};
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    REQUIRE(sender.valid());
+    sender.send(Int{5});
+    runner.join();
+  }
+  REQUIRE(sink_eval_count == 1);
+
+  const EvaluationProfileSnapshot snapshot = profiler.snapshot();
+  CHECK(snapshot.cycle_duration.count() == snapshot.graph_cycles);
+  CHECK(snapshot.push_queue_dwell.count() == 1);
+  REQUIRE(snapshot.push_to_sink.count() == 1);
+  CHECK(snapshot.push_to_sink.max() >= snapshot.push_queue_dwell.max());
+
+  const EvaluationProfileEntry &sink =
+      entry_containing(snapshot, "<1>");
+  // Per-node histograms are opt-in; the run-wide ones above are not.
+  CHECK_FALSE(sink.evaluation_latency.has_value());
+}
+
+TEST_CASE("evaluation profiler: sampling measures one root cycle in N") {
+  stdlib::register_standard_operators();
+  EvaluationProfiler profiler{
+      EvaluationProfilerOptions{.node_histograms = true, .sample_every = 4}};
+
+  Wiring wiring;
+  auto ticks = wire<ProfileTickingSource>(wiring, Int{10});
+  auto output = wire<ProfileAddOne>(wiring, ticks);
+  static_cast<void>(wire<stdlib::null_sink>(wiring, output));
+
+  GraphExecutorBuilder builder;
+  builder.graph_builder(std::move(wiring).finish())
+      .add_lifecycle_observer(&profiler);
+  GraphExecutorValue executor = builder.make_executor();
+  executor.view().run();
+
+  // Cycles 0, 4 and 8 of ten are measured; start and stop always are.
+  const EvaluationProfileSnapshot snapshot = profiler.snapshot();
+  CHECK(snapshot.graph_cycles == 10);
+  CHECK(snapshot.sampled_cycles == 3);
+  CHECK(snapshot.cycle_duration.count() == 3);
+
+  const EvaluationProfileEntry &graph = entry_containing(snapshot, "[]");
+  CHECK(graph.evaluation.count == 3);
+  const EvaluationProfileEntry &node =
+      entry_containing(snapshot, "profile_add_one");
+  CHECK(node.start.count == 1);
+  CHECK(node.evaluation.count == 3);
+  CHECK(node.stop.count == 1);
+  REQUIRE(node.evaluation_latency.has_value());
+  CHECK(node.evaluation_latency->count() == 3);
+
+  profiler.reset();
+  CHECK(profiler.snapshot().entries.empty());
+}
+
+TEST_CASE("evaluation profiler: hardware counters attribute or report why not") {
+  stdlib::register_standard_operators();
+  EvaluationProfiler profiler{
+      EvaluationProfilerOptions{.hardware_counters = true}};
+
+  Wiring wiring;
+  auto ticks = wire<ProfileTickingSource>(wiring, Int{5});
+  auto output = wire<ProfileAddOne>(wiring, ticks);
+  static_cast<void>(wire<stdlib::null_sink>(wiring, output));
+
+  GraphExecutorBuilder builder;
+  builder.graph_builder(std::move(wiring).finish())
+      .add_lifecycle_observer(&profiler);
+  GraphExecutorValue executor = builder.make_executor();
+  executor.view().run();
+
+  // Containers and VMs often expose no PMU; profiling must carry on.
+  const EvaluationProfileSnapshot snapshot = profiler.snapshot();
+  const EvaluationProfileEntry &node =
+      entry_containing(snapshot, "profile_add_one");
+  CHECK(node.evaluation.count == 5);
+  if (!snapshot.hardware_counters_available) {
+    CHECK_FALSE(snapshot.hardware_counters_error.empty());
+    CHECK_FALSE(node.hardware_counters.has_value());
+    return;
+  }
+  // A member the PMU does not expose is named and reads as zero.
+  REQUIRE(node.hardware_counters.has_value());
+  if (!snapshot.hardware_counters_error.contains("instructions")) {
+    CHECK(node.hardware_counters->instructions > 0);
+  } else {
+    CHECK(node.hardware_counters->instructions == 0);
+  }
+  const EvaluationProfileEntry &graph = entry_containing(snapshot, "[]");
+  REQUIRE(graph.hardware_counters.has_value());
+  CHECK(graph.hardware_counters->instructions >=
+        node.hardware_counters->instructions);
+}
@@ -0,0 +1,118 @@
+#include <hgraph/lib/std/std_operators.h>
+#include <hgraph/lib/std/value_util.h>
+#include <hgraph/runtime/evaluation_timeline.h>
+#include <hgraph/runtime/executor.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+#include <hgraph/types/subgraph_wiring.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace hgraph;
+
+    struct TimelineAddOne
+    {
+        static constexpr auto name = "timeline_add_one";
+
+        static Port<TS<Int>> compose(Wiring &, Port<TS<Int>> value)
+        {
+            using namespace hgraph::stdlib::syntax;
+            return (value + Int{1}).as<TS<Int>>();
+        }
+    };
+
+    void run_keyed_graph(EvaluationTimeline &timeline, Int key_count = 2)
+    {
+        stdlib::register_standard_operators();
+
+        std::vector<std::pair<Str, Int>> entries;
+        for (Int key = 0; key < key_count; ++key) { entries.emplace_back(Str{"k" + std::to_string(key)}, key); }
+
+        Wiring wiring;
+        auto   dict = wire<stdlib::const_, TSD<Str, TS<Int>>>(
+            wiring, stdlib::make_map<Str, Int>(entries.begin(), entries.end()));
+        static_cast<void>(wire<stdlib::map_>(wiring, fn<TimelineAddOne>(), dict));
+
+        GraphExecutorBuilder builder;
+        builder.graph_builder(std::move(wiring).finish()).add_lifecycle_observer(&timeline);
+        GraphExecutorValue executor = builder.make_executor();
+        executor.view().run();
+    }
+
+    [[nodiscard]] std::size_t occurrences(std::string_view text, std::string_view needle)
+    {
+        std::size_t count = 0;
+        for (std::size_t at = text.find(needle); at != std::string_view::npos; at = text.find(needle, at + 1))
+        {
+            ++count;
+        }
+        return count;
+    }
+}  // namespace
+
+TEST_CASE("evaluation timeline: cycles, nested child graphs and nodes become trace spans")
+{
+    EvaluationTimeline timeline;
+    run_keyed_graph(timeline);
+
+    CHECK(timeline.size() > 0);
+    CHECK(timeline.dropped() == 0);
+
+    std::ostringstream out;
+    timeline.write_chrome_trace(out);
+    const std::string trace = out.str();
+
+    CHECK(trace.starts_with("{\"displayTimeUnit\":\"ns\""));
+    CHECK(occurrences(trace, "\"ph\":\"X\"") == timeline.size());
+    CHECK(occurrences(trace, "\"cat\":\"cycle\"") == 1);
+    // One child graph per key of the map_.
+    CHECK(occurrences(trace, "\"cat\":\"graph\"") >= 2);
+    CHECK(occurrences(trace, "\"cat\":\"node\"") >= 4);
+    CHECK(trace.contains("\"cat\":\"start\""));
+    CHECK(trace.contains("\"cat\":\"stop\""));
+    CHECK(trace.contains("\"evaluation_time_us\":"));
+    CHECK(trace.contains("timeline_add_one"));
+    CHECK(trace.ends_with("]}\n"));
+
+    timeline.clear();
+    CHECK(timeline.size() == 0);
+}
+
+TEST_CASE("evaluation timeline: a full ring keeps the newest spans and counts the rest")
+{
+    EvaluationTimeline timeline{EvaluationTimelineOptions{.capacity = 3, .lifecycle = false}};
+    run_keyed_graph(timeline);
+
+    // Capacity rounds up to a power of two.
+    REQUIRE(timeline.size() == 4);
+    CHECK(timeline.dropped() > 0);
+
+    std::ostringstream out;
+    timeline.write_chrome_trace(out);
+    const std::string trace = out.str();
+    CHECK(occurrences(trace, "\"ph\":\"X\"") == 4);
+    CHECK_FALSE(trace.contains("\"cat\":\"start\""));
+    // The root cycle ends last, so it is always retained.
+    CHECK(occurrences(trace, "\"cat\":\"cycle\"") == 1);
+    CHECK(trace.contains("\"dropped_spans\":" + std::to_string(timeline.dropped())));
+}
+
+TEST_CASE("evaluation timeline: span names do not grow with the keys of a nested operator")
+{
+    EvaluationTimeline few{EvaluationTimelineOptions{.capacity = 16}};
+    run_keyed_graph(few, 2);
+    EvaluationTimeline many{EvaluationTimelineOptions{.capacity = 16}};
+    run_keyed_graph(many, 64);
+
+    CHECK(few.name_count() > 0);
+    CHECK(many.name_count() == few.name_count());
+}
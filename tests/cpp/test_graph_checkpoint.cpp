@@ -0,0 +1,363 @@
+#include <hgraph/lib/std/std_operators.h>
+#include <hgraph/lib/std/value_util.h>
+#include <hgraph/runtime/executor.h>
+#include <hgraph/runtime/graph.h>
+#include <hgraph/runtime/graph_checkpoint.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+#include <hgraph/types/subgraph_wiring.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace hgraph;
+
+    std::vector<Int> g_sums;
+
+    struct CheckpointTickingSource
+    {
+        static constexpr auto name              = "checkpoint_ticking_source";
+        static constexpr bool schedule_on_start = true;
+        static void           eval(NodeScheduler sched, Scalar<"count", Int> count, State<Int> emitted,
+                                    Out<TS<Int>> out)
+        {
+            const Int n = emitted.get();
+            out.set(n);
+            emitted.set(n + 1);
+            if (n + 1 < count.value()) { sched.schedule(TimeDelta{10}); }
+        }
+    };
+
+    struct CheckpointRunningSum
+    {
+        static constexpr auto name = "checkpoint_running_sum";
+        static void           eval(In<"in", TS<Int>> in, State<Int> sum, Out<TS<Int>> out)
+        {
+            sum.set(sum.get() + in.value());
+            out.set(sum.get());
+            g_sums.push_back(sum.get());
+        }
+    };
+
+    struct CheckpointGraph
+    {
+        static constexpr auto name = "checkpoint_graph";
+        static void           compose(Wiring &w)
+        {
+            auto source = wire<CheckpointTickingSource>(w, 6);
+            wire<CheckpointRunningSum>(w, source);
+        }
+    };
+
+    struct CheckpointAddOne
+    {
+        static constexpr auto name = "checkpoint_add_one";
+
+        static Port<TS<Int>> compose(Wiring &, Port<TS<Int>> value)
+        {
+            using namespace hgraph::stdlib::syntax;
+            return (value + Int{1}).as<TS<Int>>();
+        }
+    };
+
+    struct CheckpointSwitchedGraph
+    {
+        static constexpr auto name = "checkpoint_switched_graph";
+        static void           compose(Wiring &w)
+        {
+            auto selector = wire<stdlib::const_, TS<Str>>(w, Str{"one"});
+            auto value    = wire<stdlib::const_, TS<Int>>(w, Int{1});
+            static_cast<void>(wire<stdlib::switch_>(w, selector,
+                                                    stdlib::switch_cases({
+                                                        {Value{Str{"one"}}, fn<CheckpointAddOne>()},
+                                                        {Value{Str{"two"}}, fn<CheckpointAddOne>()},
+                                                    }),
+                                                    value));
+        }
+    };
+
+    struct CheckpointTicks
+    {
+        static constexpr auto name = "checkpoint_ticks";
+        static void eval(In<"ts", TS<Int>, InputValidity::Unchecked> ts, State<Int> ticks, Out<TS<Int>> out)
+        {
+            static_cast<void>(ts);
+            ticks.set(ticks.get() + 1);
+            out.set(ticks.get());
+        }
+    };
+
+    struct CheckpointSwitchedReaderGraph
+    {
+        static constexpr auto name = "checkpoint_switched_reader_graph";
+        static void           compose(Wiring &w)
+        {
+            auto selector = wire<stdlib::const_, TS<Str>>(w, Str{"one"});
+            auto value    = wire<stdlib::const_, TS<Int>>(w, Int{1});
+            auto switched = wire<stdlib::switch_>(w, selector,
+                                                  stdlib::switch_cases({
+                                                      {Value{Str{"one"}}, fn<CheckpointAddOne>()},
+                                                      {Value{Str{"two"}}, fn<CheckpointAddOne>()},
+                                                  }),
+                                                  value)
+                                .as<TS<Int>>();
+            auto ticks = wire<CheckpointTicks>(w, switched);
+            static_cast<void>(wire<CheckpointRunningSum>(w, ticks));
+        }
+    };
+
+    /** Ticks ``a = n`` and ``b = 10 n`` every 10 until ``count`` ticks. */
+    struct CheckpointTickingDict
+    {
+        static constexpr auto name              = "checkpoint_ticking_dict";
+        static constexpr bool schedule_on_start = true;
+        static void           eval(NodeScheduler sched, Scalar<"count", Int> count, State<Int> emitted,
+                                    Out<TSD<Str, TS<Int>>> out)
+        {
+            const Int n        = emitted.get();
+            auto      mutation = out.begin_mutation(out.evaluation_time());
+            Value     key_a{Str{"a"}};
+            Value     value_a{n};
+            Value     key_b{Str{"b"}};
+            Value     value_b{10 * n};
+            mutation.set(key_a.view(), value_a.view());
+            mutation.set(key_b.view(), value_b.view());
+            emitted.set(n + 1);
+            if (n + 1 < count.value()) { sched.schedule(TimeDelta{10}); }
+        }
+    };
+
+    struct CheckpointKeySum
+    {
+        static constexpr auto name = "checkpoint_key_sum";
+        static void           eval(In<"in", TS<Int>> in, State<Int> sum, Out<TS<Int>> out)
+        {
+            sum.set(sum.get() + in.value());
+            out.set(sum.get());
+        }
+    };
+
+    struct CheckpointKeyRunningSum
+    {
+        static constexpr auto name = "checkpoint_key_running_sum";
+
+        static Port<TS<Int>> compose(Wiring &w, Port<TS<Int>> value)
+        {
+            return wire<CheckpointKeySum>(w, value).as<TS<Int>>();
+        }
+    };
+
+    struct CheckpointDictTotal
+    {
+        static constexpr auto name = "checkpoint_dict_total";
+        static void           eval(In<"d", TSD<Str, TS<Int>>> d)
+        {
+            Int total = 0;
+            for (const auto [key, value] : d.value().as_map())
+            {
+                static_cast<void>(key);
+                total += value.checked_as<Int>();
+            }
+            g_sums.push_back(total);
+        }
+    };
+
+    struct CheckpointMappedGraph
+    {
+        static constexpr auto name = "checkpoint_mapped_graph";
+        static void           compose(Wiring &w)
+        {
+            auto dict   = wire<CheckpointTickingDict>(w, 6);
+            auto mapped = wire<stdlib::map_>(w, fn<CheckpointKeyRunningSum>(), dict).as<TSD<Str, TS<Int>>>();
+            wire<CheckpointDictTotal>(w, mapped);
+        }
+    };
+
+    struct CheckpointLaggedGraph
+    {
+        static constexpr auto name = "checkpoint_lagged_graph";
+        static void           compose(Wiring &w)
+        {
+            auto source = wire<CheckpointTickingSource>(w, 6);
+            auto lagged = wire<stdlib::lag>(w, source, Int{2}).as<TS<Int>>();
+            wire<CheckpointRunningSum>(w, lagged);
+        }
+    };
+
+    /** A checkpoint file removed on scope exit. */
+    struct ScratchFile
+    {
+        std::filesystem::path path;
+
+        explicit ScratchFile(std::string_view name) : path(std::filesystem::temp_directory_path() / name)
+        {
+            std::filesystem::remove(path);
+        }
+
+        ~ScratchFile() { std::filesystem::remove(path); }
+    };
+
+    /** Captures the strict-mode failure of a checkpoint taken after each root cycle. */
+    struct StrictCheckpointProbe final : LifecycleObserver
+    {
+        void on_after_graph_evaluation(const GraphView &graph) override
+        {
+            if (!graph.is_root()) { return; }
+            std::ostringstream out;
+            try
+            {
+                static_cast<void>(write_graph_checkpoint(graph, out));
+            }
+            catch (const std::logic_error &error)
+            {
+                failure = error.what();
+            }
+        }
+
+        std::string failure{};
+    };
+
+    template <typename Graph>
+    void run_graph(LifecycleObserver &observer, DateTime start, DateTime end)
+    {
+        GraphExecutorBuilder builder;
+        builder.graph_builder(build_graph<Graph>())
+            .add_lifecycle_observer(&observer)
+            .start_time(start)
+            .end_time(end);
+        GraphExecutorValue executor = builder.make_executor();
+        executor.view().run();
+    }
+}  // namespace
+
+TEST_CASE("graph checkpoint: a restored graph continues from node state, outputs and schedules")
+{
+    stdlib::register_standard_operators();
+    ScratchFile file{"hgraph_graph_checkpoint.bin"};
+
+    g_sums.clear();
+    GraphCheckpointer first{file.path};
+    run_graph<CheckpointGraph>(first, MIN_ST, MIN_ST + TimeDelta{25});
+    CHECK(g_sums == std::vector<Int>{0, 1, 3});
+    CHECK(first.checkpoints_written() == 3);
+    CHECK_FALSE(first.restored().has_value());
+    REQUIRE(std::filesystem::exists(file.path));
+
+    // The fresh source would start again from zero at the start time; the
+    // restored one resumes at its saved schedule with its saved count.
+    g_sums.clear();
+    GraphCheckpointer second{file.path, GraphCheckpointerOptions{.every_cycles = 2}};
+    run_graph<CheckpointGraph>(second, MIN_ST + TimeDelta{26}, MIN_ST + TimeDelta{100});
+    REQUIRE(second.restored().has_value());
+    CHECK(second.restored()->evaluation_time == MIN_ST + TimeDelta{20});
+    CHECK(second.restored()->skipped == 0);
+    CHECK(g_sums == std::vector<Int>{6, 10, 15});
+    CHECK(second.checkpoints_written() == 1);
+}
+
+TEST_CASE("graph checkpoint: a restored map_ recreates its children from their saved state")
+{
+    stdlib::register_standard_operators();
+    ScratchFile file{"hgraph_graph_checkpoint_mapped.bin"};
+
+    g_sums.clear();
+    GraphCheckpointer first{file.path};
+    run_graph<CheckpointMappedGraph>(first, MIN_ST, MIN_ST + TimeDelta{25});
+    CHECK(g_sums == std::vector<Int>{0, 11, 33});
+    REQUIRE(first.checkpoints_written() == 3);
+
+    // Fresh children would restart both per-key sums at zero (3 + 30 = 33 at
+    // the next tick); restored ones carry 3 and 30 forward. The map may
+    // republish the restored totals as it recreates the children.
+    g_sums.clear();
+    GraphCheckpointer second{file.path};
+    run_graph<CheckpointMappedGraph>(second, MIN_ST + TimeDelta{26}, MIN_ST + TimeDelta{100});
+    REQUIRE(second.restored().has_value());
+    CHECK(second.restored()->skipped == 0);
+    CHECK(second.restored()->child_graphs == 2);
+    REQUIRE(g_sums.size() >= 3);
+    CHECK(std::vector<Int>(g_sums.end() - 3, g_sums.end()) == std::vector<Int>{66, 110, 165});
+    CHECK(std::ranges::all_of(g_sums.begin(), g_sums.end() - 3, [](Int total) { return total == 33; }));
+}
+
+TEST_CASE("graph checkpoint: a queued lag buffer is restored through its state codec")
+{
+    stdlib::register_standard_operators();
+    ScratchFile file{"hgraph_graph_checkpoint_lagged.bin"};
+
+    g_sums.clear();
+    GraphCheckpointer first{file.path};
+    run_graph<CheckpointLaggedGraph>(first, MIN_ST, MIN_ST + TimeDelta{25});
+    CHECK(g_sums == std::vector<Int>{0});
+
+    // 1 and 2 are still queued at the checkpoint; an empty buffer would hold
+    // the first restored tick back until 50.
+    g_sums.clear();
+    GraphCheckpointer second{file.path};
+    run_graph<CheckpointLaggedGraph>(second, MIN_ST + TimeDelta{26}, MIN_ST + TimeDelta{100});
+    REQUIRE(second.restored().has_value());
+    CHECK(second.restored()->skipped == 0);
+    CHECK(g_sums == std::vector<Int>{1, 3, 6});
+}
+
+TEST_CASE("graph checkpoint: other nested child graphs are rejected unless skipped")
+{
+    stdlib::register_standard_operators();
+
+    StrictCheckpointProbe probe;
+    run_graph<CheckpointSwitchedGraph>(probe, MIN_ST, MIN_ST + TimeDelta{10});
+    CHECK(probe.failure.contains("owns nested child graphs"));
+
+    ScratchFile       file{"hgraph_graph_checkpoint_switched.bin"};
+    GraphCheckpointer first{file.path, GraphCheckpointerOptions{.skip_unsupported = true}};
+    run_graph<CheckpointSwitchedGraph>(first, MIN_ST, MIN_ST + TimeDelta{10});
+    CHECK(first.checkpoints_written() == 1);
+
+    GraphCheckpointer second{file.path, GraphCheckpointerOptions{.skip_unsupported = true}};
+    run_graph<CheckpointSwitchedGraph>(second, MIN_ST + TimeDelta{1}, MIN_ST + TimeDelta{10});
+    REQUIRE(second.restored().has_value());
+    CHECK(second.restored()->skipped >= 1);
+    CHECK(second.restored()->skipped < second.restored()->nodes);
+}
+
+TEST_CASE("graph checkpoint: nodes downstream of a skipped node start fresh too")
+{
+    stdlib::register_standard_operators();
+    ScratchFile file{"hgraph_graph_checkpoint_switched_reader.bin"};
+
+    g_sums.clear();
+    GraphCheckpointer first{file.path, GraphCheckpointerOptions{.skip_unsupported = true}};
+    run_graph<CheckpointSwitchedReaderGraph>(first, MIN_ST, MIN_ST + TimeDelta{10});
+    CHECK(first.checkpoints_written() == 1);
+
+    // Both const_ nodes are restored; switch_, its reader and the sum behind it restart.
+    GraphCheckpointer second{file.path, GraphCheckpointerOptions{.skip_unsupported = true}};
+    run_graph<CheckpointSwitchedReaderGraph>(second, MIN_ST + TimeDelta{1}, MIN_ST + TimeDelta{10});
+    REQUIRE(second.restored().has_value());
+    CHECK(second.restored()->skipped >= 3);
+    CHECK(second.restored()->skipped < second.restored()->nodes);
+}
+
+TEST_CASE("graph checkpoint: a checkpoint of another graph is refused")
+{
+    stdlib::register_standard_operators();
+    ScratchFile file{"hgraph_graph_checkpoint_mismatch.bin"};
+
+    g_sums.clear();
+    GraphCheckpointer writer{file.path};
+    run_graph<CheckpointGraph>(writer, MIN_ST, MIN_ST + TimeDelta{5});
+    REQUIRE(writer.checkpoints_written() == 1);
+
+    GraphCheckpointer reader{file.path, GraphCheckpointerOptions{.skip_unsupported = true}};
+    CHECK_THROWS_AS(run_graph<CheckpointSwitchedGraph>(reader, MIN_ST + TimeDelta{1}, MIN_ST + TimeDelta{10}),
+                    std::runtime_error);
+}
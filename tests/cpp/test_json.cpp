@@ -317,6 +317,40 @@ TEST_CASE("json: unset bundle fields are omitted on write and null on read")
     CHECK_FALSE(bundle.at("label").has_value());
 }
 
+TEST_CASE("json: newline-delimited documents decode as one stream")
+{
+    auto &registry = TypeRegistry::instance();
+    const auto *int_meta = registry.register_scalar<Int>("int");
+    const auto *str_meta = registry.register_scalar<Str>("str");
+    const auto *bundle_meta = registry.un_named_bundle({{"count", int_meta}, {"label", str_meta}});
+    const auto &converter = json_converter(bundle_meta);
+
+    std::vector<Value> decoded;
+    from_json_lines(converter,
+                    "{\"count\": 1, \"skipped\": {\"deep\": [1, \"x\\\"y\"]}, \"label\": \"a\\nb\"}\n"
+                    "{\"label\": null, \"count\": 2}\n",
+                    decoded);
+    REQUIRE(decoded.size() == 2);
+    CHECK(decoded[0].view().as_bundle().at("count").checked_as<Int>() == Int{1});
+    CHECK(decoded[0].view().as_bundle().at("label").checked_as<Str>() == Str{"a\nb"});
+    CHECK(decoded[1].view().as_bundle().at("count").checked_as<Int>() == Int{2});
+    CHECK_FALSE(decoded[1].view().as_bundle().at("label").has_value());
+
+    CHECK_THROWS_AS(from_json_lines(converter, "{\"count\": 3}\n{\"count\": ", decoded), std::invalid_argument);
+
+    // NDJSON batches are a fixed size, so one oversized document is refused;
+    // a whole-text read of it still succeeds and the thread's parser is
+    // released back to its retained size afterwards.
+    const std::string label(std::size_t{1} << 21U, 'x');
+    const std::string oversized = "{\"count\": 4, \"label\": \"" + label + "\"}";
+    CHECK_THROWS_AS(from_json_lines(converter, oversized + "\n", decoded), std::invalid_argument);
+    CHECK(from_json_string(converter, oversized).view().as_bundle().at("label").checked_as<Str>().size() ==
+          label.size());
+    CHECK(from_json_string(int_meta, "42").view().checked_as<Int>() == Int{42});
+    CHECK_THROWS_AS(from_json_string(int_meta, "42 x"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"count\": 1} {}"), std::invalid_argument);
+}
+
 namespace
 {
     struct FromJsonGraph
@@ -329,6 +363,19 @@ namespace
         }
     };
 
+    using FromJsonBundle = UnNamedTSB<Field<"a", TS<Int>>, Field<"b", TS<Str>>>;
+
+    struct FromJsonBundleGraph
+    {
+        [[maybe_unused]] static constexpr auto name = "from_json_bundle_graph";
+
+        static Port<TS<Int>> compose(Wiring &w, Port<TS<Str>> ts)
+        {
+            auto bundle = wire<stdlib::from_json, FromJsonBundle>(w, ts);
+            return wire<stdlib::getitem_>(w, bundle, Str{"a"}).as<TS<Int>>();
+        }
+    };
+
     struct FromJsonDateTimeGraph
     {
         [[maybe_unused]] static constexpr auto name =
@@ -476,6 +523,14 @@ TEST_CASE("json operators: from_json parses into the resolved output type")
                  values<Int>(3, none, -9));
 }
 
+TEST_CASE("json operators: from_json reads a whole bundle from one parsed document")
+{
+    stdlib::register_standard_operators();
+    CHECK_OUTPUT(eval_node<FromJsonBundleGraph>(values<Str>(Str{"{\"a\": 3, \"b\": \"x\"}"}, none,
+                                                            Str{"{\"b\": \"y\", \"a\": -9}"})),
+                 values<Int>(3, none, -9));
+}
+
 TEST_CASE("json operators: temporal parsing uses the shared native format registry")
 {
     stdlib::register_standard_operators();
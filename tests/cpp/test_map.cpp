@@ -457,7 +457,8 @@ namespace
                                         std::vector<std::size_t> &counts,
                                         std::vector<std::size_t> *constructed_counts = nullptr,
                                         std::vector<NestedLifecycleSnapshot> *lifecycle = nullptr,
-                                        std::vector<std::size_t> *slot_block_counts = nullptr)
+                                        std::vector<std::size_t> *slot_block_counts = nullptr,
+                                        std::vector<std::size_t> *recycled_counts = nullptr)
     {
         std::vector<std::pair<std::string, const TSValueTypeMetaData *>> fields;
         fields.reserve(1 + triggers.size());
@@ -483,7 +484,8 @@ namespace
         meta.valid_inputs = std::vector<std::size_t>{};
 
         NodeCallbacks callbacks;
-        callbacks.evaluate = [&counts, constructed_counts, lifecycle, slot_block_counts](const NodeView &view, DateTime) {
+        callbacks.evaluate = [&counts, constructed_counts, lifecycle, slot_block_counts,
+                              recycled_counts](const NodeView &view, DateTime) {
             auto graph = view.graph();
             for (std::size_t i = 0; i < graph.node_count(); ++i) {
                 auto node = graph.node_at(i);
@@ -492,6 +494,7 @@ namespace
                     counts.push_back(map.active_count());
                     if (constructed_counts != nullptr) { constructed_counts->push_back(map.child_graph_count()); }
                     if (lifecycle != nullptr) { lifecycle->push_back(NestedLifecycleCounters::snapshot()); }
+                    if (recycled_counts != nullptr) { recycled_counts->push_back(map.recycled_child_graph_count()); }
                     return;
                 }
                 if (node.is<TslMapNodeView>()) {
@@ -1353,6 +1356,51 @@ TEST_CASE("map_: removed children stop before their source slot erases")
     CHECK(NestedLifecycleCounters::snapshot() == NestedLifecycleSnapshot{2, 0, 2, 2, 2});
 }
 
+TEST_CASE("map_: __recycle__ keeps erased children up to its high-water mark")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // Slots erase on the key set's next mutation and are reused last-freed
+    // first: a, b erase at cycle 3 (c stays pending), then d, e, f reuse
+    // c's, b's and a's slots at cycle 4, taking whatever was kept there.
+    const auto recycled_counts = [](Int limit) {
+        NestedLifecycleCounters::reset();
+        std::vector<std::size_t> active_counts;
+        std::vector<std::size_t> recycled;
+        Wiring                   w;
+        auto source = wire<stdlib::replay_impl, TSD<Str, TS<Int>>>(w, Str{"source"});
+        auto keys   = wire<stdlib::replay_impl, TSS<Str>>(w, Str{"keys"});
+        auto mapped = wire<stdlib::map_>(w, fn<NestedLifecycleNode>(), source, arg<"__keys__">(keys),
+                                         arg<"__recycle__">(limit))
+                          .as<TSD<Str, TS<Int>>>();
+
+        const std::array<WiringPortRef, 2> triggers{keys.erased(), source.erased()};
+        wire_map_active_count_recorder(w, mapped.erased(), triggers, active_counts, nullptr, nullptr, nullptr,
+                                       &recycled);
+
+        GraphBuilder gb = std::move(w).finish();
+        set_replay_deltas(gb.global_state(), "source", values<Value>(none));
+        set_replay_deltas(gb.global_state(), "keys",
+                          values<Value>(set_delta<Str>({"a"s, "b"s, "c"s}, {}),
+                                        set_delta<Str>({}, {"a"s, "b"s}),
+                                        set_delta<Str>({}, {"c"s}),
+                                        set_delta<Str>({"d"s, "e"s, "f"s}, {})));
+
+        GraphExecutorBuilder eb;
+        eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+        GraphExecutorValue ex = eb.make_executor();
+        ex.view().run();
+
+        CHECK(active_counts == std::vector<std::size_t>{3, 1, 0, 3});
+        return recycled;
+    };
+
+    CHECK(recycled_counts(Int{4}) == std::vector<std::size_t>{0, 0, 2, 0});
+    CHECK(recycled_counts(Int{1}) == std::vector<std::size_t>{0, 0, 1, 0});
+    CHECK(recycled_counts(Int{0}) == std::vector<std::size_t>{0, 0, 0, 0});
+}
+
 TEST_CASE("map_: __keys__ creates children for keys missing from the multiplexed dict")
 {
     using namespace hgraph;
@@ -1638,6 +1686,80 @@ TEST_CASE("map_: __key_arg__ renames the key parameter")
                  values<Value>(dict_delta<Int, TS<Int>>({{1, 11}, {2, 22}})));
 }
 
+TEST_CASE("map_: __parallel__ evaluates due children on the pool with serial results")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // Per-key state and partial ticks: the join must publish exactly the
+    // elements whose children evaluated, with each child's own count.
+    CHECK_OUTPUT((eval_node<stdlib::map_, TSD<Int, TS<Int>>>(
+                     fn<CounterNode>(),
+                     values<Value>(
+                         dict_delta<Int, TS<Int>>(
+                             {{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1}, {8, 1}, {9, 1}}),
+                         dict_delta<Int, TS<Int>>({{2, 2}, {5, 2}, {9, 2}}),
+                         dict_delta<Int, TS<Int>>({{5, 3}}, {7})),
+                     arg<"__parallel__">(Bool{true}))),
+                 values<Value>(
+                     dict_delta<Int, TS<Int>>(
+                         {{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1}, {8, 1}, {9, 1}}),
+                     dict_delta<Int, TS<Int>>({{2, 2}, {5, 2}, {9, 2}}),
+                     dict_delta<Int, TS<Int>>({{5, 3}}, {7})));
+}
+
+namespace
+{
+    // A parallel map feeding a parallel map: the upstream children's element
+    // writes notify the downstream map's per-key children.
+    struct ChainedParallelMapsG
+    {
+        static constexpr auto name = "chained_parallel_maps_g";
+        static Port<TSD<Int, TS<Int>>> compose(Wiring &w, Port<TSD<Int, TS<Int>>> ts)
+        {
+            auto counts = wire<stdlib::map_>(w, fn<CounterNode>(), ts, arg<"__parallel__">(Bool{true}));
+            return wire<stdlib::map_>(w, fn<AddOffsetG>(), counts, Int{100}, arg<"__parallel__">(Bool{true}))
+                .as<TSD<Int, TS<Int>>>();
+        }
+    };
+}  // namespace
+
+TEST_CASE("map_: chained __parallel__ maps publish element ticks serially")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    CHECK_OUTPUT((eval_node<ChainedParallelMapsG>(values<Value>(
+                     dict_delta<Int, TS<Int>>(
+                         {{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1}, {8, 1}, {9, 1}}),
+                     dict_delta<Int, TS<Int>>({{2, 2}, {5, 2}, {9, 2}}),
+                     dict_delta<Int, TS<Int>>({{5, 3}}, {7})))),
+                 values<Value>(
+                     dict_delta<Int, TS<Int>>({{1, 101}, {2, 101}, {3, 101}, {4, 101}, {5, 101}, {6, 101},
+                                               {7, 101}, {8, 101}, {9, 101}}),
+                     dict_delta<Int, TS<Int>>({{2, 102}, {5, 102}, {9, 102}}),
+                     dict_delta<Int, TS<Int>>({{5, 103}}, {7})));
+}
+
+TEST_CASE("map_: __recycle__ children start each new key from fresh state")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // Key 3 reuses key 1's erased slot, and its recycled child, at cycle 3.
+    CHECK_OUTPUT((eval_node<stdlib::map_, TSD<Int, TS<Int>>>(
+                     fn<CounterNode>(),
+                     values<Value>(dict_delta<Int, TS<Int>>({{1, 1}, {2, 1}}),
+                                   dict_delta<Int, TS<Int>>({}, {1}),
+                                   dict_delta<Int, TS<Int>>({{3, 1}}),
+                                   dict_delta<Int, TS<Int>>({{2, 1}, {3, 1}})),
+                     arg<"__recycle__">(Int{8}))),
+                 values<Value>(dict_delta<Int, TS<Int>>({{1, 1}, {2, 1}}),
+                               dict_delta<Int, TS<Int>>({}, {1}),
+                               dict_delta<Int, TS<Int>>({{3, 1}}),
+                               dict_delta<Int, TS<Int>>({{2, 2}, {3, 2}})));
+}
+
 TEST_CASE("map_: an empty __key_arg__ disables key consumption by name")
 {
     using namespace hgraph;
@@ -2125,6 +2247,19 @@ namespace
         }
     };
 
+    struct TslFloatMulG
+    {
+        static constexpr auto name = "tsl_float_mul_g";
+
+        static Port<TSL<TS<Float>, 4>> compose(Wiring &,
+                                               Port<TSL<TS<Float>, 4>> lhs,
+                                               Port<TSL<TS<Float>, 4>> rhs)
+        {
+            using namespace hgraph::stdlib::syntax;
+            return (lhs * rhs).as<TSL<TS<Float>, 4>>();
+        }
+    };
+
     struct MapLiftedDynamicAddTslG
     {
         static constexpr auto name = "map_lifted_dynamic_add_tsl_g";
@@ -2642,6 +2777,26 @@ TEST_CASE("map_ over TSL: lifted scalar add uses one specialised vector node")
     CHECK(operator_fn_gb.node_count() == 3);   // two const sources + one lifted TSL map node via fn<sub_>
 }
 
+TEST_CASE("map_ over TSL: arithmetic kernels tick only the ready, modified elements")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // TSL * TSL of floats resolves to the lifted map node, which evaluates
+    // through packed columns. Index 3 waits for rhs; index 1 is untouched in
+    // the second cycle; the third cycle re-emits only index 2.
+    CHECK_OUTPUT((eval_node<TslFloatMulG>(
+                     values<Value>(list_delta<TS<Float>>({{0, 1.0}, {1, 2.0}, {2, 3.0}, {3, 4.0}}),
+                                   list_delta<TS<Float>>({{0, 5.0}}),
+                                   none),
+                     values<Value>(list_delta<TS<Float>>({{0, 10.0}, {1, 10.0}, {2, 10.0}}),
+                                   list_delta<TS<Float>>({{3, 0.5}}),
+                                   list_delta<TS<Float>>({{2, -1.0}})))),
+                 values<Value>(list_delta<TS<Float>>({{0, 10.0}, {1, 20.0}, {2, 30.0}}),
+                               list_delta<TS<Float>>({{0, 50.0}, {3, 2.0}}),
+                               list_delta<TS<Float>>({{2, -3.0}})));
+}
+
 TEST_CASE("map_ over dynamic TSL: lifted scalar kernels follow grow-only runtime length")
 {
     using namespace hgraph;
@@ -1,10 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <hgraph/types/utils/graph_arena.h>
 #include <hgraph/types/utils/memory_utils.h>
 
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -145,13 +147,13 @@ namespace
         }
     };
 
-    void *tracked_allocate(MemoryUtils::StorageLayout layout) {
+    void *tracked_allocate(void *, MemoryUtils::StorageLayout layout) {
         ++AllocationProbe::allocations;
         AllocationProbe::last_layout = layout;
         return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
     }
 
-    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept {
+    void tracked_deallocate(void *, void *memory, MemoryUtils::StorageLayout layout) noexcept {
         ++AllocationProbe::deallocations;
         AllocationProbe::last_layout = layout;
         ::operator delete(memory, std::align_val_t{layout.alignment});
@@ -273,6 +275,135 @@ TEST_CASE("memory utils separates allocation through allocator ops", "[memory ut
     REQUIRE(TrackedValue::destroyed == 1);
 }
 
+TEST_CASE("memory utils allocator scopes route fresh storage to the active allocator", "[memory utils]") {
+    const auto                     &plan = MemoryUtils::plan_for<TrackedValue>();
+    const MemoryUtils::AllocatorOps allocator{
+        .allocate   = &tracked_allocate,
+        .deallocate = &tracked_deallocate,
+    };
+
+    TrackedValue::reset();
+    AllocationProbe::reset();
+
+    {
+        MemoryUtils::ErasedOwner<> outside(plan);
+        REQUIRE(outside.allocator() == &MemoryUtils::default_allocator());
+        {
+            MemoryUtils::AllocatorScope scope{allocator};
+            REQUIRE(&MemoryUtils::allocator() == &allocator);
+            MemoryUtils::ErasedOwner<> inside(plan);
+            REQUIRE(inside.allocator() == &allocator);
+            REQUIRE(AllocationProbe::allocations == 1);
+
+            // Propagating allocators follow their storage into copies.
+            MemoryUtils::ErasedOwner<> copied = inside;
+            REQUIRE(copied.allocator() == &allocator);
+            REQUIRE(AllocationProbe::allocations == 2);
+        }
+        REQUIRE(&MemoryUtils::allocator() == &MemoryUtils::default_allocator());
+        REQUIRE(AllocationProbe::deallocations == 2);
+    }
+}
+
+TEST_CASE("memory utils graph arena reuses released blocks by size class", "[memory utils]") {
+    hgraph::GraphArena arena{4096};
+    const MemoryUtils::StorageLayout small{.size = 24, .alignment = 8};
+    const MemoryUtils::StorageLayout same_class{.size = 32, .alignment = 16};
+
+    void *first  = arena.allocate(small);
+    void *second = arena.allocate(small);
+    REQUIRE(first != second);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(first) % 32 == 0);
+    // Consecutive blocks of one class sit next to each other in the chunk.
+    REQUIRE(static_cast<std::byte *>(second) - static_cast<std::byte *>(first) == 32);
+    REQUIRE(arena.stats().chunk_count == 1);
+    REQUIRE(arena.stats().live_bytes == 64);
+
+    arena.deallocate(first, small);
+    REQUIRE(arena.stats().live_bytes == 32);
+    REQUIRE(arena.allocate(same_class) == first);
+    REQUIRE(arena.stats().reuse_count == 1);
+
+    // Blocks too large to share a chunk get one of their own.
+    const MemoryUtils::StorageLayout large{.size = 8192, .alignment = 64};
+    void *big = arena.allocate(large);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(big) % 64 == 0);
+    REQUIRE(arena.stats().chunk_count == 2);
+    arena.deallocate(big, large);
+    REQUIRE(arena.allocate(large) == big);
+    REQUIRE(arena.stats().allocation_count == 5);
+}
+
+TEST_CASE("memory utils graph arena bumps static storage at exact size", "[memory utils]") {
+    hgraph::GraphArena arena{4096};
+    const MemoryUtils::StorageLayout odd{.size = 40, .alignment = 8};
+
+    void *first  = nullptr;
+    void *second = nullptr;
+    {
+        hgraph::GraphArena::StaticScope static_scope{arena};
+        first  = arena.allocate(odd);
+        second = arena.allocate(odd);
+    }
+    REQUIRE(static_cast<std::byte *>(second) - static_cast<std::byte *>(first) == 40);
+    REQUIRE(arena.stats().static_bytes == 80);
+    REQUIRE(arena.stats().allocation_count == 0);
+
+    // Released static blocks stay put; they never join a size-class free list.
+    arena.deallocate(first, odd);
+    void *dynamic = arena.allocate(odd);
+    REQUIRE(dynamic != first);
+    REQUIRE(arena.stats().live_bytes == 64);
+    arena.deallocate(dynamic, odd);
+    arena.deallocate(second, odd);
+    REQUIRE(arena.stats().live_bytes == 0);
+}
+
+TEST_CASE("memory utils graph arena serves each thread from its own cache", "[memory utils]") {
+    hgraph::GraphArena arena{4096};
+    const MemoryUtils::StorageLayout small{.size = 24, .alignment = 8};
+
+    void *engine = arena.allocate(small);
+    void *worker = nullptr;
+    void *reused = nullptr;
+    std::thread{[&] {
+        worker = arena.allocate(small);
+        // Released here, so this thread's cache takes it back.
+        arena.deallocate(worker, small);
+        reused = arena.allocate(small);
+        arena.deallocate(reused, small);
+    }}.join();
+    REQUIRE(worker != engine);
+    REQUIRE(reused == worker);
+    REQUIRE(arena.stats().chunk_count == 2);
+    REQUIRE(arena.stats().allocation_count == 3);
+    REQUIRE(arena.stats().live_bytes == 32);
+    arena.deallocate(engine, small);
+    REQUIRE(arena.stats().live_bytes == 0);
+}
+
+TEST_CASE("memory utils graph arena storage does not propagate into copies", "[memory utils]") {
+    TrackedValue::reset();
+
+    const auto        &plan = MemoryUtils::plan_for<TrackedValue>();
+    hgraph::GraphArena arena;
+
+    MemoryUtils::ErasedOwner<> copied;
+    {
+        MemoryUtils::ErasedOwner<> owned(plan, arena.ops());
+        REQUIRE(owned.allocator() == &arena.ops());
+        owned.as<TrackedValue>()->value = 5;
+        REQUIRE(arena.stats().allocation_count == 1);
+
+        copied = owned;
+        REQUIRE(copied.allocator() == &MemoryUtils::default_allocator());
+        REQUIRE(copied.as<TrackedValue>()->value == 5);
+        REQUIRE(arena.stats().allocation_count == 1);
+    }
+    REQUIRE(arena.stats().live_bytes == 0);
+    REQUIRE(copied.as<TrackedValue>()->value == 5);
+}
+
 TEST_CASE("memory utils heap-backed owners deep-copy on copy and transfer on move", "[memory utils]") {
     TrackedValue::reset();
 
@@ -830,6 +830,26 @@ TEST_CASE("mesh_: a removed key re-added later gets a fresh child instance") {
                              dict_delta<Str, TS<Int>>({{"a"s, 1}})));
 }
 
+TEST_CASE("mesh_: __recycle__ instances start each new key from fresh state") {
+  using namespace hgraph;
+  stdlib::register_standard_operators();
+
+  // b reuses a's erased slot and its recycled instance graph.
+  CHECK_OUTPUT((eval_node<stdlib::mesh_, TSD<Str, TS<Int>>>(
+                   fn<CounterNode>(),
+                   values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 1}}),
+                                 dict_delta<Str, TS<Int>>({{"a"s, 2}}),
+                                 dict_delta<Str, TS<Int>>({}, {"a"s}),
+                                 dict_delta<Str, TS<Int>>({{"b"s, 3}}),
+                                 dict_delta<Str, TS<Int>>({{"b"s, 4}})),
+                   arg<"__recycle__">(Int{8}))),
+               values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 1}}),
+                             dict_delta<Str, TS<Int>>({{"a"s, 2}}),
+                             dict_delta<Str, TS<Int>>({}, {"a"s}),
+                             dict_delta<Str, TS<Int>>({{"b"s, 1}}),
+                             dict_delta<Str, TS<Int>>({{"b"s, 2}})));
+}
+
 TEST_CASE("mesh_: removed instances stop for one cycle before slot erase") {
   using namespace hgraph;
   stdlib::register_standard_operators();
@@ -235,3 +235,127 @@ TEST_CASE("node scheduler: wall-clock alarms require realtime support")
     realtime.schedule(one * 2, "wc", /*on_wall_clock=*/true);
     CHECK(realtime.tag_time("wc") == base + one * 2);
 }
+
+TEST_CASE("node scheduler: the event heap spills past its inline capacity and copies intact")
+{
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+
+    for (int offset = 9; offset >= 1; --offset) { sched.schedule(base + TimeDelta{offset}); }
+    sched.schedule(base + TimeDelta{4});  // an identical untagged event is not added twice
+    sched.schedule(base + TimeDelta{7}, "seven");
+    CHECK(state.events.size() == 10);
+
+    NodeSchedulerState copy = state;
+    state.events.clear();
+    CHECK_FALSE(sched.is_scheduled());
+
+    NodeScheduler copied{copy, nullptr, 0, base};
+    CHECK(copied.next_scheduled_time() == base + one);
+    CHECK(copied.tag_time("seven") == base + TimeDelta{7});
+    for (int offset = 1; offset <= 9; ++offset)
+    {
+        NodeScheduler at{copy, nullptr, 0, base + TimeDelta{offset}};
+        CHECK(at.is_scheduled_now());
+        at.advance();
+    }
+    CHECK(copy.events.empty());
+}
+
+TEST_CASE("node scheduler: interned tags and their names address the same event")
+{
+    const SchedulerTag tag{"interned"};
+    CHECK(tag.tagged());
+    CHECK(tag.name() == "interned");
+    CHECK(SchedulerTag::find("interned") == tag);
+    CHECK_FALSE(SchedulerTag::find("never-interned-tag").tagged());
+    CHECK_FALSE(SchedulerTag{""}.tagged());
+
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+    sched.schedule(base + TimeDelta{3}, tag);
+    CHECK(sched.has_tag("interned"));
+    sched.schedule(base + TimeDelta{5}, "interned");  // replaces the interned-id event
+    CHECK(state.events.size() == 1);
+    CHECK(sched.tag_time(tag) == base + TimeDelta{5});
+    sched.un_schedule("interned");
+    CHECK_FALSE(sched.is_scheduled());
+}
+
+TEST_CASE("node scheduler: runtime tag names stay node-local and reuse free slots")
+{
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+    sched.schedule(base + TimeDelta{3}, "runtime-only-a");
+    sched.schedule(base + TimeDelta{4}, "runtime-only-b");
+    CHECK_FALSE(SchedulerTag::find("runtime-only-a").tagged());
+    CHECK(state.runtime_tags.size() == 2);
+    CHECK(sched.has_tag("runtime-only-a"));
+    CHECK(sched.tag_time("runtime-only-b") == base + TimeDelta{4});
+    CHECK(state.tag_name(state.events.top().tag) == "runtime-only-a");
+
+    // A cancelled name frees its slot for the next unseen one.
+    sched.un_schedule("runtime-only-a");
+    sched.schedule(base + TimeDelta{5}, "runtime-only-c");
+    CHECK(state.runtime_tags.size() == 2);
+    CHECK_FALSE(sched.has_tag("runtime-only-a"));
+    CHECK(sched.tag_time("runtime-only-c") == base + TimeDelta{5});
+
+    // Interned names resolve to the shared id through the same table.
+    const SchedulerTag interned{"interned"};
+    sched.schedule(base + TimeDelta{6}, "interned");
+    CHECK(sched.tag_time(interned) == base + TimeDelta{6});
+    CHECK(state.runtime_tags.size() == 3);
+    CHECK(state.runtime_tags.back().tag == interned);
+}
+
+TEST_CASE("node scheduler: a runtime name interned later keeps one id per node")
+{
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+    sched.schedule(base + TimeDelta{3}, "interned-after-use");
+    const SchedulerTag local = state.find_tag("interned-after-use");
+    REQUIRE(local.local());
+
+    // While its event is pending the name stays on the local id.
+    const SchedulerTag interned{"interned-after-use"};
+    CHECK(state.find_tag("interned-after-use") == local);
+    sched.schedule(base + TimeDelta{4}, "interned-after-use");
+    CHECK(state.events.size() == 1);
+    CHECK(sched.tag_time(local) == base + TimeDelta{4});
+
+    // Once it fires, the same table entry moves to the interned id.
+    sched.un_schedule("interned-after-use");
+    CHECK(state.find_tag("interned-after-use") == interned);
+    sched.schedule(base + TimeDelta{5}, "interned-after-use");
+    CHECK(sched.tag_time(interned) == base + TimeDelta{5});
+    CHECK_FALSE(sched.has_tag(local));
+    CHECK(state.runtime_tags.size() == 1);
+}
+
+TEST_CASE("node scheduler: un_schedule breaks time ties by tag id, untagged first")
+{
+    const SchedulerTag first{"tie-order-zulu"};
+    const SchedulerTag second{"tie-order-alpha"};
+    REQUIRE(first < second);
+
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+    sched.schedule(base + TimeDelta{2}, "tie-order-runtime");
+    sched.schedule(base + TimeDelta{2}, second);
+    sched.schedule(base + TimeDelta{2}, first);
+    sched.schedule(base + TimeDelta{2});
+    sched.schedule(base + TimeDelta{3});
+
+    // Time still comes first; "zulu" was interned first, so it precedes
+    // "alpha" whatever the spelling, and the node-local tag goes last.
+    CHECK(state.events.top().tag == SchedulerTag{});
+    sched.un_schedule();
+    CHECK(state.events.top().tag == first);
+    sched.un_schedule();
+    CHECK(state.events.top().tag == second);
+    sched.un_schedule();
+    CHECK(state.events.top().tag.local());
+    sched.un_schedule();
+    CHECK(sched.next_scheduled_time() == base + TimeDelta{3});
+}
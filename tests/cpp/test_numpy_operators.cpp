@@ -224,6 +224,22 @@ namespace
         }
     };
 
+    template <fixed_string Method, auto Q>
+    struct WindowQuantileGraph
+    {
+        static constexpr auto name = "window_quantile_graph";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Int>> input)
+        {
+            auto window = wire<stdlib::to_window>(w, input, Int{5}, Int{1})
+                              .as<TSW<Int, 5, 1>>();
+            auto q = wire<stdlib::const_, TS<Float>>(w, Float{Q});
+            return wire<stdlib::numpy::quantile>(
+                       w, window, q, Str{Method.sv()}, Bool{false})
+                .template as<TS<Float>>();
+        }
+    };
+
     using RollingInt3 = TSB<"NpRollingWindowResult[int,3]",
                             Field<"buffer", TS<ArrayOf<Int, 3>>>,
                             Field<"index", TS<ArrayOf<DateTime, 3>>>>;
@@ -410,6 +426,18 @@ TEST_CASE("numpy operators: quantile delegates interpolation to Arrow Compute")
           Catch::Approx(3.0));
 }
 
+TEST_CASE("numpy operators: window quantile follows the slide, including duplicate evictions")
+{
+    stdlib::register_standard_operators();
+    const auto input = values<Int>(4, 1, 3, 1, 5, 9, 2, 6);
+    CHECK_OUTPUT(eval_node<WindowQuantileGraph<"linear", 0.5>>(input),
+                 values<Float>(4.0, 2.5, 3.0, 2.0, 3.0, 3.0, 3.0, 5.0));
+    CHECK_OUTPUT(eval_node<WindowQuantileGraph<"nearest", 0.25>>(input),
+                 values<Float>(4.0, 1.0, 1.0, 1.0, 1.0, 1.0, 2.0, 2.0));
+    CHECK_OUTPUT(eval_node<WindowQuantileGraph<"midpoint", 0.6>>(input),
+                 values<Float>(4.0, 2.5, 3.5, 2.0, 3.5, 4.0, 4.0, 5.5));
+}
+
 TEST_CASE("numpy operators: rolling windows expose native value and timestamp arrays")
 {
     stdlib::register_standard_operators();
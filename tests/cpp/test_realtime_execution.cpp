@@ -678,6 +678,76 @@ TEST_CASE("real-time executor evaluates root push queues after pending update si
     CHECK(observed_value == Int{42});
 }
 
+TEST_CASE("real-time executor with a spin budget still meets scheduled times and push wake-ups")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *int_meta = registry.register_scalar<Int>("int");
+    const auto *ts_int   = registry.ts(int_meta);
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_int);
+
+    // The spin budget is shorter than the scheduled delay, so the run parks,
+    // wakes early and spins out the last 5ms before the alarm; the push then
+    // arrives well after the post-cycle spin has given way to a park.
+    constexpr TimeDelta delay{40'000};
+    const RealTimeWaitOptions wait_options{.spin_budget = TimeDelta{5'000}};
+
+    std::atomic_int  eval_count{0};
+    DateTime         observed_evaluation_time{MIN_DT};
+    DateTime         observed_clock_evaluation_time{MIN_DT};
+    DateTime         observed_clock_now{MIN_DT};
+    Int              observed_value{0};
+    std::int32_t     sink_eval_count{0};
+    PushSourceSender sender;
+
+    GraphBuilder graph_builder;
+    graph_builder.add_node(hgraph::testing::capturing_push_source(*ts_int, sender));
+    graph_builder.add_node(hgraph::testing::recording_scalar_sink<Int>(
+        *input_schema,
+        *ts_int,
+        observed_value,
+        sink_eval_count));
+    graph_builder.add_node(delayed_source(delay,
+                                          &eval_count,
+                                          &observed_evaluation_time,
+                                          &observed_clock_evaluation_time,
+                                          &observed_clock_now));
+    graph_builder.add_edge(GraphEdge{
+        .source_node = make_graph_edge_source(0),
+        .source_path = {},
+        .target_node = 1,
+        .target_path = {0},
+    });
+
+    const DateTime start_time  = hgraph::testing::wall_now();
+    const DateTime target_time = start_time + delay;
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(graph_builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{300'000})
+        .realtime_wait_options(wait_options);
+    CHECK(executor_builder.realtime_wait_options() == wait_options);
+
+    GraphExecutorValue executor = executor_builder.make_executor();
+    auto               view     = executor.view();
+
+    hgraph::testing::AsyncGraphExecutorRun runner{view};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{80});
+    REQUIRE(sender.valid());
+    sender.send(Int{7});
+    runner.join();
+
+    CHECK(eval_count.load() == 1);
+    CHECK(observed_evaluation_time == target_time);
+    CHECK(observed_clock_now >= target_time);
+    CHECK(sink_eval_count == 1);
+    CHECK(observed_value == Int{7});
+}
+
 TEST_CASE("push source exposes pending work through the data-only inspection contract")
 {
     using namespace hgraph;
@@ -805,6 +875,142 @@ TEST_CASE("real-time push source drains multiple queued values across cycles")
     CHECK(observed_values[1] == Int{2});
 }
 
+TEST_CASE("real-time bounded push source delivers every value from concurrent senders in order")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *int_meta = registry.register_scalar<Int>("int");
+    const auto *ts_int   = registry.ts(int_meta);
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_int);
+
+    constexpr Int         producer_count = 4;
+    constexpr Int         values_per_producer = 64;
+    constexpr std::size_t total_values = static_cast<std::size_t>(producer_count * values_per_producer);
+
+    std::vector<Int> observed_values;
+    PushSourceSender sender;
+
+    GraphBuilder graph_builder;
+    // Capacity well below the burst size so senders exercise back-pressure.
+    graph_builder.add_node(make_push_source_node(
+        *ts_int,
+        make_push_source_bounded_queue_policy(*ts_int->value_schema, 8),
+        [&sender](PushSourceSender started_sender) { sender = std::move(started_sender); }));
+    graph_builder.add_node(hgraph::testing::collecting_scalar_sink<Int>(
+        *input_schema,
+        *ts_int,
+        observed_values,
+        total_values));
+    graph_builder.add_edge(GraphEdge{
+        .source_node = make_graph_edge_source(0),
+        .source_path = {},
+        .target_node = 1,
+        .target_path = {0},
+    });
+
+    const DateTime start_time = hgraph::testing::wall_now();
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(graph_builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{5'000'000});
+
+    GraphExecutorValue executor = executor_builder.make_executor();
+    auto               view     = executor.view();
+
+    hgraph::testing::AsyncGraphExecutorRun runner{view};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    REQUIRE(sender.valid());
+    {
+        std::vector<std::jthread> producers;
+        for (Int producer = 0; producer < producer_count; ++producer)
+        {
+            producers.emplace_back([&sender, producer] {
+                for (Int index = 0; index < values_per_producer; ++index)
+                {
+                    sender.send(Int{producer * 1000 + index});
+                }
+            });
+        }
+    }
+    runner.join();
+
+    REQUIRE(observed_values.size() == total_values);
+    std::array<Int, producer_count> next_index{};
+    for (const Int value : observed_values)
+    {
+        const auto producer = static_cast<std::size_t>(value / 1000);
+        REQUIRE(producer < next_index.size());
+        CHECK(value % 1000 == next_index[producer]);
+        ++next_index[producer];
+    }
+}
+
+TEST_CASE("real-time bounded push source rejects a full-ring send from the evaluation thread")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *int_meta = registry.register_scalar<Int>("int");
+    const auto *ts_int   = registry.ts(int_meta);
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_int);
+
+    std::vector<Int> observed_values;
+    bool             overflow_threw = false;
+
+    GraphBuilder graph_builder;
+    // on_start runs on the evaluation thread: waiting there for a free slot
+    // would never end, so the third send must fail instead.
+    graph_builder.add_node(make_push_source_node(
+        *ts_int,
+        make_push_source_bounded_queue_policy(*ts_int->value_schema, 2),
+        [&overflow_threw](PushSourceSender sender) {
+            sender.send(Int{1});
+            sender.send(Int{2});
+            try
+            {
+                sender.send(Int{3});
+            }
+            catch (const std::logic_error &)
+            {
+                overflow_threw = true;
+            }
+        }));
+    graph_builder.add_node(hgraph::testing::collecting_scalar_sink<Int>(
+        *input_schema,
+        *ts_int,
+        observed_values,
+        2));
+    graph_builder.add_edge(GraphEdge{
+        .source_node = make_graph_edge_source(0),
+        .source_path = {},
+        .target_node = 1,
+        .target_path = {0},
+    });
+
+    const DateTime start_time = hgraph::testing::wall_now();
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(graph_builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{5'000'000});
+
+    GraphExecutorValue executor = executor_builder.make_executor();
+    auto               view     = executor.view();
+
+    hgraph::testing::AsyncGraphExecutorRun runner{view};
+    runner.join();
+
+    CHECK(overflow_threw);
+    REQUIRE(observed_values.size() == 2);
+    CHECK(observed_values[0] == Int{1});
+    CHECK(observed_values[1] == Int{2});
+}
+
 TEST_CASE("real-time push source applies queued collection deltas in order")
 {
     using namespace hgraph;
@@ -56,6 +56,7 @@ TEST_CASE("record/replay config: configuration belongs to the seeded GlobalState
     CHECK(config(state).as_of == MIN_ST);
 
     CHECK_THROWS_AS(set_config(state, Config{.model = ""}), std::invalid_argument);
+    CHECK_THROWS_AS(set_config(state, Config{.model = std::string{MEMORY_MAPPED}}), std::invalid_argument);
 
     hgraph::GlobalState other;
     CHECK(config(other.view()).model == std::string{IN_MEMORY});
@@ -1,3 +1,4 @@
+#include <hgraph/lib/std/operators/impl/record_replay_mmap_impl.h>
 #include <hgraph/lib/std/std_operators.h>
 #include <hgraph/lib/testing/check_output.h>
 #include <hgraph/lib/testing/eval_node.h>
@@ -10,6 +11,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
 #include <optional>
 #include <string>
 #include <vector>
@@ -145,6 +147,20 @@ namespace
         }
     };
 
+    /** A scratch directory for the memory-mapped backend, removed on scope exit. */
+    struct ScratchDirectory
+    {
+        std::filesystem::path path;
+
+        explicit ScratchDirectory(std::string_view name)
+            : path(std::filesystem::temp_directory_path() / name)
+        {
+            std::filesystem::remove_all(path);
+        }
+
+        ~ScratchDirectory() { std::filesystem::remove_all(path); }
+    };
+
     struct TraitRecordGraph
     {
         [[maybe_unused]] static constexpr auto name = "trait_record_frame_graph";
@@ -265,6 +281,58 @@ TEST_CASE("raw frame replay accepts an empty canonical frame")
     CHECK(eval_node<stdlib::replay_data_frame, TS<Int>>(frame, MAX_DT).empty());
 }
 
+TEST_CASE("memory-mapped backend: record streams to a per-key file; replay maps it back")
+{
+    stdlib::register_standard_operators();
+    const ScratchDirectory directory{"hgraph_mmap_record_replay"};
+    GlobalContext context;
+    record_replay::set_config(context.state().view(),
+                              record_replay::Config{.model     = std::string{record_replay::MEMORY_MAPPED},
+                                                    .directory = directory.path.string()});
+
+    (void)eval_node<RecordGraph>(values<Int>(10, none, 30, 40));
+
+    // The recording bypasses the frame store entirely.
+    CHECK_FALSE(record_replay::store_contains("book.prices"));
+    CHECK(std::filesystem::exists(directory.path / "book.prices.arrows"));
+
+    CHECK_OUTPUT(eval_node<ReplayGraph>(), values<Int>(10, none, 30, 40));
+}
+
+TEST_CASE("memory-mapped backend: the reader walks rows across flushed batches")
+{
+    using namespace stdlib::record_replay_mmap_detail;
+    const ScratchDirectory directory{"hgraph_mmap_batches"};
+    const auto &converter = table_converter(scalar_descriptor<Int>::value_meta(), "__date_time__", "__as_of__");
+    const auto  path      = recording_path(directory.path.string(), "desk/fx.prices");
+    CHECK(path.filename() == "desk_fx.prices.arrows");
+
+    {
+        FrameStreamWriter writer{converter, path.string(), /*batch_rows=*/2};
+        for (Int i = 0; i < 5; ++i)
+        {
+            writer.append(MIN_ST + TimeDelta{i}, MIN_ST + TimeDelta{i}, Value{Int{i * 10}}.view());
+        }
+        writer.close();
+    }
+
+    MappedFrameReader reader{converter, path};
+    for (Int i = 0; i < 5; ++i)
+    {
+        REQUIRE_FALSE(reader.exhausted());
+        CHECK(reader.next_time() == MIN_ST + TimeDelta{i});
+        CHECK(reader.read_next().view().checked_as<Int>() == i * 10);
+    }
+    CHECK(reader.exhausted());
+
+    // An empty recording is a valid stream with no batches.
+    {
+        FrameStreamWriter writer{converter, path.string(), default_batch_rows};
+        writer.close();
+    }
+    CHECK(MappedFrameReader{converter, path}.exhausted());
+}
+
 TEST_CASE("frame backend: the in-memory model still resolves record/replay by default")
 {
     stdlib::register_standard_operators();
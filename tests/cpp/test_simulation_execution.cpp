@@ -485,6 +485,207 @@ TEST_CASE("simulation: re-ticking a source reschedules its downstream via notifi
     view.stop();
 }
 
+TEST_CASE("simulation: active-set scheduling visits only scheduled nodes in rank order")
+{
+    using namespace hgraph;
+
+    auto       &registry     = TypeRegistry::instance();
+    const auto *int_meta     = registry.register_scalar<std::int32_t>("int32");
+    const auto *ts_int       = registry.ts(int_meta);
+    const auto *input_schema = registry.tsb("NotifyInput", {{"value", ts_int}});
+
+    // Pad the graph past one bitmap word so the summary level is exercised:
+    // the source sits at index 0 and its consumer at the far end.
+    constexpr std::size_t padding = 150;
+    std::int32_t source_evals  = 0;
+    std::int32_t add_one_evals = 0;
+    std::vector<std::int32_t> padding_evals(padding, 0);
+
+    GraphBuilder builder;
+    builder.add_node(counting_source(ts_int, 5, &source_evals));
+    for (std::size_t index = 0; index < padding; ++index)
+    {
+        builder.add_node(counting_source(ts_int, 0, &padding_evals[index]));
+    }
+    builder.add_node(counting_add_one(input_schema, ts_int, &add_one_evals))
+        .add_edge(GraphEdge{.source_node = 0, .source_path = {}, .target_node = padding + 1, .target_path = {0}})
+        .scheduling_mode(GraphSchedulingMode::ActiveSet);
+
+    testing::MockRootGraph graph{builder};
+    auto       view = graph.graph();
+    CHECK(view.scheduling_mode() == GraphSchedulingMode::ActiveSet);
+
+    const auto t1 = MIN_ST;
+    const auto t2 = t1 + TimeDelta{1};
+    const auto t3 = t2 + TimeDelta{1};
+
+    view.start(t1);
+    view.evaluate(t1);
+    CHECK(source_evals == 1);
+    CHECK(add_one_evals == 1);
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    // A future schedule is retained across a cycle that does not reach it.
+    view.schedule_node(100, t3);
+    view.schedule_node(0, t2);
+    view.evaluate(t2);
+    CHECK(source_evals == 2);
+    CHECK(add_one_evals == 2);
+    CHECK(padding_evals[99] == 1);
+    CHECK(view.next_scheduled_time() == t3);
+
+    view.evaluate(t3);
+    CHECK(source_evals == 2);
+    CHECK(add_one_evals == 2);
+    CHECK(padding_evals[99] == 2);
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    view.stop();
+}
+
+TEST_CASE("simulation: active-set scheduling drives the same multi-cycle run as the scan")
+{
+    using namespace hgraph;
+
+    auto &registry = TypeRegistry::instance();
+    (void)registry.register_scalar<std::int32_t>("int32");
+
+    GraphBuilder graph_builder = build_graph<TickGraph>();
+    graph_builder.scheduling_mode(GraphSchedulingMode::ActiveSet);
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(graph_builder))
+        .start_time(MIN_ST)
+        .end_time(MIN_ST + TimeDelta{10});
+
+    GraphExecutorValue executor      = executor_builder.make_executor();
+    auto               executor_view = executor.view();
+    executor_view.run();
+
+    auto graph = executor_view.graph();
+    CHECK(graph.global_state().get_as<std::int32_t>("ticks") == 3);
+    CHECK(graph.node_at(0).output(MIN_ST).value().checked_as<std::int32_t>() == 2);
+    CHECK(graph.node_at(1).output(MIN_ST).value().checked_as<std::int32_t>() == 3);
+}
+
+TEST_CASE("simulation: timing-wheel scheduling finds due nodes and the next time from the wheel")
+{
+    using namespace hgraph;
+
+    auto       &registry     = TypeRegistry::instance();
+    const auto *int_meta     = registry.register_scalar<std::int32_t>("int32");
+    const auto *ts_int       = registry.ts(int_meta);
+    const auto *input_schema = registry.tsb("NotifyInput", {{"value", ts_int}});
+
+    constexpr std::size_t padding = 150;
+    std::int32_t source_evals  = 0;
+    std::int32_t add_one_evals = 0;
+    std::vector<std::int32_t> padding_evals(padding, 0);
+
+    GraphBuilder builder;
+    builder.add_node(counting_source(ts_int, 5, &source_evals));
+    for (std::size_t index = 0; index < padding; ++index)
+    {
+        builder.add_node(counting_source(ts_int, 0, &padding_evals[index]));
+    }
+    builder.add_node(counting_add_one(input_schema, ts_int, &add_one_evals))
+        .add_edge(GraphEdge{.source_node = 0, .source_path = {}, .target_node = padding + 1, .target_path = {0}})
+        .scheduling_mode(GraphSchedulingMode::TimingWheel);
+
+    testing::MockRootGraph graph{builder};
+    auto       view = graph.graph();
+    CHECK(view.scheduling_mode() == GraphSchedulingMode::TimingWheel);
+
+    const auto t1    = MIN_ST;
+    const auto t2    = t1 + TimeDelta{1};
+    const auto later = t1 + std::chrono::days{40};
+    const auto far   = t1 + std::chrono::days{90};
+
+    view.start(t1);
+    view.evaluate(t1);
+    CHECK(source_evals == 1);
+    CHECK(add_one_evals == 1);
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    // Alarms months out sit on coarse levels; moving one earlier leaves a
+    // stale entry behind that must never surface as a scheduled time.
+    view.schedule_node(100, far);
+    view.schedule_node(50, far);
+    view.schedule_node(50, later);
+    view.schedule_node(0, t2);
+    view.evaluate(t2);
+    CHECK(source_evals == 2);
+    CHECK(add_one_evals == 2);
+    CHECK(view.next_scheduled_time() == later);
+
+    view.evaluate(later);
+    CHECK(padding_evals[49] == 2);
+    CHECK(padding_evals[99] == 1);
+    CHECK(view.next_scheduled_time() == far);
+
+    view.evaluate(far);
+    CHECK(padding_evals[49] == 2);
+    CHECK(padding_evals[99] == 2);
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    view.stop();
+}
+
+TEST_CASE("simulation: level-parallel scheduling evaluates a wide fan-out level by level")
+{
+    using namespace hgraph;
+
+    auto       &registry     = TypeRegistry::instance();
+    const auto *int_meta     = registry.register_scalar<std::int32_t>("int32");
+    const auto *ts_int       = registry.ts(int_meta);
+    const auto *input_schema = registry.tsb("NotifyInput", {{"value", ts_int}});
+
+    // source -> width independent add_one nodes (level 1) -> one add_one per
+    // branch (level 2): each level-2 node must observe its level-1 input.
+    constexpr std::size_t width = 64;
+    std::int32_t source_evals = 0;
+    std::vector<std::int32_t> first_evals(width, 0);
+    std::vector<std::int32_t> second_evals(width, 0);
+
+    GraphBuilder builder;
+    builder.add_node(counting_source(ts_int, 5, &source_evals));
+    for (std::size_t index = 0; index < width; ++index)
+    {
+        builder.add_node(counting_add_one(input_schema, ts_int, &first_evals[index]))
+            .add_edge(GraphEdge{.source_node = 0, .source_path = {}, .target_node = 1 + index, .target_path = {0}});
+    }
+    for (std::size_t index = 0; index < width; ++index)
+    {
+        builder.add_node(counting_add_one(input_schema, ts_int, &second_evals[index]))
+            .add_edge(GraphEdge{
+                .source_node = 1 + index, .source_path = {}, .target_node = 1 + width + index, .target_path = {0}});
+    }
+    builder.scheduling_mode(GraphSchedulingMode::LevelParallel);
+
+    testing::MockRootGraph graph{builder};
+    auto       view = graph.graph();
+    CHECK(view.scheduling_mode() == GraphSchedulingMode::LevelParallel);
+
+    const auto t1 = MIN_ST;
+    const auto t2 = t1 + TimeDelta{1};
+
+    view.start(t1);
+    view.evaluate(t1);
+    view.schedule_node(0, t2);
+    view.evaluate(t2);
+
+    CHECK(source_evals == 2);
+    for (std::size_t index = 0; index < width; ++index)
+    {
+        CHECK(first_evals[index] == 2);
+        CHECK(second_evals[index] == 2);
+        CHECK(view.node_at(1 + width + index).output(t2).value().checked_as<std::int32_t>() == 7);
+    }
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    view.stop();
+}
+
 // MILESTONE: data-driven, multi-cycle evaluation over simulated time. A source
 // that reschedules itself (via the NodeScheduler injectable) drives the graph for
 // as many cycles as it ticks, and its downstream is re-evaluated each cycle. The
@@ -519,6 +720,67 @@ TEST_CASE("simulation: a self-rescheduling source drives multiple cycles over ti
     CHECK(graph.node_at(1).output(MIN_ST).value().checked_as<std::int32_t>() == 3);
 }
 
+TEST_CASE("simulation: the hot/cold node layout evaluates like the interleaved one", "[milestone]")
+{
+    using namespace hgraph;
+
+    auto &registry = TypeRegistry::instance();
+    (void)registry.register_scalar<std::int32_t>("int32");
+
+    GraphBuilder interleaved = build_graph<TickGraph>();
+    GraphBuilder hot_cold    = build_graph<TickGraph>();
+    hot_cold.node_layout(GraphNodeLayout::HotCold);
+    CHECK(hot_cold.node_layout() == GraphNodeLayout::HotCold);
+    CHECK(hot_cold.root_type() != interleaved.root_type());
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(hot_cold)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+
+    GraphExecutorValue executor      = executor_builder.make_executor();
+    auto               executor_view = executor.view();
+    executor_view.run();
+
+    auto graph = executor_view.graph();
+    CHECK(graph.global_state().get_as<std::int32_t>("ticks") == 3);
+    CHECK(graph.node_at(0).output(MIN_ST).value().checked_as<std::int32_t>() == 2);
+    CHECK(graph.node_at(1).output(MIN_ST).value().checked_as<std::int32_t>() == 3);
+    CHECK(graph.node_at(1).node_index() == 1);
+}
+
+TEST_CASE("simulation: an arena allocator policy backs the run's storage", "[milestone]")
+{
+    using namespace hgraph;
+
+    auto &registry = TypeRegistry::instance();
+    (void)registry.register_scalar<std::int32_t>("int32");
+
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(build_graph<TickGraph>())
+        .start_time(MIN_ST)
+        .end_time(MIN_ST + TimeDelta{10})
+        .allocator_policy(GraphAllocatorPolicy::Arena, 4096);
+
+    GraphExecutorValue executor      = executor_builder.make_executor();
+    auto               executor_view = executor.view();
+    const GraphArena  *arena         = executor_view.arena();
+    REQUIRE(arena != nullptr);
+    CHECK(&executor_view.graph().allocator() == &arena->ops());
+    // The root graph is built in the arena's static phase, at exact sizes.
+    CHECK(arena->stats().static_bytes > 0);
+
+    executor_view.run();
+
+    auto graph = executor_view.graph();
+    CHECK(graph.global_state().get_as<std::int32_t>("ticks") == 3);
+    CHECK(graph.node_at(1).output(MIN_ST).value().checked_as<std::int32_t>() == 3);
+
+    GraphExecutorBuilder heap_builder;
+    heap_builder.graph_builder(build_graph<TickGraph>()).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+    GraphExecutorValue heap_executor = heap_builder.make_executor();
+    CHECK(heap_executor.view().arena() == nullptr);
+    CHECK(&heap_executor.view().graph().allocator() == &MemoryUtils::default_allocator());
+}
+
 namespace
 {
     using namespace hgraph;
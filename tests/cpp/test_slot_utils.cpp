@@ -97,13 +97,13 @@ namespace
         }
     };
 
-    void *tracked_allocate(MemoryUtils::StorageLayout layout) {
+    void *tracked_allocate(void *, MemoryUtils::StorageLayout layout) {
         ++AllocationProbe::allocations;
         AllocationProbe::allocated_layouts.push_back(layout);
         return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
     }
 
-    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept {
+    void tracked_deallocate(void *, void *memory, MemoryUtils::StorageLayout layout) noexcept {
         ++AllocationProbe::deallocations;
         AllocationProbe::deallocated_layouts.push_back(layout);
         ::operator delete(memory, std::align_val_t{layout.alignment});
@@ -16,6 +16,7 @@
 #include <hgraph/lib/std/std_operators.h>
 #include <hgraph/lib/std/operators/impl/arithmetic_impl.h>
 #include <hgraph/lib/std/operators/impl/collection_impl.h>
+#include <hgraph/lib/std/operators/impl/stream_impl.h>
 #include <hgraph/lib/std/operators/impl/string_impl.h>
 #include <hgraph/lib/std/standard_types.h>
 #include <hgraph/lib/std/value_util.h>
@@ -35,6 +36,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cmath>
@@ -332,6 +334,123 @@ namespace
         }
     };
 
+    enum class WindowStat
+    {
+        Sum,
+        Mean,
+        Std,
+        Min,
+        Max,
+    };
+
+    /** Full-window rescan of an Int window: the reference the incremental
+        window kernels are checked against. */
+    template <WindowStat Stat>
+    struct WindowScanReference
+    {
+        static constexpr auto name = "window_scan_reference";
+
+        static void eval(In<"window", TsVar<"W">, InputValidity::Unchecked> input,
+                         Out<TS<Float>> out)
+        {
+            if (!input.valid()) { return; }
+            auto window = input.base().as_window();
+            if (!stdlib::stream_impl_detail::tsw_ready(window.data_view())) { return; }
+            std::vector<Float> values;
+            for (const ValueView value : window.values())
+            {
+                values.push_back(static_cast<Float>(value.checked_as<Int>()));
+            }
+            Float total = 0.0;
+            for (const Float value : values) { total += value; }
+            const Float size = static_cast<Float>(values.size());
+            if constexpr (Stat == WindowStat::Sum) { out.set(total); }
+            else if constexpr (Stat == WindowStat::Mean) { out.set(total / size); }
+            else if constexpr (Stat == WindowStat::Min) { out.set(*std::ranges::min_element(values)); }
+            else if constexpr (Stat == WindowStat::Max) { out.set(*std::ranges::max_element(values)); }
+            else
+            {
+                Float squares = 0.0;
+                for (const Float value : values) { squares += (value - total / size) * (value - total / size); }
+                out.set(std::sqrt(squares / size));
+            }
+        }
+    };
+
+    template <bool Duration>
+    [[nodiscard]] Port<void> sliding_window(Wiring &w, Port<TS<Int>> ts, Port<SIGNAL> reset)
+    {
+        if constexpr (Duration) { return wire<stdlib::to_window>(w, ts, MIN_TD * 5, MIN_TD, reset); }
+        else { return wire<stdlib::to_window>(w, ts, Int{6}, Int{1}, reset); }
+    }
+
+    template <typename Operator, typename TOut, bool Duration>
+    struct SlidingWindowAggregateGraph
+    {
+        static constexpr auto name = "sliding_window_aggregate_graph";
+
+        static Port<TS<TOut>> compose(Wiring &w, Port<TS<Int>> ts, Port<SIGNAL> reset)
+        {
+            return wire<Operator>(w, sliding_window<Duration>(w, ts, reset)).template as<TS<TOut>>();
+        }
+    };
+
+    template <WindowStat Stat, bool Duration>
+    struct SlidingWindowReferenceGraph
+    {
+        static constexpr auto name = "sliding_window_reference_graph";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Int>> ts, Port<SIGNAL> reset)
+        {
+            return wire<WindowScanReference<Stat>, TS<Float>>(w, sliding_window<Duration>(w, ts, reset))
+                .template as<TS<Float>>();
+        }
+    };
+
+    template <typename Operator>
+    struct FloatWindowAggregateGraph
+    {
+        static constexpr auto name = "float_window_aggregate_graph";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Float>> ts)
+        {
+            return wire<Operator>(w, wire<stdlib::to_window>(w, ts, Int{3}, Int{1})).template as<TS<Float>>();
+        }
+    };
+
+    /** NaN-aware comparison of a float output series against the expected ticks. */
+    template <typename Output>
+    void check_float_ticks(const Output &actual, const std::vector<Float> &expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+        for (std::size_t index = 0; index < actual.size(); ++index)
+        {
+            INFO("cycle " << index);
+            REQUIRE(actual[index].has_value());
+            const Float value = static_cast<Float>(*actual[index]);
+            if (std::isnan(expected[index])) { CHECK(std::isnan(value)); }
+            else if (std::isinf(expected[index])) { CHECK(value == expected[index]); }
+            else { CHECK(std::abs(value - expected[index]) <= 1e-12); }
+        }
+    }
+
+    template <typename Operator, typename TOut, WindowStat Stat, bool Duration>
+    void check_window_kernel(const std::vector<std::optional<Int>>  &ts,
+                             const std::vector<std::optional<Bool>> &reset)
+    {
+        const auto actual   = eval_node<SlidingWindowAggregateGraph<Operator, TOut, Duration>>(ts, reset);
+        const auto expected = eval_node<SlidingWindowReferenceGraph<Stat, Duration>>(ts, reset);
+        REQUIRE(actual.size() == expected.size());
+        for (std::size_t index = 0; index < actual.size(); ++index)
+        {
+            INFO("cycle " << index);
+            REQUIRE(actual[index].has_value() == expected[index].has_value());
+            if (!actual[index].has_value()) { continue; }
+            const Float value = static_cast<Float>(*actual[index]);
+            CHECK(std::abs(value - *expected[index]) <= 1e-9 * std::max(1.0, std::abs(*expected[index])));
+        }
+    }
+
     // Scalar-container TS schemas are runtime metadata today. The wrapper graph
     // pins the output type expectation while eval_runtime_schema_graph supplies
     // the input schema at replay.
@@ -1959,6 +2078,11 @@ TEST_CASE("std operators: string operators support replace substr and container
                                             values<Str>(Str{"z"}, Str{"z"}),
                                             values<Str>(Str{"abcabcabc"}, Str{"abcabcabc"})),
                  values<Str>(Str{"zbczbczbc"}, Str{"zbcabcabc"}));
+    // the compiled pattern is kept while only the subject ticks; the reused buffer shrinks correctly
+    CHECK_OUTPUT(eval_node<stdlib::replace>(values<Str>(Str{"b+"}, none, none),
+                                            values<Str>(Str{"-"}, none, none),
+                                            values<Str>(Str{"abbbbbbc"}, Str{"abc"}, Str{"ac"})),
+                 values<Str>(Str{"a-c"}, Str{"a-c"}, Str{"ac"}));
     CHECK_OUTPUT(eval_node<stdlib::substr>(values<Str>(Str{"abcdef"}, Str{"abcdef"}, Str{"abcdef"}),
                                            values<Int>(0, 2, 1),
                                            values<Int>(3, 4, 5)),
@@ -2432,6 +2556,18 @@ TEST_CASE("std operators: stream operators cover sampling filtering slicing and
                                          values<Int>(1, 2, 3, none),
                                          Int{8}),
                  values<Int>(none, none, 1, 2, 3));
+    // Queued deltas live in a ring: the unbounded gate outgrows its initial
+    // capacity, and lag wraps its period-sized ring, keeping arrival order
+    // for non-trivial payloads.
+    CHECK_OUTPUT(eval_node<stdlib::gate>(
+                     values<Bool>(false, false, false, false, false, false, false, false, true),
+                     values<Str>(Str{"a"}, Str{"b"}, Str{"c"}, Str{"d"}, Str{"e"}, Str{"f"}, Str{"g"},
+                                 Str{"h"}, Str{"i"})),
+                 values<Str>(none, none, none, none, none, none, none, none, Str{"a"}, Str{"b"}, Str{"c"},
+                             Str{"d"}, Str{"e"}, Str{"f"}, Str{"g"}, Str{"h"}, Str{"i"}));
+    CHECK_OUTPUT(eval_node<stdlib::lag>(
+                     values<Str>(Str{"a"}, Str{"b"}, Str{"c"}, Str{"d"}, Str{"e"}, Str{"f"}), Int{3}),
+                 values<Str>(none, none, none, Str{"a"}, Str{"b"}, Str{"c"}));
     // hgraph semantics: a tick landing on the cycle the window releases
     // MERGES into that release (upstream throttle accumulates before the
     // scheduled drain), so t2 emits 3 (not the buffered 2) and t4 emits 5.
@@ -2519,6 +2655,51 @@ TEST_CASE("std operators: stream operators cover sampling filtering slicing and
                  values<Float>(1.0, 1.5, 2.25, 3.125));
 }
 
+TEST_CASE("std operators: window aggregates slide incrementally through gaps, resets and re-anchors")
+{
+    stdlib::register_standard_operators();
+    // Long enough for the running moments to re-anchor several times; the
+    // gaps make the duration window drop more than one element per cycle.
+    std::vector<std::optional<Int>>  ts;
+    std::vector<std::optional<Bool>> reset;
+    for (Int cycle = 0; cycle < 240; ++cycle)
+    {
+        const bool gap = cycle % 11 == 4 || cycle % 11 == 5 || cycle % 11 == 6;
+        ts.push_back(gap ? std::nullopt : std::optional<Int>{(cycle * 37) % 23 - 11});
+        reset.push_back(cycle == 90 || cycle == 171 ? std::optional<Bool>{true} : std::nullopt);
+    }
+
+    check_window_kernel<stdlib::sum_, Int, WindowStat::Sum, false>(ts, reset);
+    check_window_kernel<stdlib::mean, Float, WindowStat::Mean, false>(ts, reset);
+    check_window_kernel<stdlib::std_, Float, WindowStat::Std, false>(ts, reset);
+    check_window_kernel<stdlib::min_, Int, WindowStat::Min, false>(ts, reset);
+    check_window_kernel<stdlib::max_, Int, WindowStat::Max, false>(ts, reset);
+
+    check_window_kernel<stdlib::sum_, Int, WindowStat::Sum, true>(ts, reset);
+    check_window_kernel<stdlib::mean, Float, WindowStat::Mean, true>(ts, reset);
+    check_window_kernel<stdlib::std_, Float, WindowStat::Std, true>(ts, reset);
+    check_window_kernel<stdlib::min_, Int, WindowStat::Min, true>(ts, reset);
+    check_window_kernel<stdlib::max_, Int, WindowStat::Max, true>(ts, reset);
+}
+
+TEST_CASE("std operators: window aggregates recover once a NaN or infinity leaves the window")
+{
+    stdlib::register_standard_operators();
+    constexpr Float nan = std::numeric_limits<Float>::quiet_NaN();
+    constexpr Float inf = std::numeric_limits<Float>::infinity();
+    const auto      ticks = [] {
+        return values<Float>(1.0, 2.0, nan, 4.0, 5.0, 6.0, inf, 8.0, 9.0, 10.0, -inf, inf, 13.0, 14.0, 15.0);
+    };
+
+    check_float_ticks(eval_node<FloatWindowAggregateGraph<stdlib::sum_>>(ticks()),
+                      {1.0, 3.0, nan, nan, nan, 15.0, inf, inf, inf, 27.0, -inf, nan, nan, inf, 42.0});
+    check_float_ticks(eval_node<FloatWindowAggregateGraph<stdlib::mean>>(ticks()),
+                      {1.0, 1.5, nan, nan, nan, 5.0, inf, inf, inf, 9.0, -inf, nan, nan, inf, 14.0});
+    const Float spread = std::sqrt(2.0 / 3.0);
+    check_float_ticks(eval_node<FloatWindowAggregateGraph<stdlib::std_>>(ticks()),
+                      {0.0, 0.5, nan, nan, nan, spread, nan, nan, nan, spread, nan, nan, nan, nan, spread});
+}
+
 TEST_CASE("std operators: TSB proxy lag preserves sparse field deltas")
 {
     stdlib::register_standard_operators();
@@ -443,7 +443,8 @@ namespace
                                       const WiringPortRef &key,
                                       std::vector<std::size_t> &stored_counts,
                                       std::vector<std::uintptr_t> &active_addresses,
-                                      std::vector<NestedLifecycleSnapshot> *lifecycle = nullptr)
+                                      std::vector<NestedLifecycleSnapshot> *lifecycle = nullptr,
+                                      std::vector<SwitchBranchCacheMetrics> *cache_metrics = nullptr)
     {
         const auto *input_schema = TypeRegistry::instance().un_named_tsb(
             {{"switch", switch_output.schema}, {"key", key.schema}});
@@ -459,7 +460,8 @@ namespace
         meta.valid_inputs = std::vector<std::size_t>{};
 
         NodeCallbacks callbacks;
-        callbacks.evaluate = [&stored_counts, &active_addresses, lifecycle](const NodeView &view, DateTime) {
+        callbacks.evaluate = [&stored_counts, &active_addresses, lifecycle, cache_metrics](const NodeView &view,
+                                                                                            DateTime) {
             auto graph = view.graph();
             for (std::size_t i = 0; i < graph.node_count(); ++i)
             {
@@ -474,6 +476,7 @@ namespace
                     {
                         lifecycle->push_back(NestedLifecycleCounters::snapshot());
                     }
+                    if (cache_metrics != nullptr) { cache_metrics->push_back(switch_view.branch_cache_metrics()); }
                     return;
                 }
             }
@@ -844,6 +847,69 @@ TEST_CASE("switch_: reload_on_ticked rebuilds the branch on every key tick")
                  values<Int>(1, 1, 2));
 }
 
+TEST_CASE("switch_: a branch cache resets flapping keys in place of rebuilding them")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    std::vector<std::size_t>              stored_counts;
+    std::vector<std::uintptr_t>           active_addresses;
+    std::vector<SwitchBranchCacheMetrics> metrics;
+    Wiring                                w;
+    auto key = wire<stdlib::replay_impl, TS<Str>>(w, Str{"key"});
+    auto source = wire<stdlib::replay_impl, TS<Int>>(w, Str{"source"});
+    auto switched = wire<stdlib::switch_>(
+                        w, key,
+                        stdlib::switch_cases({{Value{Str{"a"}}, fn<NestedLifecycleNode>()},
+                                              {Value{Str{"b"}}, fn<NestedLifecycleNode>()},
+                                              {Value{Str{"c"}}, fn<NestedLifecycleNode>()}})
+                            .cache(1),
+                        source)
+                        .as<TS<Int>>();
+    wire_switch_storage_recorder(w, switched.erased(), key.erased(), stored_counts, active_addresses, nullptr,
+                                 &metrics);
+
+    GraphBuilder gb = std::move(w).finish();
+    set_replay_values(gb.global_state(), "key", values<Str>(Str{"a"}, Str{"b"}, Str{"a"}, Str{"b"}, Str{"c"}));
+    set_replay_values(gb.global_state(), "source", values<Int>(1, 2, 3, 4, 5));
+
+    GraphExecutorBuilder eb;
+    eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+    GraphExecutorValue ex = eb.make_executor();
+    ex.view().run();
+
+    // The stopped branch moves into the cache rather than the previous slot;
+    // "c" overflows the single cache entry and evicts "a".
+    REQUIRE(metrics.size() == 5);
+    CHECK(stored_counts == std::vector<std::size_t>{1, 1, 1, 1, 1});
+    CHECK(active_addresses[0] == active_addresses[2]);
+    CHECK(active_addresses[1] == active_addresses[3]);
+    CHECK(active_addresses[0] != active_addresses[1]);
+    std::vector<std::size_t> cached, hits, misses, evictions;
+    for (const SwitchBranchCacheMetrics &entry : metrics)
+    {
+        CHECK(entry.capacity == 1);
+        CHECK(entry.reserved_bytes > 0);
+        CHECK(entry.live_bytes == entry.cached_graph_count * entry.reserved_bytes);
+        cached.push_back(entry.cached_graph_count);
+        hits.push_back(entry.hits);
+        misses.push_back(entry.misses);
+        evictions.push_back(entry.evictions);
+    }
+    CHECK(cached == std::vector<std::size_t>{0, 1, 1, 1, 1});
+    CHECK(hits == std::vector<std::size_t>{0, 0, 1, 2, 2});
+    CHECK(misses == std::vector<std::size_t>{1, 2, 2, 2, 3});
+    CHECK(evictions == std::vector<std::size_t>{0, 0, 0, 0, 1});
+
+    // A cached branch comes back with fresh node state, like a rebuilt one.
+    CHECK_OUTPUT(eval_node<stdlib::switch_>(
+                     values<Str>(Str{"c"}, none, Str{"d"}, Str{"c"}),
+                     stdlib::switch_cases({{Value{Str{"c"}}, fn<CounterNode>()}, {Value{Str{"d"}}, fn<Doubler>()}})
+                         .cache(2),
+                     values<Int>(5, 6, 7, 8)),
+                 values<Int>(1, 2, 14, 1));
+}
+
 namespace
 {
     struct AddBoth
@@ -433,6 +433,17 @@ namespace
         }
     };
 
+    struct SparseActivityNode
+    {
+        static constexpr auto name = "type_erasure_perf_sparse_activity_node";
+
+        static void eval(hgraph::Scalar<"slot", hgraph::Int> slot, hgraph::State<hgraph::Int> ticks)
+        {
+            ticks.set(ticks.get() + 1);
+            g_graph_observation += static_cast<std::uint64_t>(slot.value()) + 1;
+        }
+    };
+
     struct ScalarObservationSink
     {
         static constexpr auto name = "type_erasure_perf_scalar_observation_sink";
@@ -1252,6 +1263,36 @@ int main()
         throw std::runtime_error("evaluation profiler benchmark produced no measurements");
     }
 
+    EvaluationProfiler sampled_profiler{EvaluationProfilerOptions{.sample_every = 16}};
+    MockGraphExecutor  sampled_executor{graph_builder, MIN_ST, MAX_ET};
+    sampled_executor.view().lifecycle_observers().add(&sampled_profiler);
+    auto sampled_graph = sampled_executor.view().graph();
+    sampled_graph.start(MIN_ST);
+    std::uint64_t sampled_cycle = 0;
+    run_benchmark(
+        "evaluation_profiler_sampled_cycle", 20000, samples, warmup,
+        [&] {
+            const DateTime evaluation_time =
+                MIN_ST + TimeDelta{static_cast<TimeDelta::rep>(++sampled_cycle)};
+            sampled_executor.set_evaluation_time(evaluation_time);
+            sampled_graph.schedule_node(0, evaluation_time);
+            if (!sampled_graph.evaluate(evaluation_time))
+            {
+                throw std::runtime_error("sampled graph evaluation paused");
+            }
+            return std::uint64_t{1};
+        },
+        [](std::uint64_t value) {
+            if (value != 1) { throw std::runtime_error("sampled graph evaluation failed"); }
+        });
+    sampled_graph.stop();
+    const auto sampled_profile = sampled_profiler.snapshot();
+    if (benchmark_selected("evaluation_profiler_sampled_cycle") &&
+        (sampled_profile.sampled_cycles == 0 || sampled_profile.sampled_cycles >= sampled_profile.graph_cycles))
+    {
+        throw std::runtime_error("sampled evaluation profiler benchmark did not sample");
+    }
+
     Wiring nested_wiring;
     auto nested_source = wire<stdlib::const_, TSD<Str, TS<Int>>>(
         nested_wiring,
@@ -1469,6 +1510,118 @@ int main()
 
     add_native_dynamic_tsl_variants("native_sparse_dynamic_tsl");
 
+    // Cycle cost versus graph width when only a fixed handful of nodes tick:
+    // the scan pays per node, the active set and timing wheel per scheduled
+    // node.
+    constexpr std::size_t sparse_activity_per_cycle = 30;
+    for (const std::size_t width : {std::size_t{1000}, std::size_t{10000}, std::size_t{50000}})
+    {
+        for (const auto &[mode, mode_name] : {std::pair{GraphSchedulingMode::Scan, "scan"},
+                                              std::pair{GraphSchedulingMode::ActiveSet, "active_set"},
+                                              std::pair{GraphSchedulingMode::TimingWheel, "timing_wheel"}})
+        {
+            const std::string name =
+                std::string{"sparse_activity_"} + mode_name + "_width_" + std::to_string(width);
+            if (!benchmark_selected(name)) { continue; }
+
+            Wiring wiring;
+            for (std::size_t slot = 0; slot < width; ++slot)
+            {
+                static_cast<void>(wire<SparseActivityNode>(wiring, static_cast<Int>(slot)));
+            }
+            GraphBuilder builder = std::move(wiring).finish();
+            builder.scheduling_mode(mode);
+
+            MockGraphExecutor executor{builder, MIN_ST, MAX_ET};
+            auto graph = executor.view().graph();
+            graph.start(MIN_ST);
+
+            const std::size_t stride = width / sparse_activity_per_cycle;
+            std::uint64_t cycle = 0;
+            std::uint64_t expected = 0;
+            for (std::size_t k = 0; k < sparse_activity_per_cycle; ++k) { expected += k * stride + 1; }
+            run_benchmark(
+                name, 2000, samples, warmup,
+                [&] {
+                    const DateTime evaluation_time =
+                        MIN_ST + TimeDelta{static_cast<TimeDelta::rep>(++cycle)};
+                    executor.set_evaluation_time(evaluation_time);
+                    g_graph_observation = 0;
+                    for (std::size_t k = 0; k < sparse_activity_per_cycle; ++k)
+                    {
+                        graph.schedule_node(k * stride, evaluation_time);
+                    }
+                    if (!graph.evaluate(evaluation_time))
+                    {
+                        throw std::runtime_error(name + " paused");
+                    }
+                    return g_graph_observation;
+                },
+                [&](std::uint64_t value) {
+                    if (value != expected) { throw std::runtime_error(name + " evaluated the wrong nodes"); }
+                });
+            graph.stop();
+        }
+    }
+
+    // The same sparse activity while every node also holds an alarm spread
+    // over the following 90 days: the active set keeps visiting every alarm
+    // holder each cycle, the timing wheel only the nodes that are due.
+    for (const std::size_t width : {std::size_t{10000}, std::size_t{50000}})
+    {
+        for (const auto &[mode, mode_name] : {std::pair{GraphSchedulingMode::ActiveSet, "active_set"},
+                                              std::pair{GraphSchedulingMode::TimingWheel, "timing_wheel"}})
+        {
+            const std::string name =
+                std::string{"sparse_alarms_"} + mode_name + "_width_" + std::to_string(width);
+            if (!benchmark_selected(name)) { continue; }
+
+            Wiring wiring;
+            for (std::size_t slot = 0; slot < width; ++slot)
+            {
+                static_cast<void>(wire<SparseActivityNode>(wiring, static_cast<Int>(slot)));
+            }
+            GraphBuilder builder = std::move(wiring).finish();
+            builder.scheduling_mode(mode);
+
+            MockGraphExecutor executor{builder, MIN_ST, MAX_ET};
+            auto graph = executor.view().graph();
+            graph.start(MIN_ST);
+            const TimeDelta alarm_spacing = std::chrono::days{90} / static_cast<TimeDelta::rep>(width);
+            for (std::size_t slot = 0; slot < width; ++slot)
+            {
+                graph.schedule_node(slot, MIN_ST + std::chrono::days{1} +
+                                              alarm_spacing * static_cast<TimeDelta::rep>(slot));
+            }
+
+            const std::size_t stride = width / sparse_activity_per_cycle;
+            std::uint64_t cycle = 0;
+            std::uint64_t expected = 0;
+            for (std::size_t k = 0; k < sparse_activity_per_cycle; ++k) { expected += k * stride + 1; }
+            run_benchmark(
+                name, 2000, samples, warmup,
+                [&] {
+                    const DateTime evaluation_time =
+                        MIN_ST + TimeDelta{static_cast<TimeDelta::rep>(++cycle)};
+                    executor.set_evaluation_time(evaluation_time);
+                    g_graph_observation = 0;
+                    for (std::size_t k = 0; k < sparse_activity_per_cycle; ++k)
+                    {
+                        graph.schedule_node(k * stride, evaluation_time);
+                    }
+                    if (!graph.evaluate(evaluation_time))
+                    {
+                        throw std::runtime_error(name + " paused");
+                    }
+                    return g_graph_observation;
+                },
+                [&](std::uint64_t value) {
+                    if (value != expected) { throw std::runtime_error(name + " evaluated the wrong nodes"); }
+                });
+            graph.stop();
+        }
+    }
+
     const std::vector<std::optional<Str>> switch_keys{Str{"a"}, Str{"b"}, Str{"a"}, Str{"b"}};
     const std::vector<std::optional<Int>> switch_inputs{Int{3}, Int{4}, Int{5}, Int{6}};
     const auto switch_cases =
@@ -0,0 +1,133 @@
+#include <hgraph/lib/std/std_operators.h>
+#include <hgraph/lib/testing/record_replay.h>
+#include <hgraph/runtime/runtime.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Sliding-window aggregate cost against window size. Each workload fills a
+// size window of ``window`` elements and then slides it for
+// HGRAPH_WINDOW_PERF_TICKS ticks, each a push plus an eviction. The
+// ``scan_sum`` baseline re-reads the whole window every tick, as the window
+// aggregates did before they kept incremental kernels in node state; it is
+// quadratic in the window, so it only runs up to ``scan_limit``.
+
+namespace
+{
+    using namespace hgraph;
+
+    constexpr std::size_t scan_limit = 10000;
+
+    struct WindowScanSum
+    {
+        static constexpr auto name = "window_scan_sum";
+
+        static void eval(In<"window", TsVar<"W">> input, Out<TS<Float>> out)
+        {
+            Float total = 0.0;
+            for (const ValueView value : input.base().as_window().values()) { total += value.checked_as<Float>(); }
+            out.set(total);
+        }
+    };
+
+    enum class Workload
+    {
+        ScanSum,
+        Sum,
+        Std,
+        Min,
+        Median,
+    };
+
+    constexpr std::array workloads{
+        std::pair{Workload::ScanSum, std::string_view{"scan_sum"}},
+        std::pair{Workload::Sum, std::string_view{"sum"}},
+        std::pair{Workload::Std, std::string_view{"std"}},
+        std::pair{Workload::Min, std::string_view{"min"}},
+        std::pair{Workload::Median, std::string_view{"median"}},
+    };
+
+    Port<void> wire_workload(Wiring &w, Workload workload, Port<void> window)
+    {
+        switch (workload)
+        {
+            case Workload::ScanSum: return wire<WindowScanSum, TS<Float>>(w, window);
+            case Workload::Sum: return wire<stdlib::sum_>(w, window);
+            case Workload::Std: return wire<stdlib::std_>(w, window);
+            case Workload::Min: return wire<stdlib::min_>(w, window);
+            case Workload::Median:
+            {
+                auto q = wire<stdlib::const_, TS<Float>>(w, Float{0.5});
+                return wire<stdlib::numpy::quantile>(w, window, q, Str{"linear"}, Bool{false});
+            }
+        }
+        return window;
+    }
+
+    /** Nanoseconds per input tick over the whole run (fill and slide). */
+    double run(Workload workload, std::size_t window, const std::vector<std::optional<Float>> &input)
+    {
+        Wiring w;
+        auto raw     = wire<stdlib::replay_impl, TS<Float>>(w, std::string{"raw"});
+        auto sliding = wire<stdlib::to_window>(w, raw, static_cast<Int>(window), static_cast<Int>(window));
+        wire<stdlib::dense_record_impl>(w, wire_workload(w, workload, sliding), std::string{"out"});
+
+        GraphBuilder gb = std::move(w).finish();
+        testing::set_replay_values<Float>(gb.global_state(), "raw", input);
+
+        GraphExecutorBuilder eb;
+        eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MAX_ET);
+        GraphExecutorValue executor = eb.make_executor();
+        auto               view     = executor.view();
+
+        const auto start = std::chrono::steady_clock::now();
+        view.run();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(input.size());
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr || *value == '\0') { return fallback; }
+        return std::max<std::size_t>(1, static_cast<std::size_t>(std::strtoull(value, nullptr, 10)));
+    }
+}  // namespace
+
+int main()
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    const std::size_t measured   = env_size("HGRAPH_WINDOW_PERF_TICKS", 20000);
+    const std::size_t max_window = env_size("HGRAPH_WINDOW_PERF_MAX_WINDOW", 100000);
+    const char       *filter     = std::getenv("HGRAPH_WINDOW_PERF_FILTER");
+
+    std::cout << "ticks=" << measured << " max_window=" << max_window << '\n';
+    for (std::size_t window = 10; window <= max_window; window *= 10)
+    {
+        std::vector<std::optional<Float>> input;
+        input.reserve(window + measured);
+        for (std::size_t tick = 0; tick < window + measured; ++tick)
+        {
+            input.emplace_back(static_cast<Float>((tick * 7919U) % 10007U) * 0.01);
+        }
+        for (const auto &[workload, name] : workloads)
+        {
+            if (filter != nullptr && *filter != '\0' && !name.contains(filter)) { continue; }
+            if (workload == Workload::ScanSum && window > scan_limit) { continue; }
+            std::cout << name << " window=" << window << " ns_per_tick=" << run(workload, window, input) << '\n';
+        }
+    }
+}